@@ -39,8 +39,107 @@ extern unsigned int expandBits(unsigned int v);
 // Calculates a 30-bit Morton code for the given 3D point located within the unit cube [0,1].
 extern unsigned int morton3D(float x, float y, float z);
 
+// The pairs of polygon-soup faces whose bounding boxes overlap (i.e. the result of the BVH traversal), where the
+// cut-mesh faces are offsetted by the number of source-mesh faces. The faces that each face may intersect are
+// stored contiguously and sorted (i.e. compressed sparse rows), so each pair is stored twice.
+class candidate_face_pairs_t {
+public:
+    // group the (unordered) pairs by face
+    void build(const block_executor_t& for_each_block, uint32_t num_ps_faces, const std::vector<std::pair<fd_t, fd_t>>& face_pairs);
+
+    void clear()
+    {
+        m_offsets.clear();
+        m_others.clear();
+        m_faces.clear();
+    }
+
+    bool empty() const
+    {
+        return m_faces.empty();
+    }
+
+    uint32_t number_of_faces() const
+    {
+        return m_offsets.empty() ? 0 : (uint32_t)m_offsets.size() - 1;
+    }
+
+    uint64_t number_of_pairs() const
+    {
+        return (uint64_t)m_others.size() / 2;
+    }
+
+    // the faces which may intersect another face (sorted)
+    const std::vector<fd_t>& faces() const
+    {
+        return m_faces;
+    }
+
+    bool is_candidate(const fd_t& f) const
+    {
+        return (uint32_t)f < number_of_faces() && m_offsets[f] != m_offsets[(uint32_t)f + 1];
+    }
+
+    std::vector<fd_t>::const_iterator others_begin(const fd_t& f) const
+    {
+        return m_others.cbegin() + m_offsets[f];
+    }
+
+    std::vector<fd_t>::const_iterator others_end(const fd_t& f) const
+    {
+        return m_others.cbegin() + m_offsets[(uint32_t)f + 1];
+    }
+
+private:
+    std::vector<uint32_t> m_offsets; // ... of the faces that each face may intersect (size = number of faces + 1)
+    std::vector<fd_t> m_others;
+    std::vector<fd_t> m_faces;
+};
+
 #if defined(USE_OIBVH)
 
+// The bounding boxes of the nodes of an OIBVH as a structure of arrays (i.e. "minimum(0)[node]" is the minimum x-coordinate
+// of the box of "node"). The boxes are single precision and rounded outwards, so they contain the double precision boxes.
+class oibvh_node_aabbs_t {
+public:
+    void resize(uint32_t num_nodes);
+
+    void clear()
+    {
+        resize(0);
+    }
+
+    uint32_t size() const
+    {
+        return (uint32_t)m_minimum[0].size();
+    }
+
+    bool empty() const
+    {
+        return m_minimum[0].empty();
+    }
+
+    // store "bbox" as the box of "node"
+    void set(uint32_t node, const bounding_box_t<vec3>& bbox);
+
+    // store the union of the boxes of "node_a" and "node_b" as the box of "node"
+    void set_union(uint32_t node, uint32_t node_a, uint32_t node_b);
+
+    const float* minimum(int axis) const
+    {
+        return m_minimum[axis].data();
+    }
+
+    const float* maximum(int axis) const
+    {
+        return m_maximum[axis].data();
+    }
+
+private:
+    std::vector<float> m_minimum[3];
+    std::vector<float> m_maximum[3];
+};
+
 // TODO: just use std::pair
 typedef struct
 {
@@ -100,18 +199,113 @@ extern int get_node_mem_index(
     const int bvh_data_base_offset,
     const int rightmostRealNodeImplicitIndexOnNodeLevel);
 
+// NOTE: the leaf nodes (faces) are sorted by the Morton code of their bounding box center, and the bounding boxes
+// of the faces and the nodes on each level are computed in parallel (if MCUT_MULTI_THREADED)
 extern void build_oibvh(
-    const hmesh_t& mesh,
-    std::vector<bounding_box_t<vec3>>& bvhAABBs,
+#if defined(MCUT_MULTI_THREADED)
+    thread_pool& scheduler,
+    uint32_t serial_execution_threshold,
+#endif
+    const compact_hmesh_t& mesh,
+    oibvh_node_aabbs_t& bvhAABBs,
     std::vector<fd_t>& bvhLeafNodeFaces,
     std::vector<bounding_box_t<vec3>>& face_bboxes,
     const double& slightEnlargmentEps = double(0.0));
 
+// NOTE: the BVHs are traversed in parallel (if MCUT_MULTI_THREADED), and the boxes of up to four pairs of child nodes
+// are tested for overlap at once (with SSE or NEON, if available)
 extern void intersectOIBVHs(
-    std::map<fd_t, std::vector<fd_t>>& ps_face_to_potentially_intersecting_others,
-    const std::vector<bounding_box_t<vec3>>& srcMeshBvhAABBs,
+#if defined(MCUT_MULTI_THREADED)
+    thread_pool& scheduler,
+    uint32_t serial_execution_threshold,
+#endif
+    candidate_face_pairs_t& ps_face_to_potentially_intersecting_others,
+    const oibvh_node_aabbs_t& srcMeshBvhAABBs,
     const std::vector<fd_t>& srcMeshBvhLeafNodeFaces,
-    const std::vector<bounding_box_t<vec3>>& cutMeshBvhAABBs,
+    const oibvh_node_aabbs_t& cutMeshBvhAABBs,
+    const std::vector<fd_t>& cutMeshBvhLeafNodeFaces);
+
+// A 4-wide BVH that is built top-down by splitting the faces with the surface area heuristic (SAH), which is evaluated
+// at a fixed number of bins. It takes longer to build than an OIBVH, but its boxes are tighter on meshes with faces of
+// very different sizes, so fewer of its nodes overlap the cut-mesh BVH. The (single precision) boxes of the children of
+// a node, and of the faces of a leaf, are stored together so that they are tested for overlap at once.
+class wide_bvh_t {
+public:
+    static const int width = 4;
+
+    struct node_t {
+        float m_minimum[3][width];
+        float m_maximum[3][width];
+        // index of the child node, or bitwise-not of the index of the leaf (unused children have empty boxes)
+        int32_t m_children[width];
+    };
+
+    struct leaf_t {
+        float m_minimum[3][width];
+        float m_maximum[3][width];
+        fd_t m_faces[width];
+        uint32_t m_face_count;
+    };
+
+    // NOTE: "face_bboxes" is set to the (double precision) bounding boxes of the faces
+    void build(const block_executor_t& for_each_block, const compact_hmesh_t& mesh, std::vector<bounding_box_t<vec3>>& face_bboxes);
+
+    void clear();
+
+    bool empty() const
+    {
+        return m_leaves.empty();
+    }
+
+    uint32_t number_of_faces() const
+    {
+        return m_face_count;
+    }
+
+    // the root node (see: node_t::m_children)
+    int32_t root() const
+    {
+        return m_root;
+    }
+
+    const float* root_minimum() const
+    {
+        return m_root_minimum;
+    }
+
+    const float* root_maximum() const
+    {
+        return m_root_maximum;
+    }
+
+    const std::vector<node_t>& nodes() const
+    {
+        return m_nodes;
+    }
+
+    const std::vector<leaf_t>& leaves() const
+    {
+        return m_leaves;
+    }
+
+private:
+    std::vector<node_t> m_nodes;
+    std::vector<leaf_t> m_leaves;
+    int32_t m_root = 0;
+    float m_root_minimum[3];
+    float m_root_maximum[3];
+    uint32_t m_face_count = 0;
+};
+
+// Same as intersectOIBVHs, but with a wide BVH of the source mesh.
+extern void intersectWideBVHAndOIBVH(
+#if defined(MCUT_MULTI_THREADED)
+    thread_pool& scheduler,
+    uint32_t serial_execution_threshold,
+#endif
+    candidate_face_pairs_t& ps_face_to_potentially_intersecting_others,
+    const wide_bvh_t& srcMeshBvh,
+    const oibvh_node_aabbs_t& cutMeshBvhAABBs,
     const std::vector<fd_t>& cutMeshBvhLeafNodeFaces);
 #else
 typedef bounding_box_t<vec3> BBox;
@@ -303,7 +497,7 @@ public:
 #if defined(MCUT_MULTI_THREADED)
         thread_pool& scheduler,
 #endif
-        std::map<fd_t, std::vector<fd_t>>& symmetric_intersecting_pairs,
+        candidate_face_pairs_t& symmetric_intersecting_pairs,
         const BoundingVolumeHierarchy& bvhA,
         const BoundingVolumeHierarchy& bvhB,
         const uint32_t primitiveOffsetA,
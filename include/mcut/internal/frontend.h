@@ -38,9 +38,13 @@
 
 #include "mcut/mcut.h"
 
+#include <atomic>
+#include <condition_variable>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 
 #if defined(MCUT_MULTI_THREADED)
 #include "mcut/internal/tpool.h"
@@ -85,6 +89,9 @@ struct array_mesh_t {
 struct connected_component_t {
     virtual ~connected_component_t() {};
     McConnectedComponentType type = (McConnectedComponentType)0;
+    // index of the cut mesh that produced this connected component in the most
+    // recent "mcDispatchBatch" call (-1 if not produced by that call)
+    int32_t batch_cut_mesh_index = -1;
     //array_mesh_t indexArrayMesh;
     //hmesh_t mesh;
     output_mesh_info_t kernel_hmesh_data;
@@ -147,19 +154,102 @@ void fn_delete_cc(connected_component_t* p)
     delete static_cast<Derived*>(p);
 }
 
+// struct defining the state of a mesh object (McMesh). This is the validated (read-only) halfedge
+// representation of the client's mesh arrays together with its BVH, which are kept so that they
+// need not be rebuilt on every dispatch call that uses the mesh. The kernel's (mutable) hmesh_t is
+// built from "compact_hmesh" during each dispatch (see: preproc).
+struct mesh_t {
+    compact_hmesh_t compact_hmesh;
+    // length of the diagonal of the mesh's axis-aligned bounding box
+    double hmesh_aabb_diag = 0.0;
+    // number of vertices and faces in the client's arrays
+    uint32_t client_vertex_count = 0;
+    uint32_t client_face_count = 0;
+#if defined(USE_OIBVH)
+    oibvh_node_aabbs_t bvh_aabb_array;
+    std::vector<fd_t> bvh_leafdata_array;
+    std::vector<bounding_box_t<vec3>> face_aabb_array;
+    // used instead of "bvh_aabb_array" and "bvh_leafdata_array" if the mesh was created with MC_DISPATCH_WIDE_BVH
+    wide_bvh_t wide_bvh;
+#endif
+};
+
+// struct defining the state of an event object (McEvent), which tracks the execution
+// of an asynchronous dispatch call
+struct event_t {
+#if defined(MCUT_MULTI_THREADED)
+    // becomes ready with the McResult of the dispatch once it has finished (i.e. before the callback is invoked)
+    std::shared_future<McResult> future;
+#endif
+    // McEventCommandExecStatus
+    std::atomic<uint32_t> command_exec_status;
+    // McResult of the dispatch
+    std::atomic<int32_t> runtime_exec_status;
+    // nanoseconds (steady clock)
+    std::atomic<uint64_t> timestamp_submit;
+    std::atomic<uint64_t> timestamp_start;
+    std::atomic<uint64_t> timestamp_end;
+    // user-defined completion callback
+    pfn_McEvent_CALLBACK callback = nullptr;
+    void* callback_user_data = nullptr;
+
+    event_t()
+        : command_exec_status(MC_SUBMITTED)
+        , runtime_exec_status(MC_NO_ERROR)
+        , timestamp_submit(0)
+        , timestamp_start(0)
+        , timestamp_end(0)
+    {
+    }
+};
+
 // struct defining the state of a context object
 struct context_t {
 #if defined(MCUT_MULTI_THREADED)
-    // work scheduling state
-    thread_pool scheduler;
+    // work scheduling state, which may be shared with other contexts (see: MC_CONTEXT_SHARED_THREAD_POOL)
+    std::shared_ptr<thread_pool> scheduler;
 #endif
 
     // the current set of connected components associated with context
     std::map<McConnectedComponent, std::unique_ptr<connected_component_t, void (*)(connected_component_t*)>> connected_components = {};
 
-    // The state and flag variable current used to configure the next dispatch call
+    // guards "connected_components", which is also updated by asynchronous dispatch calls
+    std::mutex connected_components_mutex;
+
+    // the current set of mesh objects associated with context
+    std::map<McMesh, std::unique_ptr<mesh_t>> meshes = {};
+
+    // guards "meshes", which may be accessed concurrently by API calls from different threads
+    std::mutex meshes_mutex;
+
+    // the current set of events (asynchronous dispatch calls) associated with context
+    std::map<McEvent, std::unique_ptr<event_t>> events = {};
+
+    // guards "events", which may also be accessed by completion callbacks on worker threads
+    std::mutex events_mutex;
+
+#if defined(MCUT_MULTI_THREADED)
+    // the number of completion callbacks that are still running. A callback is invoked after its event is complete,
+    // and may still use the context (e.g. to release its event), so "release_context_impl" waits for it to return.
+    uint32_t num_running_callbacks = 0;
+    std::mutex running_callbacks_mutex;
+    std::condition_variable running_callbacks_cv;
+#endif
+
+    // The flags with which the context was created
     McFlags flags = (McFlags)0;
-    McFlags dispatchFlags = (McFlags)0;
+
+    // parallel stages with fewer elements than this are executed serially (see: MC_CONTEXT_SERIAL_EXECUTION_THRESHOLD)
+    std::atomic<uint32_t> serial_execution_threshold { 512 };
+
+    // statistics of the most recently completed dispatch call (see: MC_PROFILING_ENABLE)
+    dispatch_stats_t dispatch_stats;
+    std::mutex dispatch_stats_mutex;
+
+    // timeline of the work done for the context (see: MC_TRACING_ENABLE), or NULL
+    std::unique_ptr<trace_t> trace;
+    // file to which "trace" is written when the context is released (see: MC_CONTEXT_TRACE_FILE)
+    std::string trace_file_path;
 
     // client/user debugging variable
     // ------------------------------
@@ -190,11 +280,80 @@ struct context_t {
     }
 };
 
+// A reader-writer spin lock. Any number of readers may hold the lock at the same
+// time, and a reader only does a compare-and-swap on an atomic counter. Writers
+// wait for all readers to leave, and new readers wait while a writer is waiting
+// (i.e. so that a steady stream of readers cannot starve the writers).
+//
+// NOTE: this is used for short critical sections (map lookups and insertions)
+// where blocking on a mutex would cost more than spinning.
+class reader_writer_lock_t {
+    // -1 : held by a writer
+    // 0  : free
+    // >0 : number of readers holding the lock
+    std::atomic<int32_t> state;
+    // number of writers waiting for the lock
+    std::atomic<int32_t> num_waiting_writers;
+
+public:
+    reader_writer_lock_t()
+        : state(0)
+        , num_waiting_writers(0)
+    {
+    }
+
+    void lock_shared()
+    {
+        for (;;) {
+            int32_t expected = state.load(std::memory_order_relaxed);
+            if (expected >= 0 && num_waiting_writers.load(std::memory_order_relaxed) == 0 && state.compare_exchange_weak(expected, expected + 1, std::memory_order_acquire)) {
+                return;
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    void unlock_shared()
+    {
+        state.fetch_sub(1, std::memory_order_release);
+    }
+
+    void lock()
+    {
+        num_waiting_writers.fetch_add(1, std::memory_order_relaxed);
+
+        for (;;) {
+            int32_t expected = 0;
+            if (state.compare_exchange_weak(expected, -1, std::memory_order_acquire)) {
+                num_waiting_writers.fetch_sub(1, std::memory_order_relaxed);
+                return;
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    void unlock()
+    {
+        state.store(0, std::memory_order_release);
+    }
+};
+
 // list of contexts created by client/user
+//
+// NOTE: API functions may be called concurrently on different contexts from
+// different threads. "g_contexts" is therefore only accessed while holding
+// "g_contexts_lock", and only for as long as it takes to look up, add or remove
+// an entry. The context objects themselves are not guarded by this lock (see
+// "get_context").
 extern "C" std::map<McContext, std::unique_ptr<context_t>> g_contexts;
+extern "C" reader_writer_lock_t g_contexts_lock;
+
+// return the context object of the given handle, or throw std::invalid_argument if the handle
+// is not an existing context. The returned reference stays valid until the context is released.
+std::unique_ptr<context_t>& get_context(McContext context) noexcept(false);
 
 extern "C" void create_context_impl(
-    McContext* pContext, McFlags flags) noexcept(false);
+    McContext* pContext, McFlags flags, uint32_t num_helper_threads) noexcept(false);
 
 extern "C" void debug_message_callback_impl(
     McContext context,
@@ -215,6 +374,12 @@ extern "C" void get_info_impl(
     void* pMem,
     uint64_t* pNumBytes) noexcept(false);
 
+extern "C" void set_context_property_impl(
+    const McContext context,
+    McFlags property,
+    uint64_t bytes,
+    const void* pMem) noexcept(false);
+
 extern "C" void dispatch_impl(
     McContext context,
     McFlags flags,
@@ -229,6 +394,77 @@ extern "C" void dispatch_impl(
     uint32_t numCutMeshVertices,
     uint32_t numCutMeshFaces) noexcept(false);
 
+extern "C" void create_mesh_impl(
+    McContext context,
+    McMesh* pMesh,
+    McFlags flags,
+    const void* pVertices,
+    const uint32_t* pFaceIndices,
+    const uint32_t* pFaceSizes,
+    uint32_t numVertices,
+    uint32_t numFaces) noexcept(false);
+
+extern "C" void dispatch_meshes_impl(
+    McContext context,
+    McFlags flags,
+    McMesh srcMesh,
+    const void* pCutMeshVertices,
+    const uint32_t* pCutMeshFaceIndices,
+    const uint32_t* pCutMeshFaceSizes,
+    uint32_t numCutMeshVertices,
+    uint32_t numCutMeshFaces) noexcept(false);
+
+extern "C" void dispatch_batch_impl(
+    McContext context,
+    McFlags flags,
+    McMesh srcMesh,
+    uint32_t numCutMeshes,
+    const void* const* ppCutMeshVertices,
+    const uint32_t* const* ppCutMeshFaceIndices,
+    const uint32_t* const* ppCutMeshFaceSizes,
+    const uint32_t* pNumCutMeshVertices,
+    const uint32_t* pNumCutMeshFaces,
+    McResult* pResults) noexcept(false);
+
+extern "C" void enqueue_dispatch_impl(
+    McContext context,
+    McFlags flags,
+    const void* pSrcMeshVertices,
+    const uint32_t* pSrcMeshFaceIndices,
+    const uint32_t* pSrcMeshFaceSizes,
+    uint32_t numSrcMeshVertices,
+    uint32_t numSrcMeshFaces,
+    const void* pCutMeshVertices,
+    const uint32_t* pCutMeshFaceIndices,
+    const uint32_t* pCutMeshFaceSizes,
+    uint32_t numCutMeshVertices,
+    uint32_t numCutMeshFaces,
+    pfn_McEvent_CALLBACK pfnNotify,
+    void* pUserData,
+    McEvent* pEvent) noexcept(false);
+
+extern "C" void wait_for_events_impl(
+    McContext context,
+    uint32_t numEvents,
+    const McEvent* pEventList) noexcept(false);
+
+extern "C" void get_event_info_impl(
+    McContext context,
+    McEvent event,
+    McFlags info,
+    uint64_t bytes,
+    void* pMem,
+    uint64_t* pNumBytes) noexcept(false);
+
+extern "C" void release_events_impl(
+    McContext context,
+    uint32_t numEvents,
+    const McEvent* pEvents) noexcept(false);
+
+extern "C" void release_mesh_impl(
+    McContext context,
+    McMesh mesh) noexcept(false);
+
 extern "C" void get_connected_components_impl(
     const McContext context,
     const McConnectedComponentType connectedComponentType,
@@ -236,6 +472,14 @@ extern "C" void get_connected_components_impl(
     McConnectedComponent* pConnComps,
     uint32_t* numConnComps) noexcept(false);
 
+extern "C" void get_batch_connected_components_impl(
+    const McContext context,
+    const uint32_t cutMeshIndex,
+    const McConnectedComponentType connectedComponentType,
+    const uint32_t numEntries,
+    McConnectedComponent* pConnComps,
+    uint32_t* numConnComps) noexcept(false);
+
 extern "C" void get_connected_component_data_impl(
     const McContext context,
     const McConnectedComponent connCompId,
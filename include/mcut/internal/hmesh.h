@@ -26,10 +26,16 @@
 #include "mcut/internal/math.h"
 #include "mcut/internal/utils.h"
 
+#if defined(MCUT_MULTI_THREADED)
+#include "mcut/internal/tpool.h"
+#endif
+
 #include <algorithm>
 #include <limits>
 #include <map>
 #include <memory>
+#include <type_traits>
+#include <unordered_map>
 #include <vector>
 
 template <typename T>
@@ -37,7 +43,6 @@ class descriptor_t_ {
 public:
     typedef unsigned int index_type;
     descriptor_t_() { }
-    virtual ~descriptor_t_() { }
     explicit descriptor_t_(index_type i = (std::numeric_limits<index_type>::max)())
         : m_value(i)
     {
@@ -127,10 +132,6 @@ public:
         : descriptor_t_<halfedge_descriptor_t>(idx)
     {
     }
-
-    virtual ~halfedge_descriptor_t()
-    {
-    }
 };
 
 class edge_descriptor_t : public descriptor_t_<edge_descriptor_t> {
@@ -144,10 +145,6 @@ public:
         : descriptor_t_<edge_descriptor_t>(idx)
     {
     }
-
-    virtual ~edge_descriptor_t()
-    {
-    }
 };
 
 class face_descriptor_t : public descriptor_t_<face_descriptor_t> {
@@ -161,10 +158,6 @@ public:
         : descriptor_t_<face_descriptor_t>(idx)
     {
     }
-
-    virtual ~face_descriptor_t()
-    {
-    }
 };
 
 class vertex_descriptor_t : public descriptor_t_<vertex_descriptor_t> {
@@ -178,12 +171,14 @@ public:
         : descriptor_t_<vertex_descriptor_t>(idx)
     {
     }
-
-    virtual ~vertex_descriptor_t()
-    {
-    }
 };
 
+// descriptors are plain indices, which are stored in large arrays (e.g. the connectivity of a mesh)
+static_assert(std::is_trivially_copyable<vertex_descriptor_t>::value && std::is_standard_layout<vertex_descriptor_t>::value && sizeof(vertex_descriptor_t) == sizeof(unsigned int), "vertex descriptor must be a plain index");
+static_assert(std::is_trivially_copyable<halfedge_descriptor_t>::value && std::is_standard_layout<halfedge_descriptor_t>::value && sizeof(halfedge_descriptor_t) == sizeof(unsigned int), "halfedge descriptor must be a plain index");
+static_assert(std::is_trivially_copyable<edge_descriptor_t>::value && std::is_standard_layout<edge_descriptor_t>::value && sizeof(edge_descriptor_t) == sizeof(unsigned int), "edge descriptor must be a plain index");
+static_assert(std::is_trivially_copyable<face_descriptor_t>::value && std::is_standard_layout<face_descriptor_t>::value && sizeof(face_descriptor_t) == sizeof(unsigned int), "face descriptor must be a plain index");
+
 template <typename T>
 struct id_ {
     typedef T type;
@@ -206,6 +201,8 @@ struct halfedge_data_t : id_<halfedge_descriptor_t> {
     }
 };
 
+static_assert(std::is_trivially_copyable<halfedge_data_t>::value && sizeof(halfedge_data_t) == 6 * sizeof(unsigned int), "halfedge connectivity must be a plain array of indices");
+
 struct edge_data_t : id_<edge_descriptor_t> {
     halfedge_descriptor_t h; // primary halfedge (even idx)
 };
@@ -220,6 +217,68 @@ struct vertex_data_t : id_<vertex_descriptor_t> {
     std::vector<halfedge_descriptor_t> m_halfedges; // ... which point to vertex (note: can be used to infer edges too)
 };
 
+// Calls "fn(first, last)" on blocks of an index range [0, n), which are processed in parallel when
+// there are enough of them. The blocks start at multiples of "block_size" (and with a single thread, or
+// if "n" is small, "fn" is called once with the whole range).
+class block_executor_t {
+public:
+    static const uint32_t block_size = (1 << 12);
+
+private:
+#if defined(MCUT_MULTI_THREADED)
+    thread_pool& m_scheduler;
+    const uint32_t m_serial_execution_threshold;
+
+public:
+    block_executor_t(thread_pool& scheduler, uint32_t serial_execution_threshold)
+        : m_scheduler(scheduler)
+        , m_serial_execution_threshold(serial_execution_threshold)
+    {
+    }
+#else
+public:
+#endif
+
+    template <typename FunctionType>
+    void operator()(uint32_t n, const FunctionType& fn) const
+    {
+#if defined(MCUT_MULTI_THREADED)
+        if (m_scheduler.get_num_threads() == 0 || n < m_serial_execution_threshold || n <= block_size) {
+            fn(0, n);
+            return;
+        }
+
+        std::vector<std::future<void>> futures;
+        task_group group(m_scheduler);
+
+        for (uint32_t block_start = block_size; block_start < n; block_start += block_size) {
+            const uint32_t block_end = std::min(block_start + block_size, n);
+            futures.push_back(group.submit([&fn, block_start, block_end]() { fn(block_start, block_end); }));
+        }
+
+        std::exception_ptr master_thread_exception;
+
+        try {
+            fn(0, block_size);
+        } catch (...) {
+            master_thread_exception = std::current_exception(); // the other blocks reference "fn"
+        }
+
+        group.wait(futures);
+
+        if (master_thread_exception) {
+            std::rethrow_exception(master_thread_exception);
+        }
+
+        for (std::vector<std::future<void>>::iterator f = futures.begin(); f != futures.end(); ++f) {
+            f->get();
+        }
+#else
+        fn(0, n);
+#endif
+    }
+};
+
 typedef std::vector<vertex_data_t> vertex_array_t;
 typedef std::vector<edge_data_t> edge_array_t;
 typedef std::vector<halfedge_data_t> halfedge_array_t;
@@ -230,6 +289,45 @@ typedef array_iterator_t<vertex_array_t> vertex_array_iterator_t;
 typedef array_iterator_t<edge_array_t> edge_array_iterator_t;
 typedef array_iterator_t<halfedge_array_t> halfedge_array_iterator_t;
 
+// The removed elements of one type (e.g. faces) of a mesh, as a bitset over the element indices. Besides
+// constant-time lookup, it counts the removed elements in an index range with a Fenwick tree over the
+// number of removed elements in each block of bits, and finds the next element that is not removed by
+// testing a whole word of bits at a time.
+class removed_elements_bitset_t {
+public:
+    removed_elements_bitset_t();
+
+    void insert(uint32_t i);
+    void erase(uint32_t i);
+    bool contains(uint32_t i) const;
+    void clear();
+
+    // number of removed elements with an index in [first, last)
+    uint32_t count(uint32_t first, uint32_t last) const;
+    // the smallest index, which is not less than "i", of an element that is not removed
+    uint32_t find_next_not_removed(uint32_t i) const;
+
+private:
+    static const uint32_t words_per_block = 8; // i.e. 512 bits per node of the Fenwick tree
+
+    // number of removed elements with an index less than "i"
+    uint32_t rank(uint32_t i) const;
+    void grow(uint32_t num_words);
+
+    std::vector<uint64_t> m_words; // bit "i" is set if element "i" is removed
+    std::vector<uint32_t> m_block_counts; // Fenwick tree (one-based) over the number of set bits in each block
+};
+
+// maps the descriptors of a mesh before hmesh_t::compact to those after (removed elements map to null descriptors)
+struct hmesh_remap_t {
+    std::vector<vertex_descriptor_t> vertices;
+    std::vector<edge_descriptor_t> edges;
+    std::vector<halfedge_descriptor_t> halfedges;
+    std::vector<face_descriptor_t> faces;
+};
+
+class compact_hmesh_t; // see below
+
 /*
     Internal mesh data structure used for cutting meshes
 
@@ -292,6 +390,13 @@ public:
     // finds an edge between two vertices. Returns a default constructed halfedge descriptor, if source and target are not connected.
     edge_descriptor_t edge(const vertex_descriptor_t s, const vertex_descriptor_t t, bool strict_check = false) const;
 
+    // Maintain an index from each pair of connected vertices to their edge, with which the two functions above take
+    // constant time instead of searching the halfedges around both vertices (quadratic in vertex valence). It is worth
+    // enabling while many faces are added (e.g. bulk construction), since add_face looks up every edge of the face.
+    // Enabling builds the index from the current edges, and disabling frees it.
+    void enable_edge_index(bool enable);
+    bool is_edge_index_enabled() const;
+
     vertex_descriptor_t add_vertex(const vec3& point);
 
     vertex_descriptor_t add_vertex(const double& x, const double& y, const double& z);
@@ -299,6 +404,29 @@ public:
     // halfedge whole target is "v1"
     halfedge_descriptor_t add_edge(const vertex_descriptor_t v0, const vertex_descriptor_t v1);
     face_descriptor_t add_face(const std::vector<vertex_descriptor_t>& vi);
+    // Adds all faces of an index-array mesh at once, where face "i" is defined by the vertices
+    // face_indices[face_offsets[i]] ... face_indices[face_offsets[i + 1] - 1], and returns the number of
+    // faces (i.e. face_offsets.size() - 1). The result, including every descriptor, is the same as calling
+    // add_face on each face in order, but the edges are found by sorting the vertex pairs of all faces rather
+    // than by a lookup per face. The vertices must already exist, the mesh must not have any edges or faces,
+    // and each face must have at least three distinct (valid) vertices. If a face would be incident to a
+    // non-manifold edge (see: add_face), the mesh is left unchanged and the index of the first such face
+    // is returned instead.
+    uint32_t build_from_arrays(
+#if defined(MCUT_MULTI_THREADED)
+        thread_pool& scheduler,
+        uint32_t serial_execution_threshold,
+#endif
+        const uint32_t* face_indices,
+        const std::vector<uint32_t>& face_offsets);
+    // Builds the mesh from its compact copy, with the same descriptors. The mesh must be empty, and the
+    // copy must not have any removed elements (e.g. it was built with compact_hmesh_t::build_from_arrays).
+    void build_from_compact(
+#if defined(MCUT_MULTI_THREADED)
+        thread_pool& scheduler,
+        uint32_t serial_execution_threshold,
+#endif
+        const compact_hmesh_t& mesh);
     // checks whether adding this face will violate 2-manifoldness (i.e. halfedge 
     // construction rules) which would lead to creating a non-manifold edge 
     // (one that is referenced by more than 2 faces which is illegal). 
@@ -312,6 +440,12 @@ public:
     void remove_edge(const edge_descriptor_t e, bool remove_halfedges = true);
     void remove_vertex(const vertex_descriptor_t v);
     void remove_elements();
+    // Closes the gaps left by removed elements, so that the remaining elements (which keep their order) are
+    // numbered consecutively and none are marked as removed. Returns the mapping from old to new descriptors.
+    hmesh_remap_t compact();
+    // number of times that the elements have been renumbered (i.e. by "compact" or "reset"), which invalidates
+    // the values of a property map (see: property_map_t)
+    uint32_t number_of_compactions() const;
 
     void reset();
 
@@ -349,6 +483,17 @@ public:
     const std::vector<halfedge_descriptor_t>& get_removed_elements(id_<array_iterator_t<halfedge_array_t>>) const;
     const std::vector<face_descriptor_t>& get_removed_elements(id_<array_iterator_t<face_array_t>>) const;
 
+    template <typename I = int>
+    I get_removed_elements_bitset(id_<I>)
+    {
+        return I(); // unused
+    }
+
+    const removed_elements_bitset_t& get_removed_elements_bitset(id_<array_iterator_t<vertex_array_t>>) const;
+    const removed_elements_bitset_t& get_removed_elements_bitset(id_<array_iterator_t<edge_array_t>>) const;
+    const removed_elements_bitset_t& get_removed_elements_bitset(id_<array_iterator_t<halfedge_array_t>>) const;
+    const removed_elements_bitset_t& get_removed_elements_bitset(id_<array_iterator_t<face_array_t>>) const;
+
     //
     template <typename I = int>
     I elements_begin_(id_<I>)
@@ -373,18 +518,16 @@ public:
 
         // raw starting ptr offset
         const uint32_t start_ = (std::uint32_t)(start - elements_begin_(id_<array_iterator_t<I>> {}, false));
-        uint32_t n = 0;
 
-        for (auto elem_descr : get_removed_elements(id_<array_iterator_t<I>> {})) {
-            const uint32_t descr = (uint32_t)elem_descr;
-
-            if (descr >= start_ && (descr <= (start_ + (uint32_t)(N - 1)))) {
-                ++n;
-            }
-        }
-        return n;
+        return get_removed_elements_bitset(id_<array_iterator_t<I>> {}).count(start_, start_ + (uint32_t)N);
     }
 
+    // number of elements (including removed ones) of the type of a descriptor e.g. id_<vertex_descriptor_t>
+    int number_of_internal_elements(id_<vertex_descriptor_t>) const { return number_of_internal_vertices(); }
+    int number_of_internal_elements(id_<edge_descriptor_t>) const { return number_of_internal_edges(); }
+    int number_of_internal_elements(id_<halfedge_descriptor_t>) const { return number_of_internal_halfedges(); }
+    int number_of_internal_elements(id_<face_descriptor_t>) const { return number_of_internal_faces(); }
+
     const vec3& vertex(const vertex_descriptor_t& vd) const;
     // returns vector of halfedges which point to vertex (i.e. "v" is their target)
     const std::vector<halfedge_descriptor_t>& get_halfedges_around_vertex(const vertex_descriptor_t v) const;
@@ -415,6 +558,9 @@ public:
     const std::vector<face_descriptor_t>& get_removed_faces() const;
 
 private:
+    // halfedge from "s" to "t" (found by searching the halfedges around both vertices), regardless of whether it has a face
+    halfedge_descriptor_t find_halfedge(const vertex_descriptor_t s, const vertex_descriptor_t t) const;
+
     // member variables
     // ----------------
 
@@ -423,14 +569,23 @@ private:
     std::vector<halfedge_data_t> m_halfedges;
     std::vector<face_data_t> m_faces;
 
-    // NOTE: I use std::vector because we'll have very few (typically zero)
-    // elements removed at a given time. In fact removal only happens during
-    // input-mesh face-partitioning to resolve floating polygons, which is
-    // rare. Maybe in the future things change...
+    // removed elements, whose slots are reused (oldest first) when elements are added
     std::vector<face_descriptor_t> m_faces_removed;
     std::vector<edge_descriptor_t> m_edges_removed;
     std::vector<halfedge_descriptor_t> m_halfedges_removed;
     std::vector<vertex_descriptor_t> m_vertices_removed;
+    // the same elements as the lists above (which also keep the order of removal, in which slots are reused)
+    removed_elements_bitset_t m_faces_removed_bitset;
+    removed_elements_bitset_t m_edges_removed_bitset;
+    removed_elements_bitset_t m_halfedges_removed_bitset;
+    removed_elements_bitset_t m_vertices_removed_bitset;
+
+    // (see: enable_edge_index) maps the sorted pair of vertex descriptors of an edge (as one 64-bit key) to one of its
+    // halfedges. If there are several edges between two vertices, the index holds the one that was added first.
+    bool m_edge_index_enabled;
+    std::unordered_map<uint64_t, halfedge_descriptor_t> m_edge_index;
+
+    uint32_t m_compaction_count;
 
 }; // class hmesh_t {
 
@@ -439,9 +594,194 @@ typedef halfedge_descriptor_t hd_t;
 typedef edge_descriptor_t ed_t;
 typedef face_descriptor_t fd_t;
 
+// A value of type "T" for each element of a mesh of one type (given by the descriptor type "D"), which is stored in a
+// flat array indexed by descriptor (instead of e.g. a std::unordered_map keyed by descriptor). The array grows with
+// the elements of the mesh when a value is assigned, and elements without a value have the default value. The values
+// no longer refer to the right elements once the mesh renumbers its elements (see: hmesh_t::compact).
+// NOTE: different threads may assign the values of different elements, provided that the array does not grow (e.g.
+// the elements existed when the property map was created).
+template <typename D, typename T>
+class property_map_t {
+    static_assert(!std::is_same<T, bool>::value, "use an integer instead of bool (i.e. the values are not bits)");
+
+public:
+    explicit property_map_t(const T& default_value = T())
+        : m_default_value(default_value)
+    {
+    }
+
+    // a value for each element of "mesh" (which must outlive the property map)
+    explicit property_map_t(const hmesh_t& mesh, const T& default_value = T())
+        : m_values((size_t)mesh.number_of_internal_elements(id_<D> {}), default_value)
+        , m_default_value(default_value)
+#if defined(MCUT_DEBUG_BUILD)
+        , m_mesh(&mesh)
+        , m_mesh_compaction_count(mesh.number_of_compactions())
+#endif
+    {
+    }
+
+    // a value for each of "num_elements" elements (e.g. of a polygon soup)
+    property_map_t(uint32_t num_elements, const T& default_value)
+        : m_values(num_elements, default_value)
+        , m_default_value(default_value)
+    {
+    }
+
+    T& operator[](const D& d)
+    {
+        MCUT_ASSERT(d.is_valid() && is_up_to_date());
+
+        if ((uint32_t)d >= (uint32_t)m_values.size()) {
+            m_values.resize((size_t)d + 1, m_default_value);
+        }
+
+        return m_values[d];
+    }
+
+    const T& operator[](const D& d) const
+    {
+        MCUT_ASSERT(d.is_valid() && is_up_to_date());
+        return ((uint32_t)d < (uint32_t)m_values.size()) ? m_values[d] : m_default_value;
+    }
+
+    // whether the value of "d" is not the default value
+    bool contains(const D& d) const
+    {
+        return !((*this)[d] == m_default_value);
+    }
+
+    const T& default_value() const
+    {
+        return m_default_value;
+    }
+
+    // number of elements with a (possibly default) value
+    uint32_t size() const
+    {
+        return (uint32_t)m_values.size();
+    }
+
+    // reset all values to the default
+    void clear()
+    {
+        std::fill(m_values.begin(), m_values.end(), m_default_value);
+    }
+
+private:
+    bool is_up_to_date() const
+    {
+#if defined(MCUT_DEBUG_BUILD)
+        return m_mesh == nullptr || m_mesh->number_of_compactions() == m_mesh_compaction_count;
+#else
+        return true;
+#endif
+    }
+
+    std::vector<T> m_values;
+    T m_default_value;
+#if defined(MCUT_DEBUG_BUILD)
+    const hmesh_t* m_mesh = nullptr;
+    uint32_t m_mesh_compaction_count = 0;
+#endif
+};
+
+template <typename T>
+using vertex_property_map_t = property_map_t<vertex_descriptor_t, T>;
+template <typename T>
+using edge_property_map_t = property_map_t<edge_descriptor_t, T>;
+template <typename T>
+using halfedge_property_map_t = property_map_t<halfedge_descriptor_t, T>;
+template <typename T>
+using face_property_map_t = property_map_t<face_descriptor_t, T>;
+
 void write_off(const char* fpath, const hmesh_t& mesh);
 void read_off(hmesh_t& mesh, const char* fpath);
 
+/*
+    Read-only copy of a halfedge mesh in which each attribute (e.g. the target vertex of
+    every halfedge) is stored in its own flat array. Faces only store one of their halfedges,
+    so that face loops are traversed via "next", and the halfedges around each vertex are
+    stored in CSR form (offsets into one array). Building it takes a fixed number of
+    allocations, unlike hmesh_t which allocates per face and per vertex.
+
+    Descriptors are those of the hmesh_t from which the copy was made. Elements that are
+    removed in that mesh are kept as holes (see: is_removed()).
+*/
+class compact_hmesh_t {
+public:
+    compact_hmesh_t();
+    explicit compact_hmesh_t(const hmesh_t& mesh);
+
+    void build(const hmesh_t& mesh);
+    // Builds the copy directly from an index-array mesh, with the same descriptors as hmesh_t::build_from_arrays
+    // (i.e. without building the hmesh_t first). The vertex positions are taken from "vertex_positions", which is
+    // left empty, and the return value is that of hmesh_t::build_from_arrays. The copy is unchanged on failure.
+    uint32_t build_from_arrays(
+#if defined(MCUT_MULTI_THREADED)
+        thread_pool& scheduler,
+        uint32_t serial_execution_threshold,
+#endif
+        std::vector<vec3>& vertex_positions,
+        const uint32_t* face_indices,
+        const std::vector<uint32_t>& face_offsets);
+
+    // excluding removed elements
+    int number_of_vertices() const;
+    int number_of_halfedges() const;
+    int number_of_faces() const;
+
+    // including removed elements (i.e. the range of valid descriptors)
+    int number_of_internal_vertices() const;
+    int number_of_internal_halfedges() const;
+    int number_of_internal_faces() const;
+
+    bool is_removed(const face_descriptor_t f) const;
+    bool is_removed(const vertex_descriptor_t v) const;
+
+    const vec3& vertex(const vertex_descriptor_t v) const;
+
+    vertex_descriptor_t source(const halfedge_descriptor_t h) const;
+    vertex_descriptor_t target(const halfedge_descriptor_t h) const;
+    halfedge_descriptor_t opposite(const halfedge_descriptor_t h) const;
+    halfedge_descriptor_t next(const halfedge_descriptor_t h) const;
+    face_descriptor_t face(const halfedge_descriptor_t h) const;
+
+    // a halfedge of the face (i.e. the start of the face loop)
+    halfedge_descriptor_t halfedge(const face_descriptor_t f) const;
+
+    // same order as hmesh_t::get_vertices_around_face
+    void get_vertices_around_face(std::vector<vertex_descriptor_t>& vertex_descriptors, const face_descriptor_t f) const;
+    uint32_t get_num_vertices_around_face(const face_descriptor_t f) const;
+
+    // range of the halfedges which point to vertex (i.e. "v" is their target)
+    const halfedge_descriptor_t* halfedges_around_vertex_begin(const vertex_descriptor_t v) const;
+    const halfedge_descriptor_t* halfedges_around_vertex_end(const vertex_descriptor_t v) const;
+
+private:
+    // builds the halfedges around each vertex from the target of each halfedge
+    void build_vertex_halfedges();
+
+    std::vector<vec3> m_vertex_positions;
+    // NOTE: empty if no vertices are removed, which is the common case
+    std::vector<bool> m_vertex_removed;
+
+    // NOTE: there is no "opposite" array since halfedges are created in opposite pairs (see: hmesh_t::add_edge)
+    std::vector<halfedge_descriptor_t> m_halfedge_next;
+    std::vector<vertex_descriptor_t> m_halfedge_target;
+    std::vector<face_descriptor_t> m_halfedge_face;
+
+    std::vector<halfedge_descriptor_t> m_face_halfedge;
+
+    // halfedges around vertex "v" are [m_vertex_halfedges_offsets[v], m_vertex_halfedges_offsets[v + 1])
+    std::vector<uint32_t> m_vertex_halfedges_offsets;
+    std::vector<halfedge_descriptor_t> m_vertex_halfedges;
+
+    int m_num_removed_vertices;
+    int m_num_removed_halfedges;
+    int m_num_removed_faces;
+}; // class compact_hmesh_t
+
 template <typename V = face_array_t>
 class array_iterator_t : public V::const_iterator {
     const hmesh_t* mesh_ptr;
@@ -475,27 +815,8 @@ public:
     // increment pointer to the next valid element (i.e. we skip removed elements).
     array_iterator_t<V>& operator++()
     {
-        bool cur_elem_is_removed = false;
-        bool reached_end = false;
-        do {
-            V::const_iterator::operator++();
-            reached_end = (*this) == cend<>();
-            cur_elem_is_removed = false;
-
-            if (!reached_end) {
-                const std::size_t diff = ((*this) - cbegin<array_iterator_t<V>>(false));
-                element_descriptor_type raw_descriptor((std::uint32_t)diff); // std::distance(cbegin<array_iterator_t<V>>(false), (*this)); // O(1) ??
-                cur_elem_is_removed = mesh_ptr->is_removed(raw_descriptor);
-                if (!cur_elem_is_removed) {
-                    break;
-                }
-            }
-
-            // keep iterating until the value pointed to after the (++i) operator is a valid element
-            // i.e. one that is not marked removed!
-
-        } while (cur_elem_is_removed && !reached_end);
-
+        V::const_iterator::operator++();
+        skip_removed_elements();
         return (*this);
     }
 
@@ -504,20 +825,7 @@ public:
     array_iterator_t<V>& operator+=(std::ptrdiff_t n)
     {
         V::const_iterator::operator+=(n); // raw ptr shift (i.e. ignoring that there may be removed elements)
-
-        bool cur_elem_is_removed = false;
-        bool reached_end = (*this) == cend<>();
-        cur_elem_is_removed = mesh_ptr->is_removed(*(*this));
-        while (!reached_end && cur_elem_is_removed) {
-            V::const_iterator::operator++(); //++(*this);
-            size_t raw_descriptor = *(*this); // (*this) - cbegin<array_iterator_t<V>>(false); //std::distance(cbegin<array_iterator_t<V>>(false), (*this)); // O(1) ??
-            cur_elem_is_removed = mesh_ptr->is_removed(element_descriptor_type((std::uint32_t)raw_descriptor));
-            if (!cur_elem_is_removed) {
-                break;
-            }
-
-            reached_end = (*this) == cend<>();
-        }
+        skip_removed_elements();
         return *this;
     }
 
@@ -540,6 +848,18 @@ public:
     }
 
 private:
+    // move to the first element that is not removed, starting from the current one
+    void skip_removed_elements()
+    {
+        const std::uint32_t raw_index = (std::uint32_t)((*this) - cbegin<>(false));
+        const std::uint32_t raw_end = (std::uint32_t)(cend<>() - cbegin<>(false));
+
+        if (raw_index < raw_end) {
+            const std::uint32_t next = mesh_ptr->get_removed_elements_bitset(id_<array_iterator_t<V>> {}).find_next_not_removed(raw_index);
+            V::const_iterator::operator+=((std::ptrdiff_t)(std::min(next, raw_end) - raw_index));
+        }
+    }
+
     // postfix increment (i++)
     // NOTE: This overide is private to simplify implementation, and we don't need it
     array_iterator_t<V> operator++(int)
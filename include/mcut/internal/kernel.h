@@ -28,6 +28,7 @@
 #include <mcut/internal/tpool.h>
 #endif
 
+#include <algorithm>
 #include <map>
 #include <unordered_map>
 #include <vector>
@@ -98,6 +99,145 @@ enum class cm_patch_winding_order_t : unsigned char {
     REVERSE, // - : The polygons of the patch have the [opposite] winding order as the cut-surface (e.g. CW)
 };
 
+// A sequence of traced polygons (i.e. sequences of halfedges), where the halfedges of all polygons are stored
+// contiguously (i.e. compressed sparse rows). A polygon is identified by its index, which does not change when other
+// polygons are added or reversed.
+class traced_polygons_t {
+public:
+    // the halfedges of a polygon (T = "hd_t" or "const hd_t")
+    template <typename T>
+    class halfedges_t {
+    public:
+        typedef T* iterator;
+        typedef const hd_t* const_iterator;
+
+        halfedges_t(T* first, T* last)
+            : m_first(first)
+            , m_last(last)
+        {
+        }
+
+        // e.g. from the halfedges of a non-const polygon
+        template <typename U>
+        halfedges_t(const halfedges_t<U>& other)
+            : m_first(other.begin())
+            , m_last(other.end())
+        {
+        }
+
+        T* begin() const { return m_first; }
+        T* end() const { return m_last; }
+        const hd_t* cbegin() const { return m_first; }
+        const hd_t* cend() const { return m_last; }
+        size_t size() const { return (size_t)(m_last - m_first); }
+        bool empty() const { return m_first == m_last; }
+        T& front() const { return *m_first; }
+        T& back() const { return *(m_last - 1); }
+
+        T& operator[](size_t i) const
+        {
+            MCUT_ASSERT(i < size());
+            return m_first[i];
+        }
+
+        T& at(size_t i) const
+        {
+            MCUT_ASSERT(i < size());
+            return m_first[i];
+        }
+
+    private:
+        T* m_first;
+        T* m_last;
+    };
+
+    typedef halfedges_t<hd_t> polygon_t;
+    typedef halfedges_t<const hd_t> const_polygon_t;
+
+    traced_polygons_t()
+        : m_offsets(1, 0)
+    {
+    }
+
+    size_t size() const
+    {
+        return m_offsets.size() - 1;
+    }
+
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+    // total number of halfedges of all polygons
+    size_t number_of_halfedges() const
+    {
+        return m_halfedges.size();
+    }
+
+    void reserve(size_t num_polygons, size_t num_halfedges)
+    {
+        m_offsets.reserve(num_polygons + 1);
+        m_halfedges.reserve(num_halfedges);
+    }
+
+    void clear()
+    {
+        m_offsets.resize(1);
+        m_halfedges.clear();
+    }
+
+    polygon_t operator[](size_t i)
+    {
+        MCUT_ASSERT(i < size());
+        return polygon_t(m_halfedges.data() + m_offsets[i], m_halfedges.data() + m_offsets[i + 1]);
+    }
+
+    const_polygon_t operator[](size_t i) const
+    {
+        MCUT_ASSERT(i < size());
+        return const_polygon_t(m_halfedges.data() + m_offsets[i], m_halfedges.data() + m_offsets[i + 1]);
+    }
+
+    polygon_t at(size_t i) { return (*this)[i]; }
+    const_polygon_t at(size_t i) const { return (*this)[i]; }
+
+    // add a polygon with the halfedges in [first, last)
+    template <typename InputIterator>
+    void push_back(InputIterator first, InputIterator last)
+    {
+        m_halfedges.insert(m_halfedges.end(), first, last);
+        m_offsets.push_back((uint32_t)m_halfedges.size());
+    }
+
+    void push_back(const std::vector<hd_t>& polygon)
+    {
+        push_back(polygon.cbegin(), polygon.cend());
+    }
+
+    // add the polygons of "other" (in order) after our polygons
+    void append(const traced_polygons_t& other)
+    {
+        const uint32_t base_offset = (uint32_t)m_halfedges.size();
+        m_halfedges.insert(m_halfedges.end(), other.m_halfedges.cbegin(), other.m_halfedges.cend());
+        m_offsets.reserve(m_offsets.size() + other.size());
+        for (size_t i = 1; i < other.m_offsets.size(); ++i) {
+            m_offsets.push_back(base_offset + other.m_offsets[i]);
+        }
+    }
+
+    // reverse the order of the halfedges of polygon "i" in place
+    void reverse(size_t i)
+    {
+        MCUT_ASSERT(i < size());
+        std::reverse(m_halfedges.begin() + m_offsets[i], m_halfedges.begin() + m_offsets[i + 1]);
+    }
+
+private:
+    std::vector<uint32_t> m_offsets; // ... of the halfedges of each polygon (size = number of polygons + 1)
+    std::vector<hd_t> m_halfedges;
+};
+
 struct floating_polygon_info_t {
     // normal of polygon
     vec3 polygon_normal;
@@ -112,12 +252,13 @@ struct floating_polygon_info_t {
 struct input_t {
 #if defined(MCUT_MULTI_THREADED)
     thread_pool* scheduler = nullptr;
+    // stages that process fewer elements than this run on the calling thread
+    uint32_t serial_execution_threshold = 0;
 #endif
     const hmesh_t* src_mesh = nullptr;
     const hmesh_t* cut_mesh = nullptr;
-    // NOTE: we use std::map because it is beneficial that keys are sorted when
-    // extracting edge-face intersection pairs
-    const std::map<fd_t, std::vector<fd_t>>* ps_face_to_potentially_intersecting_others = nullptr;
+    // the pairs of polygon-soup faces that are tested for intersection (result of BVH traversal)
+    const candidate_face_pairs_t* ps_face_to_potentially_intersecting_others = nullptr;
 #if defined(USE_OIBVH)
     const std::vector<bounding_box_t<vec3>>* source_hmesh_face_aabb_array_ptr = nullptr;
     const std::vector<bounding_box_t<vec3>>* cut_hmesh_face_aabb_array_ptr = nullptr;
@@ -131,6 +272,8 @@ struct input_t {
     bool populate_vertex_maps = false; // compute data relating vertices in cc to original input mesh
     bool populate_face_maps = false; // compute data relating face in cc to original input mesh
     bool enforce_general_position = false;
+    // resolve the degenerate edge-face intersections by symbolic perturbation of the cut-mesh (instead of reporting them)
+    bool enforce_general_position_symbolically = false;
     // counts how many times we have perturbed the cut-mesh to enforce general-position
     int general_position_enforcement_count = 0;
 
@@ -153,6 +296,17 @@ struct input_t {
     bool keep_fragments_sealed_inside_exhaustive = false; // TODO remove
     bool keep_fragments_sealed_outside_exhaustive = false; // TODO remove
     // NOTE TO SELF: if the user simply wants patches, then kernel should not have to proceed to stitching!!!
+
+    // process only the source-mesh faces near the cut-mesh (see: dispatch_region_of_interest)
+    bool region_of_interest = false;
+    // "src_mesh" is the region of interest of a larger source mesh, whose closedness is given here
+    bool src_mesh_is_region_of_interest = false;
+    bool src_mesh_parent_is_closed = false;
+    // the closedness of the input meshes is given by "src_mesh_is_closed" and "cut_mesh_is_closed" (e.g. as found
+    // by an earlier dispatch that detected a floating polygon, since polygon partitioning does not change it)
+    bool mesh_closedness_is_known = false;
+    bool src_mesh_is_closed = false;
+    bool cut_mesh_is_closed = false;
 };
 
 struct output_mesh_data_maps_t {
@@ -207,11 +361,19 @@ struct output_t {
         // info about floating polygons contained on ps-face
         std::vector<floating_polygon_info_t>>
         detected_floating_polygons;
+
+    // the closedness of the input meshes (see: input_t::mesh_closedness_is_known)
+    bool src_mesh_is_closed = false;
+    bool cut_mesh_is_closed = false;
 };
 
 // internal main
 void dispatch(output_t& out, const input_t& in);
 
+// Dispatch only the region of the source mesh that is near the cut mesh, and then reattach the remaining source-mesh
+// faces to the output. Returns false (without output) if the whole source mesh must be dispatched instead.
+bool dispatch_region_of_interest(output_t& out, const input_t& in);
+
 int find_connected_components(std::vector<int>& fccmap, const hmesh_t& mesh, std::vector<int>& cc_to_vertex_count,
     std::vector<int>& cc_to_face_count);
 
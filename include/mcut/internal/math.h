@@ -28,6 +28,7 @@
 #include <iostream>
 #include <limits>
 #include <memory>
+#include <type_traits>
 
 #include <vector>
 
@@ -65,10 +66,6 @@ public:
     {
     }
 
-    virtual ~vec2_()
-    {
-    }
-
     static vec2_ make(const T x, const T y)
     {
         return vec2_<T>(x, y);
@@ -173,9 +170,6 @@ public:
         , m_z(z)
     {
     }
-    ~vec3_()
-    {
-    }
 
     static int cardinality()
     {
@@ -237,6 +231,10 @@ protected:
 
 typedef vec3_<> vec3;
 
+// vectors are stored in large arrays (e.g. mesh vertices and bounding boxes), which are copied with memcpy
+static_assert(std::is_trivially_copyable<vec2>::value && sizeof(vec2) == 2 * sizeof(double), "vec2 must be a plain pair of doubles");
+static_assert(std::is_trivially_copyable<vec3>::value && sizeof(vec3) == 3 * sizeof(double), "vec3 must be a plain triple of doubles");
+
 template <typename T = int>
 class matrix_t {
 public:
@@ -486,6 +484,12 @@ double orient2d(const vec2& pa, const vec2& pb, const vec2& pc);
 double orient3d(const vec3& pa, const vec3& pb, const vec3& pc,
     const vec3& pd);
 
+// Evaluate "orient3d" for "count" quadruples of points, where quadruple "i" is the points pointed to by
+// "quadruples[4 * i]" to "quadruples[(4 * i) + 3]", and store the results in "results". A SIMD floating-point filter
+// is applied first, and only the quadruples whose error bound it exceeds are evaluated with the adaptive exact
+// predicate. The sign of each result is the same as that of "orient3d".
+void orient3d(double* results, const vec3* const* quadruples, const uint32_t count);
+
 // Compute a polygon's plane coefficients (i.e. normal and d parameters).
 // The computed normal is not normalized. This function returns the largest component of the normal.
 int compute_polygon_plane_coefficients(vec3& normal, double& d_coeff,
@@ -536,6 +540,33 @@ char compute_segment_plane_intersection_type(const vec3& q, const vec3& r,
     const std::vector<vec3>& polygon_vertices,
     const vec3& polygon_normal, const int polygon_normal_largest_component);
 
+// Same as above, but given the results of "orient3d" for the segment endpoints q and r with respect to three
+// non-collinear vertices of the polygon
+char compute_segment_plane_intersection_type(const double& qRes, const double& rRes);
+
+// Symbolic perturbation ("Simulation of Simplicity"): the sign that "orient3d(pa, pb, pc, pd)" takes when it is zero and
+// "pd" is translated by the infinitesimal vector t = (e, e^2, e^3). Returns zero only if "pa", "pb" and "pc" are collinear.
+int orient3d_symbolic_translation_of_d(const vec3& pa, const vec3& pb, const vec3& pc);
+
+// Same as above, but when "pa" and "pb" are translated by t. Returns zero only if the line through "pa" and "pb" is
+// parallel to the line through "pc" and "pd".
+int orient3d_symbolic_translation_of_ab(const vec3& pa, const vec3& pb, const vec3& pc, const vec3& pd);
+
+// Test if the segment 'q'-'r', which crosses the plane of a polygon, passes through the polygon. This is exact (unlike
+// "compute_point_in_polygon_test" on the computed intersection point), and the segment (if "translate_segment" is
+// true) or the polygon is symbolically translated by t when the segment touches an edge or vertex of the polygon.
+//
+// Return values:
+// 'i': the segment passes through the polygon
+// 'o': the segment passes outside the polygon
+char compute_segment_polygon_crossing_type(const vec3& q, const vec3& r, const std::vector<vec3>& polygon_vertices,
+    const bool translate_segment);
+
+// Find three non-collinear vertices "i", "j" and "k" of a polygon (see: "compute_segment_plane_intersection_type").
+// Returns false if all the vertices of the polygon are collinear.
+bool determine_three_noncollinear_vertices(int& i, int& j, int& k, const std::vector<vec3>& polygon_vertices,
+    const vec3& polygon_normal, const int polygon_normal_largest_component);
+
 // Test if a point 'q' (in 2D) lies inside or outside a given polygon (count the number ray crossings).
 //
 // Return values:
@@ -653,6 +684,8 @@ struct bounding_box_t {
     }
 };
 
+static_assert(std::is_trivially_copyable<bounding_box_t<vec3>>::value && sizeof(bounding_box_t<vec3>) == 2 * sizeof(vec3), "bounding box must be a plain pair of vectors");
+
 
 template <typename T>
 inline bool intersect_bounding_boxes(const bounding_box_t<vec3_<T>>& a, const bounding_box_t<vec3_<T>>& b)
@@ -690,6 +723,9 @@ double orient3d(const double* pa, const double* pb, const double* pc, const doub
 double orient3dfast(const double* pa, const double* pb, const double* pc, const double* pd);
 double incircle(const double* pa, const double* pb, const double* pc, const double* pd);
 double insphere(const double* pa, const double* pb, const double* pc, const double* pd, const double* pe);
+int grow_expansion_zeroelim(int elen, double* e, double b, double* h);
+int fast_expansion_sum_zeroelim(int elen, double* e, int flen, double* f, double* h);
+int scale_expansion_zeroelim(int elen, double* e, double b, double* h);
 }
 
 #endif // MCUT_MATH_H_
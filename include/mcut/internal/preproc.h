@@ -38,13 +38,28 @@
 
 #include "mcut/internal/frontend.h"
 
+// build the (validated) halfedge mesh and BVH of a client mesh. The vertex array
+// type is given by "flags" (MC_DISPATCH_VERTEX_ARRAY_...)
+extern "C" void preproc_mesh(
+    std::unique_ptr<context_t>& context_uptr,
+    mesh_t& mesh,
+    McFlags flags,
+    const void* pVertices,
+    const uint32_t* pFaceIndices,
+    const uint32_t* pFaceSizes,
+    uint32_t numVertices,
+    uint32_t numFaces) noexcept(false);
+
+// cut the source mesh (built with "preproc_mesh") with the given cut-mesh arrays.
+// If "source_mesh_is_shared" is true, then "source_mesh" is left unmodified (it
+// is copied before any polygon partitioning is applied to it). The resulting
+// connected components are added to "connected_components".
 extern "C" void preproc(
     std::unique_ptr<context_t>& context_uptr,
-    const void* pSrcMeshVertices,
-    const uint32_t* pSrcMeshFaceIndices,
-    const uint32_t* pSrcMeshFaceSizes,
-    uint32_t numSrcMeshVertices,
-    uint32_t numSrcMeshFaces,
+    std::map<McConnectedComponent, std::unique_ptr<connected_component_t, void (*)(connected_component_t*)>>& connected_components,
+    McFlags dispatchFlags,
+    mesh_t& source_mesh,
+    bool source_mesh_is_shared,
     const void* pCutMeshVertices,
     const uint32_t* pCutMeshFaceIndices,
     const uint32_t* pCutMeshFaceSizes,
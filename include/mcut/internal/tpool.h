@@ -23,14 +23,55 @@
 #ifndef MCUT_SCHEDULER_H_
 #define MCUT_SCHEDULER_H_
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <deque>
+#include <cstdint>
+#include <exception>
 #include <future>
+#include <iterator>
 #include <memory>
 #include <mutex>
 #include <thread>
 #include <vector>
 
+#include "mcut/internal/trace.h"
+
+// how the task that the current thread is about to run was obtained (see: MC_TRACING_ENABLE)
+struct task_origin_t {
+    const char* source = "inline"; // i.e. which queue
+    uint64_t wait_ns = 0; // time spent waiting for the task to be submitted
+};
+
+inline task_origin_t& get_task_origin()
+{
+    static thread_local task_origin_t origin;
+    return origin;
+}
+
+// a task that records its execution in the trace of the thread that submitted it
+template <typename FunctionType>
+struct traced_task {
+    FunctionType f;
+    trace_t* trace;
+
+    typename std::result_of<FunctionType()>::type operator()()
+    {
+        task_origin_t& origin = get_task_origin();
+
+        if (origin.wait_ns != 0) {
+            trace->complete("wait for task", nullptr, trace->now() - origin.wait_ns);
+            origin.wait_ns = 0;
+        }
+
+        // NOTE: the event ends before the result is made available (via the future), after which the trace may no longer exist
+        scoped_trace_t scope(trace, "task", origin.source);
+        return f();
+    }
+};
+
 class function_wrapper {
 private:
     struct impl_base {
@@ -77,8 +118,6 @@ public:
     function_wrapper& operator=(const function_wrapper&) = delete;
 };
 
-extern std::atomic_bool thread_pool_terminate; // mcut.cpp
-
 template <typename T>
 class thread_safe_queue {
 private:
@@ -126,18 +165,18 @@ private:
     // See here: https://developercommunity.visualstudio.com/t/unexpected-warning-c26115-for-returning-a-unique-l/1077322
     _Acquires_lock_(return )
 #endif
-        std::unique_lock<std::mutex> wait_for_data()
+        std::unique_lock<std::mutex> wait_for_data(const std::atomic_bool& terminate)
     {
         std::unique_lock<std::mutex> head_lock(head_mutex);
-        auto until = [&]() { return thread_pool_terminate.load() || head.get() != get_tail(); };
+        auto until = [&]() { return terminate.load() || head.get() != get_tail(); };
         data_cond.wait(head_lock, until);
         return head_lock;
     }
 
-    std::unique_ptr<node> wait_pop_head(T& value)
+    std::unique_ptr<node> wait_pop_head(T& value, const std::atomic_bool& terminate)
     {
-        std::unique_lock<std::mutex> head_lock(wait_for_data());
-        if (thread_pool_terminate.load() == false) {
+        std::unique_lock<std::mutex> head_lock(wait_for_data(terminate));
+        if (terminate.load() == false) {
             value = std::move(*head->data);
             return pop_head();
         } else {
@@ -157,6 +196,11 @@ public:
     void disrupt_wait_for_data()
     {
         // can_wait_for_data.store(false);
+        {
+            // synchronise with a waiting thread that has checked the wait-condition
+            // but is not yet blocked (otherwise the notification could be lost)
+            std::lock_guard<std::mutex> head_lock(head_mutex);
+        }
         data_cond.notify_one();
     }
 
@@ -174,9 +218,10 @@ public:
         data_cond.notify_one();
     }
 
-    void wait_and_pop(T& value)
+    // wait until there is data to pop, or until "terminate" is set (in which case nothing is popped)
+    void wait_and_pop(T& value, const std::atomic_bool& terminate)
     {
-        std::unique_ptr<node> const old_head = wait_pop_head(value);
+        std::unique_ptr<node> const old_head = wait_pop_head(value, terminate);
     }
 
     bool try_pop(T& value)
@@ -211,11 +256,14 @@ public:
 
 class thread_pool {
 
+    // set when the pool is destroyed, to tell the worker threads to exit
+    std::atomic_bool terminate;
+
     std::vector<thread_safe_queue<function_wrapper>> work_queues;
 
-    std::vector<std::thread> threads; // NOTE: must be declared after "thread_pool_terminate" and "work_queues"
+    std::vector<std::thread> threads; // NOTE: must be declared after "terminate" and "work_queues"
     join_threads joiner;
-    unsigned long long round_robin_scheduling_counter;
+    std::atomic<unsigned long long> round_robin_scheduling_counter; // NOTE: tasks may also be submitted from inside other tasks
 
     bool try_pop_from_other_thread_queue(function_wrapper& task, const int worker_thread_id)
     {
@@ -234,9 +282,10 @@ class thread_pool {
 
         do {
             function_wrapper task;
+            task_origin_t& origin = get_task_origin();
 #if 0
-                work_queues[worker_thread_id].wait_and_pop(task);
-                if(thread_pool_terminate) {
+                work_queues[worker_thread_id].wait_and_pop(task, terminate);
+                if(terminate) {
                    break; // finished (i.e. MCUT context was destroyed)
                 }
                 task();
@@ -244,12 +293,21 @@ class thread_pool {
 
             // if I can't pop any task from my queue, and I can't steal a task from
             // another thread's queue, then I'll just wait until is added to my queue.
-            if (!(work_queues[worker_thread_id].try_pop(task) || try_pop_from_other_thread_queue(task, worker_thread_id))) {
-                work_queues[worker_thread_id].wait_and_pop(task);
+            if (work_queues[worker_thread_id].try_pop(task)) {
+                origin.source = "local queue";
+                origin.wait_ns = 0;
+            } else if (try_pop_from_other_thread_queue(task, worker_thread_id)) {
+                origin.source = "stolen";
+                origin.wait_ns = 0;
+            } else {
+                const std::chrono::time_point<std::chrono::steady_clock> wait_start = std::chrono::steady_clock::now();
+                work_queues[worker_thread_id].wait_and_pop(task, terminate);
+                origin.wait_ns = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - wait_start).count();
+                origin.source = "local queue";
             }
 
-            if (thread_pool_terminate) {
-                break; // finished (i.e. MCUT context was destroyed)
+            if (terminate) {
+                break; // finished (i.e. the pool is being destroyed)
             }
 
             task(); // run the task
@@ -258,15 +316,13 @@ class thread_pool {
     }
 
 public:
-    thread_pool()
-        : // thread_pool_terminate(false),
-
-        joiner(threads)
+    // create a pool with "thread_count" worker threads. A pool without worker threads
+    // is valid, and runs each submitted task on the submitting thread.
+    explicit thread_pool(unsigned int thread_count)
+        : terminate(false)
+        , joiner(threads)
         , round_robin_scheduling_counter(0)
     {
-        unsigned int const thread_count = std::thread::hardware_concurrency();
-        thread_pool_terminate.store(false);
-
         try {
 
             work_queues = std::vector<thread_safe_queue<function_wrapper>>(
@@ -277,7 +333,7 @@ public:
                 threads.push_back(std::thread(&thread_pool::worker_thread, this, i));
             }
         } catch (...) {
-            thread_pool_terminate = true;
+            terminate = true;
             wakeup_and_shutdown();
             throw;
         }
@@ -285,7 +341,7 @@ public:
 
     ~thread_pool()
     {
-        thread_pool_terminate.store(true);
+        terminate.store(true);
         wakeup_and_shutdown();
     }
 
@@ -310,9 +366,24 @@ public:
     {
         typedef typename std::result_of<FunctionType()>::type result_type;
 
-        std::packaged_task<result_type()> task(std::move(f));
+        std::packaged_task<result_type()> task;
+
+        if (g_trace != nullptr) {
+            traced_task<FunctionType> t = { std::move(f), g_trace };
+            task = std::packaged_task<result_type()>(std::move(t));
+        } else {
+            task = std::packaged_task<result_type()>(std::move(f));
+        }
+
         std::future<result_type> res(task.get_future());
 
+        if (get_num_threads() == 0) {
+            get_task_origin().source = "inline";
+            get_task_origin().wait_ns = 0;
+            task(); // single-threaded pool
+            return res;
+        }
+
         unsigned long long worker_thread_id = (round_robin_scheduling_counter++) % (unsigned long long)get_num_threads();
 
         // printf("[MCUT]: submit to thread %d\n", (int)worker_thread_id);
@@ -328,9 +399,110 @@ public:
     }
 };
 
+// A set of tasks that are submitted to a pool, and then waited for, together (e.g. the blocks of a fork-join).
+//
+// The tasks are kept in a queue of the group, and for each one the pool is given a proxy task that runs the next
+// task of the group (if it has not been run yet). The thread that waits for the group runs the tasks of the group
+// that are still queued, and then blocks on those that other threads are running. The calling thread may itself be a
+// worker of the pool (nested parallelism), in which case this is what prevents deadlock. Since the waiting thread only
+// ever runs tasks of its own group, a short fork-join never waits behind unrelated work (e.g. a whole dispatch call of
+// another context) and nesting is bounded by that of the fork-joins themselves.
+class task_group {
+    struct state_t {
+        std::mutex mutex;
+        std::deque<function_wrapper> tasks;
+    };
+
+    thread_pool& m_pool;
+    // NOTE: shared with the proxy tasks, which may run after the group is destroyed
+    std::shared_ptr<state_t> m_state;
+
+    static bool run_pending_task(state_t& state)
+    {
+        function_wrapper task;
+
+        {
+            std::lock_guard<std::mutex> lock(state.mutex);
+
+            if (state.tasks.empty()) {
+                return false; // i.e. all tasks have been run, or are running
+            }
+
+            task = std::move(state.tasks.front());
+            state.tasks.pop_front();
+        }
+
+        task();
+        return true;
+    }
+
+public:
+    explicit task_group(thread_pool& pool)
+        : m_pool(pool)
+        , m_state(std::make_shared<state_t>())
+    {
+    }
+
+    task_group(const task_group&) = delete;
+    task_group& operator=(const task_group&) = delete;
+
+    template <typename FunctionType>
+    std::future<typename std::result_of<FunctionType()>::type> submit(FunctionType f)
+    {
+        typedef typename std::result_of<FunctionType()>::type result_type;
+
+        if (m_pool.get_num_threads() == 0) {
+            return m_pool.submit(std::move(f)); // i.e. runs the task immediately
+        }
+
+        std::packaged_task<result_type()> task;
+
+        if (g_trace != nullptr) {
+            traced_task<FunctionType> t = { std::move(f), g_trace };
+            task = std::packaged_task<result_type()>(std::move(t));
+        } else {
+            task = std::packaged_task<result_type()>(std::move(f));
+        }
+
+        std::future<result_type> res(task.get_future());
+
+        {
+            std::lock_guard<std::mutex> lock(m_state->mutex);
+            m_state->tasks.push_back(std::move(task));
+        }
+
+        // NOTE: the proxy is not traced since it may outlive the group (and so the trace), whereas the task is
+        // traced since it is waited for
+        scoped_trace_t trace_scope(nullptr, nullptr);
+        std::shared_ptr<state_t> state = m_state;
+        m_pool.submit([state]() { run_pending_task(*state); });
+
+        return res;
+    }
+
+    // wait for the given futures of tasks of this group
+    template <typename ResultType>
+    void wait(std::vector<std::future<ResultType>>& futures)
+    {
+        task_origin_t& origin = get_task_origin();
+
+        do {
+            origin.source = "helping";
+            origin.wait_ns = 0;
+        } while (run_pending_task(*m_state));
+
+        for (typename std::vector<std::future<ResultType>>::iterator f = futures.begin(); f != futures.end(); ++f) {
+            f->wait(); // i.e. running on another thread
+        }
+    }
+};
+
 template <typename InputStorageIteratorType, typename OutputStorageType, typename FunctionType>
 void parallel_fork_and_join(
     thread_pool& pool,
+    // ranges with fewer elements than this are processed by the master thread alone,
+    // since the cost of forking would outweigh the gain (zero means always fork)
+    uint32_t const serial_execution_threshold,
     // start of data elements to be processed in parallel
     const InputStorageIteratorType& first,
     // end of of data elements to be processed in parallel (e.g. std::map::end())
@@ -348,6 +520,13 @@ void parallel_fork_and_join(
 {
 
     typename InputStorageIteratorType::difference_type const length = std::distance(first, last);
+
+    if (pool.get_num_threads() == 0 || length < (typename InputStorageIteratorType::difference_type)serial_execution_threshold) {
+        futures.clear();
+        master_thread_output = task_func(first, last);
+        return;
+    }
+
     typename InputStorageIteratorType::difference_type const block_size = std::min(block_size_default, length);
     typename InputStorageIteratorType::difference_type const num_blocks = (length + block_size - 1) / block_size;
 
@@ -355,12 +534,13 @@ void parallel_fork_and_join(
 
     futures.resize(num_blocks - 1);
     InputStorageIteratorType block_start = first;
+    task_group group(pool);
 
     for (typename InputStorageIteratorType::difference_type i = 0; i < (num_blocks - 1); ++i) {
         InputStorageIteratorType block_end = block_start;
         std::advance(block_end, block_size);
 
-        futures[i] = pool.submit(
+        futures[i] = group.submit(
             [&, block_start, block_end]() -> OutputStorageType {
                 return task_func(block_start, block_end);
             });
@@ -368,7 +548,80 @@ void parallel_fork_and_join(
         block_start = block_end;
     }
 
-    master_thread_output = task_func(block_start, last);
+    std::exception_ptr master_thread_exception;
+
+    try {
+        master_thread_output = task_func(block_start, last);
+    } catch (...) {
+        // the other blocks must still be waited for since they reference "task_func"
+        master_thread_exception = std::current_exception();
+    }
+
+    group.wait(futures);
+
+    if (master_thread_exception) {
+        std::rethrow_exception(master_thread_exception);
+    }
+}
+
+// Sort the range [first, last) by sorting one block per thread in parallel, and then merging
+// neighbouring blocks pairwise (in parallel) until the whole range is sorted.
+template <typename RandomAccessIteratorType, typename CompareType>
+void parallel_sort(
+    thread_pool& pool,
+    // ranges with fewer elements than this are sorted by the calling thread alone
+    uint32_t const serial_execution_threshold,
+    const RandomAccessIteratorType& first,
+    const RandomAccessIteratorType& last,
+    CompareType comp)
+{
+    typedef typename std::iterator_traits<RandomAccessIteratorType>::difference_type difference_type;
+
+    difference_type const length = last - first;
+
+    if (pool.get_num_threads() == 0 || length < (difference_type)serial_execution_threshold) {
+        std::sort(first, last, comp);
+        return;
+    }
+
+    difference_type const num_blocks = (difference_type)pool.get_num_threads() + 1; // i.e. including the calling thread
+    difference_type const block_size = (length + num_blocks - 1) / num_blocks;
+
+    std::vector<std::future<void>> futures;
+    task_group group(pool);
+
+    for (difference_type block_start = block_size; block_start < length; block_start += block_size) {
+        RandomAccessIteratorType const block_first = first + block_start;
+        RandomAccessIteratorType const block_last = first + std::min(block_start + block_size, length);
+
+        futures.push_back(group.submit([=]() { std::sort(block_first, block_last, comp); }));
+    }
+
+    std::sort(first, first + std::min(block_size, length), comp);
+
+    group.wait(futures);
+
+    for (std::vector<std::future<void>>::iterator f = futures.begin(); f != futures.end(); ++f) {
+        f->get(); // i.e. rethrow
+    }
+
+    for (difference_type width = block_size; width < length; width *= 2) {
+        futures.clear();
+
+        for (difference_type merge_start = 0; merge_start + width < length; merge_start += 2 * width) {
+            RandomAccessIteratorType const merge_first = first + merge_start;
+            RandomAccessIteratorType const merge_middle = merge_first + width;
+            RandomAccessIteratorType const merge_last = first + std::min(merge_start + 2 * width, length);
+
+            futures.push_back(group.submit([=]() { std::inplace_merge(merge_first, merge_middle, merge_last, comp); }));
+        }
+
+        group.wait(futures);
+
+        for (std::vector<std::future<void>>::iterator f = futures.begin(); f != futures.end(); ++f) {
+            f->get();
+        }
+    }
 }
 
 #endif // MCUT_SCHEDULER_H_
\ No newline at end of file
@@ -0,0 +1,163 @@
+/**
+ * Copyright (c) 2021-2022 Floyd M. Chitalu.
+ * All rights reserved.
+ *
+ * NOTE: This file is licensed under GPL-3.0-or-later (default).
+ * A commercial license can be purchased from Floyd M. Chitalu.
+ *
+ * License details:
+ *
+ * (A)  GNU General Public License ("GPL"); a copy of which you should have
+ *      recieved with this file.
+ * 	    - see also: <http://www.gnu.org/licenses/>
+ * (B)  Commercial license.
+ *      - email: floyd.m.chitalu@gmail.com
+ *
+ * The commercial license options is for users that wish to use MCUT in
+ * their products for comercial purposes but do not wish to release their
+ * software products under the GPL license.
+ *
+ * Author(s)     : Floyd M. Chitalu
+ */
+
+#ifndef MCUT_TRACE_H_
+#define MCUT_TRACE_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// A timeline of the work done for a context, which is exported in the Chrome trace
+// event format (see: MC_TRACING_ENABLE). Events are recorded into per-thread buffers
+// that are only ever written by their thread, so recording does not take any locks.
+
+struct trace_event_t {
+    const char* name; // NOTE: string literal
+    // optional detail, which is exported as an argument of the event (string literal or NULL)
+    const char* detail;
+    // 'B' (begin), 'E' (end) or 'X' (complete i.e. with a duration)
+    char phase;
+    uint64_t timestamp_ns; // relative to the creation of the trace
+    uint64_t duration_ns;
+};
+
+class trace_buffer_t {
+public:
+    static const uint32_t chunk_size = 1 << 12; // events
+    static const uint32_t max_chunks = 1 << 8;
+
+private:
+    // NOTE: chunks are never reallocated, which is what allows the exporting thread to read
+    // the events that have been recorded while the recording thread adds more
+    std::atomic<trace_event_t*> chunks[max_chunks];
+    std::atomic<uint32_t> num_events;
+    std::atomic<uint32_t> num_dropped_events;
+
+public:
+    // the (export) id of the thread that records into this buffer
+    const uint32_t thread_index;
+    // the thread that records into this buffer
+    const std::thread::id thread_id;
+    // number of "B" events without a matching "E" event
+    uint32_t depth;
+
+    trace_buffer_t(uint32_t thread_index_, std::thread::id thread_id_);
+    ~trace_buffer_t();
+
+    trace_buffer_t(const trace_buffer_t&) = delete;
+    trace_buffer_t& operator=(const trace_buffer_t&) = delete;
+
+    // called by the recording thread only
+    void record(const trace_event_t& event);
+
+    // safe to call from any thread
+    uint32_t get_num_events() const;
+    const trace_event_t& get_event(uint32_t index) const;
+    uint32_t get_num_dropped_events() const;
+};
+
+class trace_t {
+    // unique (over the lifetime of the process) id, with which threads find their buffer
+    const uint64_t m_id;
+    const std::chrono::time_point<std::chrono::steady_clock> m_epoch;
+
+    // guards "m_buffers" i.e. registration of a new thread, and exporting
+    mutable std::mutex m_buffers_mutex;
+    std::vector<std::unique_ptr<trace_buffer_t>> m_buffers;
+
+    trace_buffer_t& get_thread_buffer();
+
+public:
+    trace_t();
+
+    uint64_t now() const;
+
+    void begin(const char* name, const char* detail = nullptr);
+    void end();
+    // end the events that are still open above the given nesting level on the calling thread (e.g. after a function
+    // returned early from within a stage)
+    void end_all(uint32_t depth);
+    uint32_t get_depth();
+    // record an event that started at "start" (see: now()) and has just finished
+    void complete(const char* name, const char* detail, uint64_t start);
+
+    // the trace in Chrome trace event (JSON) format
+    std::string to_json() const;
+};
+
+// the trace to which the current thread records events, or NULL if tracing is disabled
+extern thread_local trace_t* g_trace;
+
+// Make "trace" the trace of the calling thread until the end of the enclosing scope, in which the
+// event "name" (if not NULL) is recorded.
+class scoped_trace_t {
+    trace_t* const m_outer_trace;
+    const char* const m_name;
+    uint32_t m_depth;
+
+public:
+    scoped_trace_t(trace_t* trace, const char* name, const char* detail = nullptr)
+        : m_outer_trace(g_trace)
+        , m_name(name)
+        , m_depth(0)
+    {
+        g_trace = trace;
+
+        if (g_trace != nullptr && m_name != nullptr) {
+            m_depth = g_trace->get_depth();
+            g_trace->begin(m_name, detail);
+        }
+    }
+
+    ~scoped_trace_t()
+    {
+        if (g_trace != nullptr && m_name != nullptr) {
+            g_trace->end_all(m_depth); // NOTE: also ends the events that were left open e.g. due to an exception
+        }
+
+        g_trace = m_outer_trace;
+    }
+
+    scoped_trace_t(const scoped_trace_t&) = delete;
+    scoped_trace_t& operator=(const scoped_trace_t&) = delete;
+};
+
+#define TRACE_BEGIN(name)              \
+    do {                               \
+        if (g_trace != nullptr) {      \
+            g_trace->begin(name);      \
+        }                              \
+    } while (0)
+#define TRACE_END()               \
+    do {                          \
+        if (g_trace != nullptr) { \
+            g_trace->end();       \
+        }                         \
+    } while (0)
+
+#endif // MCUT_TRACE_H_
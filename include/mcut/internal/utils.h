@@ -83,9 +83,16 @@ typedef char couldnt_parse_cxx_standard[-1]; ///< Error: couldn't parse standard
 #define DEBUG_CODE_MASK(code) // do nothing
 #endif                        // #if defined(MCUT_DEBUG_BUILD)
 
+#include "mcut/internal/trace.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <sstream>
+#include <vector>
 
 #if MCUT_BUILD_WINDOWS
 #define EXCEPTION_THROWN throw()
@@ -109,10 +116,16 @@ typedef char couldnt_parse_cxx_standard[-1]; ///< Error: couldn't parse standard
 #include <stack>
 #include <memory>
 
-#define TIMESTACK_PUSH(name) \
-    g_timestack.push(std::unique_ptr<mini_timer>(new mini_timer(name)))
-#define TIMESTACK_POP() \
-    g_timestack.pop()
+#define TIMESTACK_PUSH(name)                                                 \
+    do {                                                                     \
+        g_timestack.push(std::unique_ptr<mini_timer>(new mini_timer(name))); \
+        DISPATCH_STATS_PUSH(name);                                           \
+    } while (0)
+#define TIMESTACK_POP()         \
+    do {                        \
+        g_timestack.pop();      \
+        DISPATCH_STATS_POP();   \
+    } while (0)
 #define TIMESTACK_RESET()                       \
     while (!g_timestack.empty())          \
     {                                           \
@@ -125,11 +138,28 @@ typedef char couldnt_parse_cxx_standard[-1]; ///< Error: couldn't parse standard
 
 #else
 #define SCOPED_TIMER(name)
-#define TIMESTACK_PUSH(name) 
-#define TIMESTACK_POP()
+// named stages are also timed at runtime when the dispatch statistics are collected (see: MC_PROFILING_ENABLE)
+#define TIMESTACK_PUSH(name) DISPATCH_STATS_PUSH(name)
+#define TIMESTACK_POP() DISPATCH_STATS_POP()
 #define TIMESTACK_RESET()
 #endif
 
+// named stages are also recorded in the timeline of the dispatch when tracing (see: MC_TRACING_ENABLE)
+#define DISPATCH_STATS_PUSH(name)                \
+    do {                                         \
+        if (g_dispatch_stats != nullptr) {       \
+            g_dispatch_stats->push_stage(name);  \
+        }                                        \
+        TRACE_BEGIN(name);                       \
+    } while (0)
+#define DISPATCH_STATS_POP()                \
+    do {                                    \
+        if (g_dispatch_stats != nullptr) {  \
+            g_dispatch_stats->pop_stage();  \
+        }                                   \
+        TRACE_END();                        \
+    } while (0)
+
 static inline int wrap_integer(int x, const int lo, const int hi)
 {
     const int range_size = hi - lo + 1;
@@ -169,6 +199,78 @@ static inline int wrap_integer(int x, const int lo, const int hi)
         }
     };
 #endif
+
+    // performance statistics of one dispatch call
+    struct dispatch_stats_t {
+        struct stage_t {
+            const char* name; // NOTE: string literal
+            uint64_t duration_ns; // summed over all executions of the stage
+            uint32_t call_count;
+            uint32_t depth; // nesting level (at first execution)
+        };
+
+        // in the order of their first execution
+        std::vector<stage_t> stages;
+        // index of the stage in "stages", and its start time
+        std::vector<std::pair<uint32_t, std::chrono::time_point<std::chrono::steady_clock>>> running_stages;
+
+        uint64_t total_duration_ns = 0;
+        // number of times the cut mesh was perturbed to enforce general position
+        uint32_t perturbation_count = 0;
+        // number of times the kernel was restarted after partitioning a floating polygon
+        uint32_t floating_polygon_restart_count = 0;
+        // number of source-mesh/cut-mesh polygon pairs whose bounding boxes overlap
+        uint64_t bvh_candidate_pair_count = 0;
+        uint32_t peak_vertex_count = 0;
+        uint32_t peak_edge_count = 0;
+        uint32_t peak_face_count = 0;
+
+        void push_stage(const char* name)
+        {
+            uint32_t i = 0;
+            // NOTE: few stages (and same names are typically the same literal)
+            while (i < (uint32_t)stages.size() && stages[i].name != name && std::strcmp(stages[i].name, name) != 0) {
+                ++i;
+            }
+
+            if (i == (uint32_t)stages.size()) {
+                const stage_t stage = { name, 0, 0, (uint32_t)running_stages.size() };
+                stages.push_back(stage);
+            }
+
+            running_stages.emplace_back(i, std::chrono::steady_clock::now());
+        }
+
+        void pop_stage()
+        {
+            if (running_stages.empty()) {
+                return; // i.e. stage was started before statistics collection began
+            }
+
+            stage_t& stage = stages[running_stages.back().first];
+            stage.duration_ns += (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - running_stages.back().second).count();
+            stage.call_count++;
+
+            running_stages.pop_back();
+        }
+
+        // end the stages that are still running above the given nesting level (e.g. after
+        // a function returned early from within a stage)
+        void pop_stages(uint32_t depth)
+        {
+            while ((uint32_t)running_stages.size() > depth) {
+                pop_stage();
+            }
+        }
+
+        void update_peak_element_counts(uint32_t num_vertices, uint32_t num_edges, uint32_t num_faces)
+        {
+            peak_vertex_count = std::max(peak_vertex_count, num_vertices);
+            peak_edge_count = std::max(peak_edge_count, num_edges);
+            peak_face_count = std::max(peak_face_count, num_faces);
+        }
+    };
+
     class logger_t
     {
 
@@ -300,8 +402,12 @@ static inline int wrap_integer(int x, const int lo, const int hi)
     }
 
 #if defined(PROFILING_BUILD)
-    extern std::stack<std::unique_ptr<mini_timer>> g_timestack;
+    extern thread_local std::stack<std::unique_ptr<mini_timer>> g_timestack;
 #endif // #if defined(PROFILING_BUILD)
 
+    // statistics of the dispatch call that is running on the current thread, or NULL
+    // if statistics are not being collected
+    extern thread_local dispatch_stats_t* g_dispatch_stats;
+
 
 #endif // MCUT_UTILS_H_
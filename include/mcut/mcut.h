@@ -88,6 +88,20 @@ typedef struct McConnectedComponent_T* McConnectedComponent;
  */
 typedef struct McContext_T* McContext;
 
+/**
+ * @brief Mesh handle.
+ *
+ * Opaque type referencing an input mesh whose internal representation (halfedge data structure and bounding volume hierarchy) is built once and then re-used across dispatch calls.
+ */
+typedef struct McMesh_T* McMesh;
+
+/**
+ * @brief Event handle.
+ *
+ * Opaque object representing the execution of an asynchronous dispatch call (see ::mcEnqueueDispatch).
+ */
+typedef struct McEvent_T* McEvent;
+
 /**
  * @brief Bitfield type.
  *
@@ -286,6 +300,9 @@ typedef enum McDebugSeverity {
  */
 typedef enum McContextCreationFlags {
     MC_DEBUG = (1 << 0), /**< Enable debug mode (message logging etc.).*/
+    MC_CONTEXT_SHARED_THREAD_POOL = (1 << 1), /**< Use the process-wide thread pool, which is shared by all contexts created with this flag, instead of creating threads for the context. The shared thread pool has one thread per hardware thread. It is created with the first context that uses it, and destroyed when the last such context is released.*/
+    MC_PROFILING_ENABLE = (1 << 2), /**< Collect performance statistics of each dispatch call, which can then be queried with ::MC_CONTEXT_DISPATCH_STATS and ::MC_CONTEXT_DISPATCH_STAGE_TIMES.*/
+    MC_TRACING_ENABLE = (1 << 3), /**< Record a timeline of the work done by the context (API calls, dispatch stages and helper-thread tasks) in the Chrome trace event format, which can be viewed with e.g. chrome://tracing or Perfetto. The trace is queried with ::MC_CONTEXT_TRACE, or written to the file set with ::MC_CONTEXT_TRACE_FILE.*/
 } McContextCreationFlags;
 
 /**
@@ -341,7 +358,28 @@ typedef enum McDispatchFlags {
         the result for the perturbed input will hopefully still be useful.  This is justified by the fact that
         the task of MCUT is not to decide whether the input is in general position but rather to make perturbation
         on the input (if) necessary within the available precision of the computing device. */
-    MC_DISPATCH_ENFORCE_GENERAL_POSITION = (1 << 15) 
+    MC_DISPATCH_ENFORCE_GENERAL_POSITION = (1 << 15), 
+    /**
+     * Only process the source-mesh polygons that are near the cut-mesh (i.e. those that may intersect it, and their
+     neighbours). The remaining source-mesh polygons are then added back to the output connected components. This is
+     intended for a large source-mesh that is cut in a small region of its surface. MCUT falls back to processing the
+     whole source-mesh when the region cannot be separated from the rest (e.g. because the source-mesh is mostly cut).
+     The output connected components are the same, but the order of their vertices and faces may differ. */
+    MC_DISPATCH_REGION_OF_INTEREST = (1 << 16),
+    /**
+     * Build a 4-wide bounding volume hierarchy (BVH) of the source-mesh using the surface area heuristic, instead of
+     the default binary BVH. The wide BVH takes longer to build but is faster to search for the polygons that may
+     intersect the cut-mesh, which pays off when the source-mesh is large and is cut many times (i.e. when this flag is
+     given to ::mcCreateMesh). The output connected components are the same. */
+    MC_DISPATCH_WIDE_BVH = (1 << 17),
+    /**
+     * Resolve the cases where the inputs are not in general position by symbolic perturbation ("Simulation of
+     Simplicity") instead of numerical perturbation. The cut-mesh is treated as if it was translated by an infinitesimal
+     vector, which decides (exactly) whether an edge that touches a polygon at a vertex or edge, or lies in its plane,
+     passes through it. Thus, such inputs are cut in one pass and the cut-mesh is not moved, but the output may contain
+     coincident vertices (e.g. where a cut-mesh vertex lies on a source-mesh polygon). The remaining degenerate cases
+     (if any) are handled by numerical perturbation if ::MC_DISPATCH_ENFORCE_GENERAL_POSITION is also set. */
+    MC_DISPATCH_ENFORCE_GENERAL_POSITION_SYMBOLICALLY = (1 << 18)
 } McDispatchFlags;
 
 /**
@@ -352,9 +390,81 @@ typedef enum McDispatchFlags {
  */
 typedef enum McQueryFlags {
     MC_CONTEXT_FLAGS = 1 << 0, /**< Flags used to create a context.*/
-    MC_DONT_CARE = 1 << 1 /**< wildcard.*/
+    MC_DONT_CARE = 1 << 1, /**< wildcard.*/
+    MC_CONTEXT_SERIAL_EXECUTION_THRESHOLD = 1 << 2, /**< Parallel stages of a dispatch call that would process fewer elements (e.g. faces) than this number are executed by a single thread (type uint32_t, default 512). Zero means that stages are always parallelised. Can be set with ::mcSetContextProperty.*/
+    MC_CONTEXT_HELPER_THREAD_COUNT = 1 << 3, /**< Number of helper threads used by a context (type uint32_t). Zero means that all work is done on the calling thread.*/
+    MC_CONTEXT_DISPATCH_STATS = 1 << 4, /**< Performance statistics of the most recently completed dispatch call (type ::McDispatchStats). Requires ::MC_PROFILING_ENABLE.*/
+    MC_CONTEXT_DISPATCH_STAGE_TIMES = 1 << 5, /**< Wall time of each named stage of the most recently completed dispatch call (array of type ::McDispatchStageTime, in the order in which the stages first ran). Requires ::MC_PROFILING_ENABLE.*/
+    MC_CONTEXT_TRACE = 1 << 6, /**< Trace of all the work done by the context so far, as JSON text in the Chrome trace event format (null-terminated array of type char). Requires ::MC_TRACING_ENABLE.*/
+    MC_CONTEXT_TRACE_FILE = 1 << 7 /**< Path of the file to which the trace is written when the context is released (null-terminated array of type char). Can only be set with ::mcSetContextProperty. Requires ::MC_TRACING_ENABLE.*/
 } McQueryFlags;
 
+/**
+ * \struct McDispatchStats
+ * @brief Performance statistics of a dispatch call.
+ *
+ * These statistics describe the most recently completed dispatch call of a context that was created with ::MC_PROFILING_ENABLE (for ::mcDispatchBatch, each cut mesh counts as one dispatch call). They are queried with ::MC_CONTEXT_DISPATCH_STATS.
+ */
+typedef struct McDispatchStats {
+    uint64_t totalTimeNanoseconds; /**< Wall time of the dispatch call.*/
+    uint32_t perturbationCount; /**< Number of times that the cut mesh was perturbed to enforce general position (see ::MC_DISPATCH_ENFORCE_GENERAL_POSITION).*/
+    uint32_t floatingPolygonRestartCount; /**< Number of times that the intersection was recomputed after partitioning a floating polygon.*/
+    uint64_t bvhCandidatePairCount; /**< Number of source-mesh and cut-mesh polygon pairs with overlapping bounding boxes, which are then tested for intersection.*/
+    uint32_t peakVertexCount; /**< Largest number of vertices in an intermediate mesh.*/
+    uint32_t peakEdgeCount; /**< Largest number of edges in an intermediate mesh.*/
+    uint32_t peakFaceCount; /**< Largest number of faces in an intermediate mesh.*/
+    uint32_t stageCount; /**< Number of ::McDispatchStageTime records that are available with ::MC_CONTEXT_DISPATCH_STAGE_TIMES.*/
+} McDispatchStats;
+
+/**
+ * \struct McDispatchStageTime
+ * @brief Wall time of one named stage of a dispatch call.
+ *
+ * Stages can be nested, in which case the time of a stage includes that of the stages that it contains.
+ */
+typedef struct McDispatchStageTime {
+    char name[64]; /**< Name of the stage e.g. "Calculate intersection points (edge-to-face)" (null-terminated).*/
+    uint64_t durationNanoseconds; /**< Wall time of the stage, summed over all of its executions.*/
+    uint32_t callCount; /**< Number of times that the stage was executed (e.g. more than once if the intersection was recomputed).*/
+    uint32_t depth; /**< Nesting level of the stage, where zero is the outermost level.*/
+} McDispatchStageTime;
+
+/**
+ * \enum McEventInfo
+ * @brief Information that can be queried about an event.
+ *
+ * This enum structure defines the different types of information that can be queried about an event with ::mcGetEventInfo.
+ */
+typedef enum McEventInfo {
+    MC_EVENT_COMMAND_EXECUTION_STATUS = 1 << 0, /**< The execution status of the dispatch call (See also: ::McEventCommandExecStatus). */
+    MC_EVENT_RUNTIME_EXECUTION_STATUS = 1 << 1, /**< The error code (::McResult) of the dispatch call. This is ::MC_NO_ERROR while the dispatch call has not completed. */
+    MC_EVENT_TIMESTAMP_SUBMIT = 1 << 2, /**< A 64-bit value (nanoseconds) of a monotonic clock at the time the dispatch call was enqueued. */
+    MC_EVENT_TIMESTAMP_START = 1 << 3, /**< A 64-bit value (nanoseconds) of a monotonic clock at the time the dispatch call started executing (zero if not yet started). */
+    MC_EVENT_TIMESTAMP_END = 1 << 4 /**< A 64-bit value (nanoseconds) of a monotonic clock at the time the dispatch call finished executing (zero if not yet finished). */
+} McEventInfo;
+
+/**
+ * \enum McEventCommandExecStatus
+ * @brief The execution status of the dispatch call associated with an event.
+ *
+ * This enum structure defines the states in which an asynchronous dispatch call can be.
+ */
+typedef enum McEventCommandExecStatus {
+    MC_SUBMITTED = 1 << 0, /**< The dispatch call has been enqueued but has not started executing. */
+    MC_RUNNING = 1 << 1, /**< The dispatch call is executing. */
+    MC_COMPLETE = 1 << 2 /**< The dispatch call has finished executing (successfully or otherwise). */
+} McEventCommandExecStatus;
+
+/**
+ *  
+ * @brief Event callback function signature type.
+ *
+ * The callback function should have this prototype (in C), or be otherwise compatible with such a prototype.
+ */
+typedef void (MCAPI_PTR *pfn_McEvent_CALLBACK)(
+    McEvent event,
+    void* data);
+
 /**
  *  
  * @brief Debug callback function signature type.
@@ -374,6 +484,11 @@ typedef void (MCAPI_PTR *pfn_mcDebugOutput_CALLBACK)(
 *
 * This method creates a context object, which is a handle used by a client application to control the API state and access data.
 * 
+* Contexts are independent of each other. API functions may be called concurrently from different threads 
+* as long as each thread uses a different context (e.g. one context per thread). This includes creating and 
+* releasing contexts while other contexts are in use. Calling API functions concurrently on the same context 
+* is not supported, except for the functions that are documented otherwise (see ::mcEnqueueDispatch).
+*
 * @param [out] pContext a pointer to the allocated context handle
 * @param [in] flags bitfield containing the context creation flags
 *
@@ -400,6 +515,45 @@ typedef void (MCAPI_PTR *pfn_mcDebugOutput_CALLBACK)(
 extern MCAPI_ATTR McResult MCAPI_CALL mcCreateContext(
     McContext* pContext, McFlags flags);
 
+/** @brief Create an MCUT context with a given number of helper threads.
+*
+* This method is equivalent to ::mcCreateContext except that the number of threads that the context 
+* creates for its work (i.e. its thread pool) is specified by the client. ::mcCreateContext creates 
+* one helper thread per hardware thread. When multiple contexts are in use at the same time, 
+* a smaller number of helper threads per context, or ::MC_CONTEXT_SHARED_THREAD_POOL, avoids 
+* creating more threads than there are hardware threads. 
+* 
+* A context with zero helper threads is single-threaded: all of its work is done on the thread that calls the API,
+* which avoids the overhead of scheduling work when the input meshes are small. In this case, ::mcEnqueueDispatch 
+* returns only after the dispatch has completed.
+* 
+* @param [out] pContext a pointer to the allocated context handle
+* @param [in] flags bitfield containing the context creation flags
+* @param [in] helperThreadCount the number of helper threads to create. No threads are created if \p flags contains ::MC_CONTEXT_SHARED_THREAD_POOL (in which case \p helperThreadCount is ignored), or if MCUT is built without multi-threading.
+*
+ * An example of usage:
+ * @code
+ * McContext myContext = MC_NULL_HANDLE;
+ * McResult err = mcCreateContextWithHelpers(&myContext, MC_NULL_HANDLE, 2);
+ * if(err != MC_NO_ERROR)
+ * {
+ *  // deal with error
+ * }
+ * @endcode
+*
+* @return Error code.
+* 
+* <b>Error codes</b> 
+* - MC_NO_ERROR  
+*   -# proper exit 
+* - MC_INVALID_VALUE 
+*   -# \p pContext is NULL
+*   -# Failure to allocate resources
+*   -# \p flags defines an invalid bitfield.
+*/
+extern MCAPI_ATTR McResult MCAPI_CALL mcCreateContextWithHelpers(
+    McContext* pContext, McFlags flags, uint32_t helperThreadCount);
+
 /** @brief Specify a callback to receive debugging messages from the MCUT library.
 *
 * ::mcDebugMessageCallback sets the current debug output callback function to the function whose address is
@@ -575,7 +729,7 @@ extern MCAPI_ATTR McResult MCAPI_CALL mcDebugMessageControl(
 *   -# \p pCutMeshFaceSizes is NULL.
 *   -# \p numCutMeshVertices is less than three.
 *   -# \p numCutMeshFaces is less than one.
-*   -# ::MC_DISPATCH_ENFORCE_GENERAL_POSITION is not set and: 1) Found two intersecting edges between the source-mesh and the cut-mesh and/or 2) An intersection test between a face and an edge failed because an edge vertex only touches (but does not penetrate) the face, and/or 3) One or more source-mesh vertices are colocated with one or more cut-mesh vertices.
+*   -# ::MC_DISPATCH_ENFORCE_GENERAL_POSITION is not set and (unless ::MC_DISPATCH_ENFORCE_GENERAL_POSITION_SYMBOLICALLY is set): 1) Found two intersecting edges between the source-mesh and the cut-mesh and/or 2) An intersection test between a face and an edge failed because an edge vertex only touches (but does not penetrate) the face, and/or 3) One or more source-mesh vertices are colocated with one or more cut-mesh vertices.
 * - ::MC_OUT_OF_MEMORY
 *   -# Insufficient memory to perform operation.
 */
@@ -593,6 +747,369 @@ extern MCAPI_ATTR McResult MCAPI_CALL mcDispatch(
     uint32_t numCutMeshVertices,
     uint32_t numCutMeshFaces);
 
+/** @brief Enqueue a cutting operation without waiting for it to complete.
+*
+* @param[in] context The context handle that was created by a previous call to ::mcCreateContext.
+* @param[in] flags The flags indicating how to interprete input data and configure the execution.
+* @param[in] pSrcMeshVertices The array of vertex coordinates (i.e. in xyzxyzxyz... format) of the source mesh.
+* @param[in] pSrcMeshFaceIndices The array of vertex indices of the faces (polygons) in the source mesh.
+* @param[in] pSrcMeshFaceSizes The array of the sizes (in terms of number of vertex indices) of the faces in the source mesh.
+* @param[in] numSrcMeshVertices The number of vertices in the source mesh.
+* @param[in] numSrcMeshFaces The number of faces in the source mesh.
+* @param[in] pCutMeshVertices The array of vertex coordinates (i.e. in xyzxyzxyz... format) of the cut mesh.
+* @param[in] pCutMeshFaceIndices The array of vertex indices of the faces (polygons) in the cut mesh.
+* @param[in] pCutMeshFaceSizes The array of the sizes (in terms of number of vertex indices) of the faces in the cut mesh.
+* @param[in] numCutMeshVertices The number of vertices in the cut mesh.
+* @param[in] numCutMeshFaces The number of faces in the cut mesh.
+* @param[in] pfnNotify An optional callback function that is called when the dispatch call has completed. May be NULL.
+* @param[in] pUserData Passed as the \p data argument when \p pfnNotify is called. May be NULL.
+* @param[out] pEvent Returns an event object that identifies this dispatch call.
+*
+* This function is equivalent to ::mcDispatch except that it returns as soon as the dispatch call has been 
+* submitted to the worker threads of \p context. Several dispatch calls can be in flight at the same time. 
+* The input arrays are read during execution, and so must remain valid until the event has the status ::MC_COMPLETE.
+* Errors found while checking the inputs of the dispatch call (e.g. invalid mesh connectivity) are reported 
+* with ::MC_EVENT_RUNTIME_EXECUTION_STATUS rather than with the return value of this function.
+*
+* The connected components that are computed are added to \p context immediately before the event obtains 
+* the status ::MC_COMPLETE. The callback \p pfnNotify is then invoked from a worker thread, and so may still be 
+* running when ::mcWaitForEvents returns. It may query or release its event (with ::mcGetEventInfo or 
+* ::mcReleaseEvents), but must not call ::mcWaitForEvents or ::mcReleaseContext. In single-threaded builds of 
+* MCUT, the dispatch call executes before this function returns.
+*
+* An example of usage:
+* @code
+*  McEvent event;
+*  McResult err = mcEnqueueDispatch(myContext, MC_DISPATCH_VERTEX_ARRAY_FLOAT, 
+*        pSrcMeshVertices, pSrcMeshFaceIndices, pSrcMeshFaceSizes, numSrcMeshVertices, numSrcMeshFaces,
+*        pCutMeshVertices, pCutMeshFaceIndices, pCutMeshFaceSizes, numCutMeshVertices, numCutMeshFaces, 
+*        NULL, NULL, &event);
+*  // ... do other work
+*  err = mcWaitForEvents(myContext, 1, &event);
+*  err = mcReleaseEvents(myContext, 1, &event);
+* @endcode
+* 
+* @return Error code.
+*
+* <b>Error codes</b> 
+* - ::MC_NO_ERROR  
+*   -# proper exit 
+* - ::MC_INVALID_VALUE 
+*   -# \p pContext is NULL or \p pContext is not an existing context.
+*   -# \p pEvent is NULL.
+*   -# Any of the parameter conditions listed for ::mcDispatch that are checked before execution (e.g. NULL arrays).
+* - ::MC_OUT_OF_MEMORY
+*   -# Insufficient memory to perform operation.
+*/
+extern MCAPI_ATTR McResult MCAPI_CALL mcEnqueueDispatch(
+    McContext context,
+    McFlags flags,
+    const void* pSrcMeshVertices,
+    const uint32_t* pSrcMeshFaceIndices,
+    const uint32_t* pSrcMeshFaceSizes,
+    uint32_t numSrcMeshVertices,
+    uint32_t numSrcMeshFaces,
+    const void* pCutMeshVertices,
+    const uint32_t* pCutMeshFaceIndices,
+    const uint32_t* pCutMeshFaceSizes,
+    uint32_t numCutMeshVertices,
+    uint32_t numCutMeshFaces,
+    pfn_McEvent_CALLBACK pfnNotify,
+    void* pUserData,
+    McEvent* pEvent);
+
+/** @brief Wait for the dispatch calls associated with a list of events to complete.
+*
+* @param[in] context The context handle that was created by a previous call to ::mcCreateContext.
+* @param[in] numEvents The number of events in \p pEventList.
+* @param[in] pEventList The events to wait for.
+*
+* @return Error code. If all events completed successfully, the return value is ::MC_NO_ERROR. Otherwise it is the  
+* ::MC_EVENT_RUNTIME_EXECUTION_STATUS of the first event in \p pEventList whose dispatch call failed.
+*
+* <b>Error codes</b> 
+* - ::MC_NO_ERROR  
+*   -# proper exit 
+* - ::MC_INVALID_VALUE 
+*   -# \p pContext is NULL or \p pContext is not an existing context.
+*   -# \p numEvents is zero or \p pEventList is NULL.
+*   -# An event in \p pEventList is not an existing event of \p context.
+*/
+extern MCAPI_ATTR McResult MCAPI_CALL mcWaitForEvents(
+    McContext context,
+    uint32_t numEvents,
+    const McEvent* pEventList);
+
+/** @brief Query information about an event.
+*
+* @param[in] context The context handle that was created by a previous call to ::mcCreateContext.
+* @param[in] event The event to query.
+* @param[in] info The information to query (See also: ::McEventInfo).
+* @param[in] bytes The size in bytes of memory pointed to by \p pMem, which must be >= the size of the returned value.
+* @param[out] pMem Pointer to memory where the queried value is written. Ignored if NULL.
+* @param[out] pNumBytes Returns the actual size in bytes of the queried value. Ignored if NULL.
+*
+* The elapsed execution time of a completed dispatch call is ::MC_EVENT_TIMESTAMP_END minus ::MC_EVENT_TIMESTAMP_START.
+*
+* An example of usage:
+* @code
+*  McEventCommandExecStatus status;
+*  McResult err = mcGetEventInfo(myContext, event, MC_EVENT_COMMAND_EXECUTION_STATUS, sizeof(status), &status, NULL);
+* @endcode
+*
+* @return Error code.
+*
+* <b>Error codes</b> 
+* - ::MC_NO_ERROR  
+*   -# proper exit 
+* - ::MC_INVALID_VALUE 
+*   -# \p pContext is NULL or \p pContext is not an existing context.
+*   -# \p event is not an existing event of \p context.
+*   -# \p info is not a value in ::McEventInfo.
+*   -# \p pMem and \p pNumBytes are both NULL.
+*   -# \p bytes is less than the size of the queried value.
+*/
+extern MCAPI_ATTR McResult MCAPI_CALL mcGetEventInfo(
+    McContext context,
+    McEvent event,
+    McFlags info,
+    uint64_t bytes,
+    void* pMem,
+    uint64_t* pNumBytes);
+
+/** @brief Release a list of events.
+*
+* @param[in] context The context handle that was created by a previous call to ::mcCreateContext.
+* @param[in] numEvents The number of events in \p pEvents.
+* @param[in] pEvents The events to release.
+*
+* An event whose dispatch call has not completed is waited for before it is released.
+*
+* @return Error code.
+*
+* <b>Error codes</b> 
+* - ::MC_NO_ERROR  
+*   -# proper exit 
+* - ::MC_INVALID_VALUE 
+*   -# \p pContext is NULL or \p pContext is not an existing context.
+*   -# \p numEvents is zero or \p pEvents is NULL.
+*   -# An event in \p pEvents is not an existing event of \p context.
+*/
+extern MCAPI_ATTR McResult MCAPI_CALL mcReleaseEvents(
+    McContext context,
+    uint32_t numEvents,
+    const McEvent* pEvents);
+
+/** @brief Create a mesh object.
+*
+* This method creates a mesh object from the given arrays. The halfedge data structure and the bounding volume 
+* hierarchy (BVH) of the mesh are built and validated only once (i.e. here), and then re-used by every subsequent 
+* call to ::mcDispatchMeshes that specifies the mesh object as the source mesh. This is useful when cutting the 
+* same source mesh many times with different cut meshes.
+*
+* @param[in] context The context handle that was created by a previous call to ::mcCreateContext.
+* @param[out] pMesh a pointer to the allocated mesh handle
+* @param[in] flags The flags indicating how to interprete the vertex array i.e. ::MC_DISPATCH_VERTEX_ARRAY_FLOAT or ::MC_DISPATCH_VERTEX_ARRAY_DOUBLE, optionally combined with ::MC_DISPATCH_WIDE_BVH.
+* @param[in] pVertices The array of vertex coordinates (i.e. in xyzxyzxyz... format) of the mesh.
+* @param[in] pFaceIndices The array of vertex indices of the faces (polygons) in the mesh.
+* @param[in] pFaceSizes The array of the sizes (in terms of number of vertex indices) of the faces in the mesh.
+* @param[in] numVertices The number of vertices in the mesh.
+* @param[in] numFaces The number of faces in the mesh.
+*
+* The client arrays are not referenced after this function returns.
+*
+ * An example of usage:
+ * @code
+ * McMesh mySrcMesh = MC_NULL_HANDLE;
+ * McResult err = mcCreateMesh(myContext, &mySrcMesh, MC_DISPATCH_VERTEX_ARRAY_FLOAT, pVertices, pFaceIndices, pFaceSizes, numVertices, numFaces);
+ * if(err != MC_NO_ERROR)
+ * {
+ *  // deal with error
+ * }
+ * @endcode
+*
+* @return Error code.
+*
+* <b>Error codes</b> 
+* - MC_NO_ERROR  
+*   -# proper exit 
+* - MC_INVALID_VALUE 
+*   -# \p pContext is NULL or \p pContext is not an existing context.
+*   -# \p pMesh is NULL.
+*   -# The MC_DISPATCH_VERTEX_ARRAY_... value has not been specified in \p flags
+*   -# \p pVertices is NULL.
+*   -# \p pFaceIndices is NULL.
+*   -# \p numVertices is less than three.
+*   -# \p numFaces is less than one.
+*   -# A vertex index in \p pFaceIndices is out of bounds.
+*   -# The mesh is non-manifold or contains multiple connected components.
+*/
+extern MCAPI_ATTR McResult MCAPI_CALL mcCreateMesh(
+    McContext context,
+    McMesh* pMesh,
+    McFlags flags,
+    const void* pVertices,
+    const uint32_t* pFaceIndices,
+    const uint32_t* pFaceSizes,
+    uint32_t numVertices,
+    uint32_t numFaces);
+
+/**
+* @brief Execute a cutting operation with a source mesh object and a cut mesh.
+*
+* @param[in] context The context handle that was created by a previous call to ::mcCreateContext.
+* @param[in] flags The flags indicating how to interprete the cut-mesh data and configure the execution.
+* @param[in] srcMesh The source mesh object that was created by a previous call to ::mcCreateMesh.
+* @param[in] pCutMeshVertices The array of vertex coordinates (i.e. in xyzxyzxyz... format) of the cut mesh.
+* @param[in] pCutMeshFaceIndices The array of vertex indices of the faces (polygons) in the cut mesh.
+* @param[in] pCutMeshFaceSizes The array of the sizes (in terms of number of vertex indices) of the faces in the cut mesh.
+* @param[in] numCutMeshVertices The number of vertices in the cut mesh.
+* @param[in] numCutMeshFaces The number of faces in the cut mesh.
+*
+* This function is equivalent to ::mcDispatch except that the source mesh is given as a mesh object, whose
+* internal representation is not rebuilt. Only the cut mesh is processed anew. The MC_DISPATCH_VERTEX_ARRAY_... 
+* value in \p flags applies to \p pCutMeshVertices. \p srcMesh is not modified by this function and can 
+* be used in any number of dispatch calls until it is released with ::mcReleaseMesh.
+*
+* An example of usage:
+* @code
+*  McResult err = mcDispatchMeshes(
+*        myContext,
+*        MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+*        mySrcMesh,
+*        pCutMeshVertices,
+*        pCutMeshFaceIndices,
+*        pCutMeshFaceSizes,
+*        numCutMeshVertices,
+*        numCutMeshFaces);
+ * if(err != MC_NO_ERROR)
+ * {
+ *  // deal with error
+ * }
+ * @endcode
+* 
+* @return Error code.
+*
+* <b>Error codes</b> 
+* - ::MC_NO_ERROR  
+*   -# proper exit 
+* - ::MC_INVALID_VALUE 
+*   -# \p pContext is NULL or \p pContext is not an existing context.
+*   -# \p srcMesh is NULL or \p srcMesh is not an existing mesh object of \p context.
+*   -# Any of the conditions relating to \p flags or the cut-mesh parameters listed for ::mcDispatch.
+* - ::MC_OUT_OF_MEMORY
+*   -# Insufficient memory to perform operation.
+*/
+extern MCAPI_ATTR McResult MCAPI_CALL mcDispatchMeshes(
+    McContext context,
+    McFlags flags,
+    McMesh srcMesh,
+    const void* pCutMeshVertices,
+    const uint32_t* pCutMeshFaceIndices,
+    const uint32_t* pCutMeshFaceSizes,
+    uint32_t numCutMeshVertices,
+    uint32_t numCutMeshFaces);
+
+/**
+* @brief Execute a cutting operation with one source mesh and several cut meshes.
+*
+* @param[in] context The context handle that was created by a previous call to ::mcCreateContext.
+* @param[in] flags The flags indicating how to interprete the cut-mesh data and configure the execution.
+* @param[in] srcMesh The source mesh object that was created by a previous call to ::mcCreateMesh.
+* @param[in] numCutMeshes The number of cut meshes.
+* @param[in] ppCutMeshVertices Array of \p numCutMeshes pointers to vertex coordinate arrays (see ::mcDispatch).
+* @param[in] ppCutMeshFaceIndices Array of \p numCutMeshes pointers to face index arrays.
+* @param[in] ppCutMeshFaceSizes Array of \p numCutMeshes pointers to face size arrays. May be NULL, in which case all cut meshes are triangle meshes. An individual entry may also be NULL.
+* @param[in] pNumCutMeshVertices Array of \p numCutMeshes vertex counts.
+* @param[in] pNumCutMeshFaces Array of \p numCutMeshes face counts.
+* @param[out] pResults Optional array of \p numCutMeshes error codes, one per cut mesh. Ignored if NULL.
+*
+* Each cut mesh is used to cut \p srcMesh separately, as if by calling ::mcDispatchMeshes once per cut mesh. 
+* When MCUT is built with multi-threading, the cut meshes are processed concurrently on the worker threads of 
+* \p context. The connected components of all cut meshes are added to \p context, and those produced 
+* by a specific cut mesh can be queried with ::mcGetBatchConnectedComponents. A failure with one cut mesh does not 
+* stop the processing of the others.
+*
+* Note: the debug callback of \p context may be invoked concurrently from several threads during this call.
+*
+* An example of usage:
+* @code
+*  McResult results[2];
+*  McResult err = mcDispatchBatch(
+*        myContext,
+*        MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+*        mySrcMesh,
+*        2,
+*        ppCutMeshVertices,
+*        ppCutMeshFaceIndices,
+*        ppCutMeshFaceSizes,
+*        pNumCutMeshVertices,
+*        pNumCutMeshFaces,
+*        results);
+ * if(err != MC_NO_ERROR)
+ * {
+ *  // inspect "results" to find the cut meshes that failed
+ * }
+ * @endcode
+* 
+* @return Error code. This is ::MC_NO_ERROR if all cut meshes were processed successfully, and otherwise the error of the first cut mesh that failed.
+*
+* <b>Error codes</b> 
+* - ::MC_NO_ERROR  
+*   -# proper exit 
+* - ::MC_INVALID_VALUE 
+*   -# \p pContext is NULL or \p pContext is not an existing context.
+*   -# \p srcMesh is NULL or \p srcMesh is not an existing mesh object of \p context.
+*   -# \p numCutMeshes is zero.
+*   -# \p ppCutMeshVertices, \p ppCutMeshFaceIndices, \p pNumCutMeshVertices or \p pNumCutMeshFaces is NULL.
+*   -# Any of the conditions relating to \p flags or the cut-mesh parameters listed for ::mcDispatch.
+* - ::MC_INVALID_OPERATION
+*   -# The cutting operation failed for a cut mesh (see ::mcDispatch).
+* - ::MC_OUT_OF_MEMORY
+*   -# Insufficient memory to perform operation.
+*/
+extern MCAPI_ATTR McResult MCAPI_CALL mcDispatchBatch(
+    McContext context,
+    McFlags flags,
+    McMesh srcMesh,
+    uint32_t numCutMeshes,
+    const void* const* ppCutMeshVertices,
+    const uint32_t* const* ppCutMeshFaceIndices,
+    const uint32_t* const* ppCutMeshFaceSizes,
+    const uint32_t* pNumCutMeshVertices,
+    const uint32_t* pNumCutMeshFaces,
+    McResult* pResults);
+
+/**
+* @brief To release the memory of a mesh object, call this function.
+*
+* Connected components that were computed from the mesh object remain valid after it is released.
+*
+* @param[in] context The context handle that was created by a previous call to ::mcCreateContext.
+* @param[in] mesh The mesh object that was created by a previous call to ::mcCreateMesh.
+*
+ * An example of usage:
+ * @code
+ * McResult err = mcReleaseMesh(myContext, mySrcMesh);
+ * if(err != MC_NO_ERROR)
+ * {
+ *  // deal with error
+ * }
+ * @endcode
+*
+* @return Error code.
+*
+* <b>Error codes</b> 
+* - MC_NO_ERROR  
+*   -# proper exit 
+* - MC_INVALID_VALUE 
+*   -# \p pContext is NULL or \p pContext is not an existing context.
+*   -# \p mesh is NULL or \p mesh is not an existing mesh object of \p context.
+*/
+extern MCAPI_ATTR McResult MCAPI_CALL mcReleaseMesh(
+    McContext context,
+    McMesh mesh);
+
 /**
 * @brief Return the value of a selected parameter.
 *
@@ -627,6 +1144,10 @@ extern MCAPI_ATTR McResult MCAPI_CALL mcDispatch(
 * - MC_INVALID_VALUE 
 *   -# \p pContext is NULL or \p pContext is not an existing context.
 *   -# \p bytes is greater than the returned size of data type queried
+*   -# \p info is ::MC_CONTEXT_DISPATCH_STAGE_TIMES and \p bytes is not a multiple of sizeof(::McDispatchStageTime)
+* - MC_INVALID_OPERATION 
+*   -# \p info is ::MC_CONTEXT_DISPATCH_STATS or ::MC_CONTEXT_DISPATCH_STAGE_TIMES, and \p context was not created with ::MC_PROFILING_ENABLE
+*   -# \p info is ::MC_CONTEXT_TRACE, and \p context was not created with ::MC_TRACING_ENABLE
 *
 * @note Event synchronisation is not implemented.
 */
@@ -637,6 +1158,46 @@ extern MCAPI_ATTR McResult MCAPI_CALL mcGetInfo(
     void* pMem,
     uint64_t* pNumBytes);
 
+/**
+* @brief Set the value of a selected context parameter.
+*
+* Only parameters that are not fixed at creation can be set, which are currently ::MC_CONTEXT_SERIAL_EXECUTION_THRESHOLD and ::MC_CONTEXT_TRACE_FILE. 
+* The new value applies to dispatch calls that are made after this function returns.
+*
+* @param[in] context The context handle that was created by a previous call to ::mcCreateContext. 
+* @param[in] property The parameter being set. ::McQueryFlags
+* @param[in] bytes Size in bytes of memory pointed to by \p pMem, which must be equal to the size of the data type of \p property (for strings, the length including the null terminator).
+* @param[in] pMem Pointer to memory holding the new value.
+*
+ * An example of usage:
+ * @code
+ * // small meshes: do not parallelise stages that process fewer than 4096 elements
+ * uint32_t threshold = 4096;
+ * McResult err =  mcSetContextProperty(context, MC_CONTEXT_SERIAL_EXECUTION_THRESHOLD, sizeof(uint32_t), &threshold);
+ * if(err != MC_NO_ERROR)
+ * {
+ *  // deal with error
+ * }
+ * @endcode
+* @return Error code.
+*
+* <b>Error codes</b> 
+* - MC_NO_ERROR  
+*   -# proper exit 
+* - MC_INVALID_VALUE 
+*   -# \p pContext is NULL or \p pContext is not an existing context.
+*   -# \p property is not a settable parameter.
+*   -# \p pMem is NULL or \p bytes is not the size of the data type of \p property.
+*   -# \p property is ::MC_CONTEXT_TRACE_FILE and the file cannot be opened for writing.
+* - MC_INVALID_OPERATION 
+*   -# \p property is ::MC_CONTEXT_TRACE_FILE, and \p context was not created with ::MC_TRACING_ENABLE
+*/
+extern MCAPI_ATTR McResult MCAPI_CALL mcSetContextProperty(
+    const McContext context,
+    McFlags property,
+    uint64_t bytes,
+    const void* pMem);
+
 /**
 * @brief Query the connected components available in a context.
 * 
@@ -692,6 +1253,38 @@ extern MCAPI_ATTR McResult MCAPI_CALL mcGetConnectedComponents(
     McConnectedComponent* pConnComps,
     uint32_t* numConnComps);
 
+/**
+* @brief Query the connected components produced by one cut mesh of the most recent ::mcDispatchBatch call.
+* 
+* This function is equivalent to ::mcGetConnectedComponents except that only the connected components that were 
+* produced with the cut mesh at index \p cutMeshIndex of the most recent ::mcDispatchBatch call are returned.
+*  
+* @param[in] context The context handle
+* @param[in] cutMeshIndex The index of the cut mesh in the most recent ::mcDispatchBatch call.
+* @param[in] connectedComponentType The type(s) of connected component sought. See also ::McConnectedComponentType.
+* @param[in] numEntries The number of ::McConnectedComponent entries that can be added to \p pConnComps.
+* @param[out] pConnComps Returns a list of connected components found. If \p pConnComps is NULL, this argument is ignored.
+* @param[out] numConnComps Returns the number of connected components available that match \p cutMeshIndex and \p connectedComponentType. If \p numConnComps is NULL, 
+* this argument is ignored.
+*
+* @return Error code.
+*
+* <b>Error codes</b> 
+* - MC_NO_ERROR  
+*   -# proper exit 
+* - MC_INVALID_VALUE 
+*   -# \p pContext is NULL or \p pContext is not an existing context.
+*   -# \p connectedComponentType is not a value in ::McConnectedComponentType.
+*   -# \p numConnComps and \p pConnComps are both NULL.
+*/
+extern MCAPI_ATTR McResult MCAPI_CALL mcGetBatchConnectedComponents(
+    const McContext context,
+    const uint32_t cutMeshIndex,
+    const McConnectedComponentType connectedComponentType,
+    const uint32_t numEntries,
+    McConnectedComponent* pConnComps,
+    uint32_t* numConnComps);
+
 /**
 * @brief Query specific information about a connected component.
 *
@@ -781,7 +1374,7 @@ extern MCAPI_ATTR McResult MCAPI_CALL mcReleaseConnectedComponents(
 /**
 * @brief To release the memory of a context, call this function.
 *
-* This function ensures that all the state attached to context (such as unreleased connected components, and threads) are released, and the memory is deleted.
+* This function ensures that all the state attached to context (such as unreleased connected components, mesh objects, events, and threads) are released, and the memory is deleted. Dispatch calls that are still in flight (see ::mcEnqueueDispatch) are waited for first.
 
 * @param[in] context The context handle that was created by a previous call to ::mcCreateContext. 
 *
@@ -802,6 +1395,8 @@ extern MCAPI_ATTR McResult MCAPI_CALL mcReleaseConnectedComponents(
 *   -# proper exit 
 * - MC_INVALID_VALUE 
 *   -# \p pContext is NULL or \p pContext is not an existing context.
+* - MC_INVALID_OPERATION 
+*   -# the trace could not be written to the file set with ::MC_CONTEXT_TRACE_FILE (the context is still released).
 */
 extern MCAPI_ATTR McResult MCAPI_CALL mcReleaseContext(
     McContext context);
@@ -23,8 +23,9 @@
 #include <mcut/internal/bvh.h>
 #include <mcut/internal/utils.h>
 
-#include <queue>
+#include <algorithm>
 #include <cmath> // see: if it is possible to remove thsi header
+#include <limits>
 
 #ifdef _MSC_VER
 #include <intrin.h>
@@ -49,7 +50,100 @@ unsigned int __inline clz_(unsigned int value)
 #define CHAR_BIT 8
 #endif
 
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define MCUT_OIBVH_SSE 1
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define MCUT_OIBVH_NEON 1
+#endif
+
+void candidate_face_pairs_t::build(const block_executor_t& for_each_block, uint32_t num_ps_faces, const std::vector<std::pair<fd_t, fd_t>>& face_pairs)
+{
+    clear();
+
+    // group the pairs by face (counting sort), and then sort the faces that each face may intersect so that the result
+    // does not depend on the order of the pairs (e.g. the number of threads that traversed the BVHs)
+    m_offsets.resize((size_t)num_ps_faces + 1, 0);
+
+    for (std::vector<std::pair<fd_t, fd_t>>::const_iterator it = face_pairs.cbegin(); it != face_pairs.cend(); ++it) {
+        MCUT_ASSERT((uint32_t)it->first < num_ps_faces && (uint32_t)it->second < num_ps_faces);
+        m_offsets[(uint32_t)it->first + 1]++;
+        m_offsets[(uint32_t)it->second + 1]++;
+    }
+
+    for (uint32_t i = 0; i < num_ps_faces; ++i) {
+        if (m_offsets[i + 1] != 0) {
+            m_faces.push_back(fd_t(i));
+        }
+
+        m_offsets[i + 1] += m_offsets[i];
+    }
+
+    m_others.resize(m_offsets.back());
+
+    {
+        std::vector<uint32_t> cursors(m_offsets.cbegin(), m_offsets.cend() - 1);
+
+        for (std::vector<std::pair<fd_t, fd_t>>::const_iterator it = face_pairs.cbegin(); it != face_pairs.cend(); ++it) {
+            m_others[cursors[it->first]++] = it->second;
+            m_others[cursors[it->second]++] = it->first;
+        }
+    }
+
+    for_each_block(num_ps_faces, [&](uint32_t first, uint32_t last) {
+        for (uint32_t i = first; i < last; ++i) {
+            std::sort(m_others.begin() + m_offsets[i], m_others.begin() + m_offsets[i + 1]);
+        }
+    });
+}
+
 #if defined(USE_OIBVH)
+    namespace {
+    // round to the nearest float that is not greater than "x"
+    float round_down_to_float(const double& x)
+    {
+        const float x_f = static_cast<float>(x);
+        return ((double)x_f > x) ? std::nextafter(x_f, -std::numeric_limits<float>::infinity()) : x_f;
+    }
+
+    // round to the nearest float that is not less than "x"
+    float round_up_to_float(const double& x)
+    {
+        const float x_f = static_cast<float>(x);
+        return ((double)x_f < x) ? std::nextafter(x_f, std::numeric_limits<float>::infinity()) : x_f;
+    }
+    } // namespace
+
+    void oibvh_node_aabbs_t::resize(uint32_t num_nodes)
+    {
+        for (int axis = 0; axis < 3; ++axis) {
+            m_minimum[axis].resize(num_nodes, std::numeric_limits<float>::infinity());
+            m_maximum[axis].resize(num_nodes, -std::numeric_limits<float>::infinity());
+        }
+    }
+
+    void oibvh_node_aabbs_t::set(uint32_t node, const bounding_box_t<vec3>& bbox)
+    {
+        MCUT_ASSERT(node < size());
+
+        // round outwards
+        for (int axis = 0; axis < 3; ++axis) {
+            m_minimum[axis][node] = round_down_to_float(bbox.minimum()[axis]);
+            m_maximum[axis][node] = round_up_to_float(bbox.maximum()[axis]);
+        }
+    }
+
+    void oibvh_node_aabbs_t::set_union(uint32_t node, uint32_t node_a, uint32_t node_b)
+    {
+        MCUT_ASSERT(node < size() && node_a < size() && node_b < size());
+
+        for (int axis = 0; axis < 3; ++axis) {
+            m_minimum[axis][node] = std::min(m_minimum[axis][node_a], m_minimum[axis][node_b]);
+            m_maximum[axis][node] = std::max(m_maximum[axis][node_a], m_maximum[axis][node_b]);
+        }
+    }
+
     // count leading zeros in 32 bit bitfield
     unsigned int clz(unsigned int x) // stub
     {
@@ -199,89 +293,205 @@ unsigned int __inline clz_(unsigned int value)
         return (xx * 4 + yy * 2 + zz);
     };
 
+    namespace {
+    // Sort the leaf nodes (i.e. face and Morton code pairs) by their Morton code with a (stable) LSD radix sort. In each
+    // pass, the digits of every block of leaf nodes are counted, and then each block is scattered (in parallel) to the
+    // offsets given by the prefix sum of the counts.
+    void radix_sort_leaf_nodes(
+        const block_executor_t& for_each_block,
+        std::vector<std::pair<fd_t, uint32_t>>& leaf_nodes,
+        const uint32_t num_key_bits)
+    {
+        const uint32_t radix_bits = 8;
+        const uint32_t radix = (1 << radix_bits);
+        const uint32_t num_leaf_nodes = (uint32_t)leaf_nodes.size();
+        const uint32_t num_blocks = (num_leaf_nodes + block_executor_t::block_size - 1) / block_executor_t::block_size;
+
+        std::vector<std::pair<fd_t, uint32_t>> sorted_leaf_nodes(num_leaf_nodes);
+        std::vector<uint32_t> block_digit_offsets((size_t)num_blocks * radix); // [block][digit]
+
+        for (uint32_t shift = 0; shift < num_key_bits; shift += radix_bits) {
+
+            for_each_block(num_leaf_nodes, [&](uint32_t first, uint32_t last) {
+                // NOTE: the range may contain several blocks
+                for (uint32_t block = first / block_executor_t::block_size; block * block_executor_t::block_size < last; ++block) {
+                    uint32_t* digit_counts = &block_digit_offsets[(size_t)block * radix];
+                    const uint32_t block_end = std::min(last, (block + 1) * block_executor_t::block_size);
+
+                    std::fill(digit_counts, digit_counts + radix, 0);
+
+                    for (uint32_t i = block * block_executor_t::block_size; i < block_end; ++i) {
+                        digit_counts[(leaf_nodes[i].second >> shift) & (radix - 1)]++;
+                    }
+                }
+            });
+
+            uint32_t offset = 0;
+
+            for (uint32_t digit = 0; digit < radix; ++digit) {
+                for (uint32_t block = 0; block < num_blocks; ++block) {
+                    uint32_t& count = block_digit_offsets[(size_t)block * radix + digit];
+                    const uint32_t block_digit_count = count;
+                    count = offset;
+                    offset += block_digit_count;
+                }
+            }
+
+            for_each_block(num_leaf_nodes, [&](uint32_t first, uint32_t last) {
+                for (uint32_t block = first / block_executor_t::block_size; block * block_executor_t::block_size < last; ++block) {
+                    uint32_t* digit_offsets = &block_digit_offsets[(size_t)block * radix];
+                    const uint32_t block_end = std::min(last, (block + 1) * block_executor_t::block_size);
+
+                    for (uint32_t i = block * block_executor_t::block_size; i < block_end; ++i) {
+                        sorted_leaf_nodes[digit_offsets[(leaf_nodes[i].second >> shift) & (radix - 1)]++] = leaf_nodes[i];
+                    }
+                }
+            });
+
+            leaf_nodes.swap(sorted_leaf_nodes);
+        }
+    }
+
+    // compute the bounding box of each face (slightly enlarged by "eps") and its center
+    void build_face_aabbs(
+        const block_executor_t& for_each_block,
+        const compact_hmesh_t& mesh,
+        std::vector<bounding_box_t<vec3>>& face_bboxes,
+        std::vector<vec3>& face_bbox_centers,
+        const double& eps)
+    {
+        const uint32_t meshInternalFaceCount = (uint32_t)mesh.number_of_internal_faces();
+
+        face_bboxes.clear();
+        face_bboxes.resize(meshInternalFaceCount);
+        face_bbox_centers.clear();
+        face_bbox_centers.resize(meshInternalFaceCount, vec3());
+
+        for_each_block(meshInternalFaceCount, [&](uint32_t first, uint32_t last) {
+            // for each face in block
+            for (uint32_t faceIdx = first; faceIdx < last; ++faceIdx) {
+                const fd_t f(faceIdx);
+
+                if (mesh.is_removed(f)) {
+                    continue;
+                }
+
+                bounding_box_t<vec3>& bbox = face_bboxes[faceIdx];
+
+                // for each vertex on face
+                const hd_t first_halfedge = mesh.halfedge(f);
+                hd_t h = first_halfedge;
+
+                do {
+                    bbox.expand(mesh.vertex(mesh.target(h)));
+                    h = mesh.next(h);
+                } while (h != first_halfedge);
+
+                if (eps > double(0.0)) {
+                    bbox.enlarge(eps);
+                }
+
+                // calculate bbox center
+                face_bbox_centers[faceIdx] = (bbox.minimum() + bbox.maximum()) / 2;
+            }
+        });
+    }
+    } // namespace
+
     void build_oibvh(
-        const hmesh_t& mesh,
-        std::vector<bounding_box_t<vec3>>& bvhAABBs,
+#if defined(MCUT_MULTI_THREADED)
+        thread_pool& scheduler,
+        uint32_t serial_execution_threshold,
+#endif
+        const compact_hmesh_t& mesh,
+        oibvh_node_aabbs_t& bvhAABBs,
         std::vector<fd_t>& bvhLeafNodeFaces,
         std::vector<bounding_box_t<vec3>>& face_bboxes,
         const double& slightEnlargmentEps)
     {
         TIMESTACK_PUSH(__FUNCTION__);
 
+#if defined(MCUT_MULTI_THREADED)
+        const block_executor_t for_each_block(scheduler, serial_execution_threshold);
+#else
+        const block_executor_t for_each_block;
+#endif
+
         const int meshFaceCount = mesh.number_of_faces();
         const int bvhNodeCount = get_ostensibly_implicit_bvh_size(meshFaceCount);
+        const uint32_t meshInternalFaceCount = (uint32_t)mesh.number_of_internal_faces();
+        const uint32_t meshInternalVertexCount = (uint32_t)mesh.number_of_internal_vertices();
 
         // compute mesh-face bounding boxes and their centers
         // ::::::::::::::::::::::::::::::::::::::::::::::::::
 
-        face_bboxes.resize(meshFaceCount); //, bounding_box_t<vec3>());
-        std::vector<vec3> face_bbox_centers(meshFaceCount, vec3());
-
-        // for each face in mesh
-        for (face_array_iterator_t f = mesh.faces_begin(); f != mesh.faces_end(); ++f) {
-            const int faceIdx = static_cast<int>(*f);
-            const std::vector<vd_t> vertices_on_face = mesh.get_vertices_around_face(*f);
+        std::vector<vec3> face_bbox_centers;
+        build_face_aabbs(for_each_block, mesh, face_bboxes, face_bbox_centers, slightEnlargmentEps);
 
-            // for each vertex on face
-            for (std::vector<vd_t>::const_iterator v = vertices_on_face.cbegin(); v != vertices_on_face.cend(); ++v) {
-                const vec3 coords = mesh.vertex(*v);
-                face_bboxes[faceIdx].expand(coords);
-            }
+        // compute mesh bounding box
+        // :::::::::::::::::::::::::
 
-            bounding_box_t<vec3>& bbox = face_bboxes[faceIdx];
+        bounding_box_t<vec3> meshBbox;
 
-            if (slightEnlargmentEps > double(0.0)) {
-                bbox.enlarge(slightEnlargmentEps);
-            }
-
-            // calculate bbox center
-            face_bbox_centers[*f] = (bbox.minimum() + bbox.maximum()) / 2;
-        }
+        {
+            // bounding box of the vertices in each block
+            std::vector<bounding_box_t<vec3>> block_bboxes((meshInternalVertexCount + block_executor_t::block_size - 1) / block_executor_t::block_size);
 
-        // compute mesh bounding box
-        // :::::::::::::::::::::::::
+            for_each_block(meshInternalVertexCount, [&](uint32_t first, uint32_t last) {
+                bounding_box_t<vec3>& block_bbox = block_bboxes[first / block_executor_t::block_size];
 
-        bvhAABBs.resize(bvhNodeCount);
-        bounding_box_t<vec3>& meshBbox = bvhAABBs.front(); // root bounding box
+                // for each vertex in block
+                for (uint32_t v = first; v < last; ++v) {
+                    if (!mesh.is_removed(vd_t(v))) {
+                        block_bbox.expand(mesh.vertex(vd_t(v)));
+                    }
+                }
+            });
 
-        // for each vertex in mesh
-        for (vertex_array_iterator_t v = mesh.vertices_begin(); v != mesh.vertices_end(); ++v) {
-            const vec3& coords = mesh.vertex(*v);
-            meshBbox.expand(coords);
+            for (std::vector<bounding_box_t<vec3>>::const_iterator it = block_bboxes.cbegin(); it != block_bboxes.cend(); ++it) {
+                meshBbox.expand(*it);
+            }
         }
 
         // compute morton codes
         // ::::::::::::::::::::
 
-        std::vector<std::pair<fd_t, uint32_t>> bvhLeafNodeDescriptors(meshFaceCount, std::pair<fd_t, uint32_t>());
+        // NOTE: indexed by face, until removed faces are erased
+        std::vector<std::pair<fd_t, uint32_t>> bvhLeafNodeDescriptors(meshInternalFaceCount, std::pair<fd_t, uint32_t>());
 
-        for (face_array_iterator_t f = mesh.faces_begin(); f != mesh.faces_end(); ++f) {
-            const uint32_t faceIdx = static_cast<uint32_t>(*f);
+        const vec3 dims = meshBbox.maximum() - meshBbox.minimum();
 
-            const vec3& face_aabb_centre = SAFE_ACCESS(face_bbox_centers,faceIdx);
-            const vec3 offset = face_aabb_centre - meshBbox.minimum();
-            const vec3 dims = meshBbox.maximum() - meshBbox.minimum();
+        for_each_block(meshInternalFaceCount, [&](uint32_t first, uint32_t last) {
+            for (uint32_t faceIdx = first; faceIdx < last; ++faceIdx) {
+                const vec3& face_aabb_centre = face_bbox_centers[faceIdx];
+                const vec3 offset = face_aabb_centre - meshBbox.minimum();
 
-            const unsigned int mortion_code = morton3D(
-                static_cast<float>(offset.x() / dims.x()),
-                static_cast<float>(offset.y() / dims.y()),
-                static_cast<float>(offset.z() / dims.z()));
+                const unsigned int mortion_code = morton3D(
+                    static_cast<float>(offset.x() / dims.x()),
+                    static_cast<float>(offset.y() / dims.y()),
+                    static_cast<float>(offset.z() / dims.z()));
 
-            const uint32_t idx = (uint32_t)std::distance(mesh.faces_begin(), f); // NOTE: mesh.faces_begin() may not be the actual beginning internally
-            bvhLeafNodeDescriptors[idx].first = *f;
-            bvhLeafNodeDescriptors[idx].second = mortion_code;
+                bvhLeafNodeDescriptors[faceIdx].first = fd_t(faceIdx);
+                bvhLeafNodeDescriptors[faceIdx].second = mortion_code;
+            }
+        });
+
+        if ((uint32_t)meshFaceCount != meshInternalFaceCount) {
+            bvhLeafNodeDescriptors.erase(
+                std::remove_if(
+                    bvhLeafNodeDescriptors.begin(),
+                    bvhLeafNodeDescriptors.end(),
+                    [&](const std::pair<fd_t, uint32_t>& leaf) { return mesh.is_removed(leaf.first); }),
+                bvhLeafNodeDescriptors.end());
         }
 
         // sort faces according to morton codes
 
-        std::sort(
-            bvhLeafNodeDescriptors.begin(),
-            bvhLeafNodeDescriptors.end(),
-            [](const std::pair<fd_t, uint32_t>& a, const std::pair<fd_t, uint32_t>& b) {
-                return a.second < b.second;
-            });
+        radix_sort_leaf_nodes(for_each_block, bvhLeafNodeDescriptors, 30);
 
         bvhLeafNodeFaces.resize(meshFaceCount);
+        bvhAABBs.clear();
+        bvhAABBs.resize((uint32_t)bvhNodeCount);
 
         const int leaf_level_index = get_leaf_level_from_real_leaf_count(meshFaceCount);
         const int leftmost_real_node_on_leaf_level = get_level_leftmost_node(leaf_level_index);
@@ -289,21 +499,22 @@ unsigned int __inline clz_(unsigned int value)
         const int rightmost_real_node_on_leaf_level = get_level_rightmost_real_node(rightmost_real_leaf, leaf_level_index, leaf_level_index);
 
         // save sorted leaf node bvhAABBs and their corrresponding face id
-        for (std::vector<std::pair<fd_t, uint32_t>>::const_iterator it = bvhLeafNodeDescriptors.cbegin(); it != bvhLeafNodeDescriptors.cend(); ++it) {
-            const uint32_t index_on_leaf_level = (uint32_t)std::distance(bvhLeafNodeDescriptors.cbegin(), it);
+        for_each_block((uint32_t)meshFaceCount, [&](uint32_t first, uint32_t last) {
+            for (uint32_t index_on_leaf_level = first; index_on_leaf_level < last; ++index_on_leaf_level) {
+                const fd_t leaf_face = bvhLeafNodeDescriptors[index_on_leaf_level].first;
 
-            bvhLeafNodeFaces[index_on_leaf_level] = it->first;
+                bvhLeafNodeFaces[index_on_leaf_level] = leaf_face;
 
-            const int implicit_idx = leftmost_real_node_on_leaf_level + index_on_leaf_level;
-            const int memory_idx = get_node_mem_index(
-                implicit_idx,
-                leftmost_real_node_on_leaf_level,
-                0,
-                rightmost_real_node_on_leaf_level);
+                const int implicit_idx = leftmost_real_node_on_leaf_level + index_on_leaf_level;
+                const int memory_idx = get_node_mem_index(
+                    implicit_idx,
+                    leftmost_real_node_on_leaf_level,
+                    0,
+                    rightmost_real_node_on_leaf_level);
 
-            const bounding_box_t<vec3>& face_bbox = face_bboxes[(uint32_t)it->first];
-            bvhAABBs[memory_idx] = face_bbox;
-        }
+                bvhAABBs.set((uint32_t)memory_idx, face_bboxes[(uint32_t)leaf_face]);
+            }
+        });
 
         // construct internal-node bounding boxes
         // ::::::::::::::::::::::::::::::::::::::
@@ -314,229 +525,832 @@ unsigned int __inline clz_(unsigned int value)
             const int rightmost_real_node_on_level = get_level_rightmost_real_node(rightmost_real_leaf, leaf_level_index, level_index);
             const int leftmost_real_node_on_level = get_level_leftmost_node(level_index);
             const int number_of_real_nodes_on_level = (rightmost_real_node_on_level - leftmost_real_node_on_level) + 1;
+            const int rightmost_real_node_on_child_level = get_level_rightmost_real_node(rightmost_real_leaf, leaf_level_index, level_index + 1);
+            const int leftmost_real_node_on_child_level = get_level_leftmost_node(level_index + 1);
 
-            // for each node on the current level
-            for (int level_node_idx_iter = 0; level_node_idx_iter < number_of_real_nodes_on_level; ++level_node_idx_iter) {
-
-                const int node_implicit_idx = leftmost_real_node_on_level + level_node_idx_iter;
-                const int left_child_implicit_idx = (node_implicit_idx * 2) + 1;
-                const int right_child_implicit_idx = (node_implicit_idx * 2) + 2;
-                const bool is_penultimate_level = (level_index == (leaf_level_index - 1));
-                const int rightmost_real_node_on_child_level = get_level_rightmost_real_node(rightmost_real_leaf, leaf_level_index, level_index + 1);
-                const int leftmost_real_node_on_child_level = get_level_leftmost_node(level_index + 1);
-                const bool right_child_exists = (right_child_implicit_idx <= rightmost_real_node_on_child_level);
-
-                bounding_box_t<vec3> node_bbox;
-
-                if (is_penultimate_level) { // both children are leaves
-
-                    const int left_child_index_on_level = left_child_implicit_idx - leftmost_real_node_on_child_level;
-                    const fd_t& left_child_face = SAFE_ACCESS(bvhLeafNodeFaces, left_child_index_on_level);
-                    const bounding_box_t<vec3>& left_child_bbox = SAFE_ACCESS(face_bboxes, left_child_face);
-
-                    node_bbox.expand(left_child_bbox);
+            // NOTE: the nodes on a level only depend on the (finished) level below
+            for_each_block((uint32_t)number_of_real_nodes_on_level, [&](uint32_t first, uint32_t last) {
+                // for each node on the current level
+                for (int level_node_idx_iter = (int)first; level_node_idx_iter < (int)last; ++level_node_idx_iter) {
 
-                    if (right_child_exists) {
-                        const int right_child_index_on_level = right_child_implicit_idx - leftmost_real_node_on_child_level;
-                        const fd_t& right_child_face = SAFE_ACCESS(bvhLeafNodeFaces, right_child_index_on_level);
-                        const bounding_box_t<vec3>& right_child_bbox = SAFE_ACCESS(face_bboxes, right_child_face);
-                        node_bbox.expand(right_child_bbox);
-                    }
-                } else { // remaining internal node levels
+                    const int node_implicit_idx = leftmost_real_node_on_level + level_node_idx_iter;
+                    const int left_child_implicit_idx = (node_implicit_idx * 2) + 1;
+                    const int right_child_implicit_idx = (node_implicit_idx * 2) + 2;
+                    const bool right_child_exists = (right_child_implicit_idx <= rightmost_real_node_on_child_level);
 
                     const int left_child_memory_idx = get_node_mem_index(
                         left_child_implicit_idx,
                         leftmost_real_node_on_child_level,
                         0,
                         rightmost_real_node_on_child_level);
-                    const bounding_box_t<vec3>& left_child_bbox = SAFE_ACCESS(bvhAABBs, left_child_memory_idx);
-
-                    node_bbox.expand(left_child_bbox);
-
-                    if (right_child_exists) {
-                        const int right_child_memory_idx = get_node_mem_index(
-                            right_child_implicit_idx,
-                            leftmost_real_node_on_child_level,
-                            0,
-                            rightmost_real_node_on_child_level);
-                        const bounding_box_t<vec3>& right_child_bbox = SAFE_ACCESS(bvhAABBs, right_child_memory_idx);
-                        node_bbox.expand(right_child_bbox);
-                    }
-                }
+                    // NOTE: the right child is next to the left child in memory (if it exists)
+                    const int right_child_memory_idx = right_child_exists ? left_child_memory_idx + 1 : left_child_memory_idx;
 
-                const int node_memory_idx = get_node_mem_index(
-                    node_implicit_idx,
-                    leftmost_real_node_on_level,
-                    0,
-                    rightmost_real_node_on_level);
+                    const int node_memory_idx = get_node_mem_index(
+                        node_implicit_idx,
+                        leftmost_real_node_on_level,
+                        0,
+                        rightmost_real_node_on_level);
 
-                SAFE_ACCESS(bvhAABBs, node_memory_idx) = node_bbox;
-            } // for each real node on level
+                    bvhAABBs.set_union((uint32_t)node_memory_idx, (uint32_t)left_child_memory_idx, (uint32_t)right_child_memory_idx);
+                } // for each real node on level
+            });
         } // for each internal level
         TIMESTACK_POP();
     }
 
+namespace {
+    // a range of faces (in "faces" of wide_bvh_t::build) and their bounding box
+    struct wide_bvh_face_range_t {
+        uint32_t m_first;
+        uint32_t m_last;
+        bounding_box_t<vec3> m_bbox;
+    };
 
-void intersectOIBVHs(
-    std::map<fd_t, std::vector<fd_t>> &ps_face_to_potentially_intersecting_others,
-    const std::vector<bounding_box_t<vec3>> &srcMeshBvhAABBs,
-    const std::vector<fd_t> &srcMeshBvhLeafNodeFaces,
-    const std::vector<bounding_box_t<vec3>> &cutMeshBvhAABBs,
-    const std::vector<fd_t> &cutMeshBvhLeafNodeFaces)
+    double get_half_surface_area(const bounding_box_t<vec3>& bbox)
+    {
+        const vec3 extents = bbox.maximum() - bbox.minimum();
+        return (extents.x() * extents.y()) + (extents.y() * extents.z()) + (extents.z() * extents.x());
+    }
+
+    void get_face_range_bbox(wide_bvh_face_range_t& range, const std::vector<fd_t>& faces, const std::vector<bounding_box_t<vec3>>& face_bboxes)
+    {
+        range.m_bbox = bounding_box_t<vec3>();
+
+        for (uint32_t i = range.m_first; i < range.m_last; ++i) {
+            range.m_bbox.expand(face_bboxes[(uint32_t)faces[i]]);
+        }
+    }
+
+    // Split a range of faces in two with the surface area heuristic (SAH), which is evaluated at the boundaries of
+    // "bin_count" equally-sized bins along the axis on which the centers of the face bounding boxes are most spread out.
+    void split_face_range(
+        const wide_bvh_face_range_t& range,
+        std::vector<fd_t>& faces,
+        const std::vector<bounding_box_t<vec3>>& face_bboxes,
+        const std::vector<vec3>& face_bbox_centers,
+        wide_bvh_face_range_t& left,
+        wide_bvh_face_range_t& right)
+    {
+        const int bin_count = 16;
+
+        bounding_box_t<vec3> centers_bbox;
+
+        for (uint32_t i = range.m_first; i < range.m_last; ++i) {
+            centers_bbox.expand(face_bbox_centers[(uint32_t)faces[i]]);
+        }
+
+        const vec3 centers_extents = centers_bbox.maximum() - centers_bbox.minimum();
+        int axis = 0;
+
+        for (int a = 1; a < 3; ++a) {
+            if (centers_extents[a] > centers_extents[axis]) {
+                axis = a;
+            }
+        }
+
+        uint32_t middle = range.m_first + ((range.m_last - range.m_first) / 2);
+
+        if (centers_extents[axis] > double(0.0)) {
+            const double bin_scale = bin_count / centers_extents[axis];
+            const double axis_minimum = centers_bbox.minimum()[axis];
+
+            auto get_bin = [&](const fd_t& f) {
+                return std::min(bin_count - 1, (int)((face_bbox_centers[(uint32_t)f][axis] - axis_minimum) * bin_scale));
+            };
+
+            uint32_t bin_face_counts[bin_count] = { 0 };
+            bounding_box_t<vec3> bin_bboxes[bin_count];
+
+            for (uint32_t i = range.m_first; i < range.m_last; ++i) {
+                const int bin = get_bin(faces[i]);
+                bin_face_counts[bin] += 1;
+                bin_bboxes[bin].expand(face_bboxes[(uint32_t)faces[i]]);
+            }
+
+            // cost of putting the bins to the right of each boundary into the right range
+            double right_costs[bin_count];
+            bounding_box_t<vec3> right_bbox;
+            uint32_t right_face_count = 0;
+
+            for (int bin = bin_count - 1; bin > 0; --bin) {
+                right_bbox.expand(bin_bboxes[bin]);
+                right_face_count += bin_face_counts[bin];
+                right_costs[bin] = right_face_count == 0 ? 0.0 : get_half_surface_area(right_bbox) * right_face_count;
+            }
+
+            int best_boundary = -1; // the first bin of the right range
+            double best_cost = std::numeric_limits<double>::max();
+            bounding_box_t<vec3> left_bbox;
+            uint32_t left_face_count = 0;
+
+            for (int bin = 1; bin < bin_count; ++bin) {
+                left_bbox.expand(bin_bboxes[bin - 1]);
+                left_face_count += bin_face_counts[bin - 1];
+
+                if (left_face_count == 0 || left_face_count == (range.m_last - range.m_first)) {
+                    continue; // one side would be empty
+                }
+
+                const double cost = (get_half_surface_area(left_bbox) * left_face_count) + right_costs[bin];
+
+                if (cost < best_cost) {
+                    best_cost = cost;
+                    best_boundary = bin;
+                }
+            }
+
+            MCUT_ASSERT(best_boundary != -1); // the first and last bin are not empty
+
+            const std::vector<fd_t>::iterator partition_point = std::partition(
+                faces.begin() + range.m_first,
+                faces.begin() + range.m_last,
+                [&](const fd_t& f) { return get_bin(f) < best_boundary; });
+
+            middle = (uint32_t)std::distance(faces.begin(), partition_point);
+        }
+
+        left.m_first = range.m_first;
+        left.m_last = middle;
+        right.m_first = middle;
+        right.m_last = range.m_last;
+
+        get_face_range_bbox(left, faces, face_bboxes);
+        get_face_range_bbox(right, faces, face_bboxes);
+    }
+
+    void set_wide_bvh_box(float minimum[3][wide_bvh_t::width], float maximum[3][wide_bvh_t::width], int i, const bounding_box_t<vec3>& bbox)
+    {
+        for (int axis = 0; axis < 3; ++axis) {
+            minimum[axis][i] = round_down_to_float(bbox.minimum()[axis]);
+            maximum[axis][i] = round_up_to_float(bbox.maximum()[axis]);
+        }
+    }
+
+    void set_wide_bvh_empty_box(float minimum[3][wide_bvh_t::width], float maximum[3][wide_bvh_t::width], int i)
+    {
+        for (int axis = 0; axis < 3; ++axis) {
+            minimum[axis][i] = std::numeric_limits<float>::infinity();
+            maximum[axis][i] = -std::numeric_limits<float>::infinity();
+        }
+    }
+} // namespace
+
+void wide_bvh_t::build(const block_executor_t& for_each_block, const compact_hmesh_t& mesh, std::vector<bounding_box_t<vec3>>& face_bboxes)
 {
-    TIMESTACK_PUSH(__FUNCTION__);
-    // simultaneuosly traverse both BVHs to find intersecting pairs
-    std::queue<node_pair_t> traversalQueue;
-    traversalQueue.push({0, 0}); // left = sm BVH; right = cm BVH
-
-    const int numSrcMeshFaces = (int)srcMeshBvhLeafNodeFaces.size();
-    MCUT_ASSERT(numSrcMeshFaces >= 1);
-    const int numCutMeshFaces = (int)cutMeshBvhLeafNodeFaces.size();
-    MCUT_ASSERT(numCutMeshFaces >= 1);
-
-    const int sm_bvh_leaf_level_idx = get_leaf_level_from_real_leaf_count(numSrcMeshFaces);
-    const int cs_bvh_leaf_level_idx = get_leaf_level_from_real_leaf_count(numCutMeshFaces);
-
-    const int sm_bvh_rightmost_real_leaf = get_rightmost_real_leaf(sm_bvh_leaf_level_idx, numSrcMeshFaces);
-    const int cs_bvh_rightmost_real_leaf = get_rightmost_real_leaf(cs_bvh_leaf_level_idx, numCutMeshFaces);
-
-    do
-    {
-        node_pair_t ct_front_node = traversalQueue.front();
-
-        bounding_box_t<vec3> sm_bvh_node_bbox;
-        bounding_box_t<vec3> cs_bvh_node_bbox;
-
-        // sm
-        const int sm_bvh_node_implicit_idx = ct_front_node.m_left;
-        const int sm_bvh_node_level_idx = get_level_from_implicit_idx(sm_bvh_node_implicit_idx);
-        const bool sm_bvh_node_is_leaf = sm_bvh_node_level_idx == sm_bvh_leaf_level_idx;
-        const int sm_bvh_node_level_leftmost_node = get_level_leftmost_node(sm_bvh_node_level_idx);
-        fd_t sm_node_face = hmesh_t::null_face();
-        const int sm_bvh_node_level_rightmost_node = get_level_rightmost_real_node(sm_bvh_rightmost_real_leaf, sm_bvh_leaf_level_idx, sm_bvh_node_level_idx);
-        const int sm_bvh_node_mem_idx = get_node_mem_index(
-            sm_bvh_node_implicit_idx,
-            sm_bvh_node_level_leftmost_node,
-            0,
-            sm_bvh_node_level_rightmost_node);
-        sm_bvh_node_bbox = SAFE_ACCESS(srcMeshBvhAABBs, sm_bvh_node_mem_idx);
+    TIMESTACK_PUSH("build wide BVH");
 
-        if (sm_bvh_node_is_leaf)
-        {
-            const int sm_bvh_node_idx_on_level = sm_bvh_node_implicit_idx - sm_bvh_node_level_leftmost_node;
-            sm_node_face = SAFE_ACCESS(srcMeshBvhLeafNodeFaces, sm_bvh_node_idx_on_level);
-        }
-
-        // cs
-        const int cs_bvh_node_implicit_idx = ct_front_node.m_right;
-        const int cs_bvh_node_level_idx = get_level_from_implicit_idx(cs_bvh_node_implicit_idx);
-        const int cs_bvh_node_level_leftmost_node = get_level_leftmost_node(cs_bvh_node_level_idx);
-        const bool cs_bvh_node_is_leaf = cs_bvh_node_level_idx == cs_bvh_leaf_level_idx;
-        fd_t cs_node_face = hmesh_t::null_face();
-        const int cs_bvh_node_level_rightmost_node = get_level_rightmost_real_node(cs_bvh_rightmost_real_leaf, cs_bvh_leaf_level_idx, cs_bvh_node_level_idx);
-        const int cs_bvh_node_mem_idx = get_node_mem_index(
-            cs_bvh_node_implicit_idx,
-            cs_bvh_node_level_leftmost_node,
+    clear();
+
+    std::vector<vec3> face_bbox_centers;
+    build_face_aabbs(for_each_block, mesh, face_bboxes, face_bbox_centers, 0.0);
+
+    m_face_count = (uint32_t)mesh.number_of_faces();
+
+    std::vector<fd_t> faces;
+    faces.reserve(m_face_count);
+
+    for (uint32_t f = 0; f < (uint32_t)mesh.number_of_internal_faces(); ++f) {
+        if (!mesh.is_removed(fd_t(f))) {
+            faces.push_back(fd_t(f));
+        }
+    }
+
+    MCUT_ASSERT(faces.size() == m_face_count);
+
+    wide_bvh_face_range_t root_range;
+    root_range.m_first = 0;
+    root_range.m_last = (uint32_t)faces.size();
+    get_face_range_bbox(root_range, faces, face_bboxes);
+
+    for (int axis = 0; axis < 3; ++axis) {
+        m_root_minimum[axis] = round_down_to_float(root_range.m_bbox.minimum()[axis]);
+        m_root_maximum[axis] = round_up_to_float(root_range.m_bbox.maximum()[axis]);
+    }
+
+    // ranges of faces whose subtree is yet to be built, with the node and child slot that will refer to it
+    struct pending_subtree_t {
+        wide_bvh_face_range_t m_range;
+        int32_t m_parent; // -1 for the root
+        int m_slot;
+    };
+
+    std::vector<pending_subtree_t> pending_subtrees(1, { root_range, -1, 0 });
+
+    while (!pending_subtrees.empty()) {
+        const pending_subtree_t subtree = pending_subtrees.back();
+        pending_subtrees.pop_back();
+
+        int32_t subtree_ref = 0; // see: node_t::m_children
+
+        if ((subtree.m_range.m_last - subtree.m_range.m_first) <= (uint32_t)width) {
+            leaf_t leaf;
+            leaf.m_face_count = subtree.m_range.m_last - subtree.m_range.m_first;
+
+            for (int i = 0; i < width; ++i) {
+                if (i < (int)leaf.m_face_count) {
+                    leaf.m_faces[i] = faces[subtree.m_range.m_first + i];
+                    set_wide_bvh_box(leaf.m_minimum, leaf.m_maximum, i, face_bboxes[(uint32_t)leaf.m_faces[i]]);
+                } else {
+                    leaf.m_faces[i] = fd_t();
+                    set_wide_bvh_empty_box(leaf.m_minimum, leaf.m_maximum, i);
+                }
+            }
+
+            subtree_ref = ~((int32_t)m_leaves.size());
+            m_leaves.push_back(leaf);
+        } else {
+            // split the range into (up to) "width" child ranges, by repeatedly splitting the child range with the
+            // largest surface area
+            std::vector<wide_bvh_face_range_t> child_ranges(1, subtree.m_range);
+
+            while (child_ranges.size() < (size_t)width) {
+                int largest = -1;
+
+                for (int i = 0; i < (int)child_ranges.size(); ++i) {
+                    if ((child_ranges[i].m_last - child_ranges[i].m_first) > (uint32_t)width && (largest == -1 || get_half_surface_area(child_ranges[i].m_bbox) > get_half_surface_area(child_ranges[largest].m_bbox))) {
+                        largest = i;
+                    }
+                }
+
+                if (largest == -1) {
+                    break; // all child ranges will be leaves
+                }
+
+                wide_bvh_face_range_t left;
+                wide_bvh_face_range_t right;
+                split_face_range(child_ranges[largest], faces, face_bboxes, face_bbox_centers, left, right);
+                child_ranges[largest] = left;
+                child_ranges.push_back(right);
+            }
+
+            node_t node;
+            subtree_ref = (int32_t)m_nodes.size();
+
+            for (int i = 0; i < width; ++i) {
+                node.m_children[i] = 0;
+
+                if (i < (int)child_ranges.size()) {
+                    set_wide_bvh_box(node.m_minimum, node.m_maximum, i, child_ranges[i].m_bbox);
+                    pending_subtrees.push_back({ child_ranges[i], subtree_ref, i });
+                } else {
+                    set_wide_bvh_empty_box(node.m_minimum, node.m_maximum, i);
+                }
+            }
+
+            m_nodes.push_back(node);
+        }
+
+        if (subtree.m_parent == -1) {
+            m_root = subtree_ref;
+        } else {
+            m_nodes[subtree.m_parent].m_children[subtree.m_slot] = subtree_ref;
+        }
+    }
+
+    TIMESTACK_POP();
+}
+
+void wide_bvh_t::clear()
+{
+    m_nodes.clear();
+    m_leaves.clear();
+    m_root = 0;
+    m_face_count = 0;
+}
+
+namespace {
+#if defined(MCUT_OIBVH_SSE)
+    inline __m128 intersect_node_aabbs_on_axis_x4(const oibvh_node_aabbs_t& a, const uint32_t a_nodes[4], const oibvh_node_aabbs_t& b, const uint32_t b_nodes[4], int axis)
+    {
+        const float* a_min = a.minimum(axis);
+        const float* a_max = a.maximum(axis);
+        const float* b_min = b.minimum(axis);
+        const float* b_max = b.maximum(axis);
+        const __m128 a_min_x4 = _mm_setr_ps(a_min[a_nodes[0]], a_min[a_nodes[1]], a_min[a_nodes[2]], a_min[a_nodes[3]]);
+        const __m128 a_max_x4 = _mm_setr_ps(a_max[a_nodes[0]], a_max[a_nodes[1]], a_max[a_nodes[2]], a_max[a_nodes[3]]);
+        const __m128 b_min_x4 = _mm_setr_ps(b_min[b_nodes[0]], b_min[b_nodes[1]], b_min[b_nodes[2]], b_min[b_nodes[3]]);
+        const __m128 b_max_x4 = _mm_setr_ps(b_max[b_nodes[0]], b_max[b_nodes[1]], b_max[b_nodes[2]], b_max[b_nodes[3]]);
+        return _mm_and_ps(_mm_cmple_ps(a_min_x4, b_max_x4), _mm_cmpge_ps(a_max_x4, b_min_x4));
+    }
+#elif defined(MCUT_OIBVH_NEON)
+    inline uint32x4_t intersect_node_aabbs_on_axis_x4(const oibvh_node_aabbs_t& a, const uint32_t a_nodes[4], const oibvh_node_aabbs_t& b, const uint32_t b_nodes[4], int axis)
+    {
+        const float* a_min = a.minimum(axis);
+        const float* a_max = a.maximum(axis);
+        const float* b_min = b.minimum(axis);
+        const float* b_max = b.maximum(axis);
+        const float a_min_x4[4] = { a_min[a_nodes[0]], a_min[a_nodes[1]], a_min[a_nodes[2]], a_min[a_nodes[3]] };
+        const float a_max_x4[4] = { a_max[a_nodes[0]], a_max[a_nodes[1]], a_max[a_nodes[2]], a_max[a_nodes[3]] };
+        const float b_min_x4[4] = { b_min[b_nodes[0]], b_min[b_nodes[1]], b_min[b_nodes[2]], b_min[b_nodes[3]] };
+        const float b_max_x4[4] = { b_max[b_nodes[0]], b_max[b_nodes[1]], b_max[b_nodes[2]], b_max[b_nodes[3]] };
+        return vandq_u32(vcleq_f32(vld1q_f32(a_min_x4), vld1q_f32(b_max_x4)), vcgeq_f32(vld1q_f32(a_max_x4), vld1q_f32(b_min_x4)));
+    }
+#endif
+
+    // Test the boxes of the node pairs ("a_nodes[i]", "b_nodes[i]") for overlap, and return a bitmask of the pairs whose
+    // boxes overlap (bit "i" for pair "i").
+    inline uint32_t intersect_node_aabbs_x4(const oibvh_node_aabbs_t& a, const uint32_t a_nodes[4], const oibvh_node_aabbs_t& b, const uint32_t b_nodes[4])
+    {
+#if defined(MCUT_OIBVH_SSE)
+        const __m128 overlap = _mm_and_ps(
+            _mm_and_ps(
+                intersect_node_aabbs_on_axis_x4(a, a_nodes, b, b_nodes, 0),
+                intersect_node_aabbs_on_axis_x4(a, a_nodes, b, b_nodes, 1)),
+            intersect_node_aabbs_on_axis_x4(a, a_nodes, b, b_nodes, 2));
+        return (uint32_t)_mm_movemask_ps(overlap);
+#elif defined(MCUT_OIBVH_NEON)
+        const uint32x4_t overlap = vandq_u32(
+            vandq_u32(
+                intersect_node_aabbs_on_axis_x4(a, a_nodes, b, b_nodes, 0),
+                intersect_node_aabbs_on_axis_x4(a, a_nodes, b, b_nodes, 1)),
+            intersect_node_aabbs_on_axis_x4(a, a_nodes, b, b_nodes, 2));
+        return (vgetq_lane_u32(overlap, 0) & 1) | (vgetq_lane_u32(overlap, 1) & 2) | (vgetq_lane_u32(overlap, 2) & 4) | (vgetq_lane_u32(overlap, 3) & 8);
+#else
+        uint32_t overlap_mask = 0;
+
+        for (int i = 0; i < 4; ++i) {
+            bool overlap = true;
+
+            for (int axis = 0; axis < 3; ++axis) {
+                overlap = overlap && a.minimum(axis)[a_nodes[i]] <= b.maximum(axis)[b_nodes[i]] && a.maximum(axis)[a_nodes[i]] >= b.minimum(axis)[b_nodes[i]];
+            }
+
+            overlap_mask |= (overlap ? (1u << i) : 0u);
+        }
+
+        return overlap_mask;
+#endif
+    }
+
+    // Test the boxes "boxes_minimum[.][i]"/"boxes_maximum[.][i]" for overlap with a box, and return a bitmask of the
+    // boxes that overlap it (bit "i" for box "i").
+    inline uint32_t intersect_aabbs_1x4(const float boxes_minimum[3][4], const float boxes_maximum[3][4], const float box_minimum[3], const float box_maximum[3])
+    {
+#if defined(MCUT_OIBVH_SSE)
+        __m128 overlap = _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(boxes_minimum[0]), _mm_set1_ps(box_maximum[0])), _mm_cmpge_ps(_mm_loadu_ps(boxes_maximum[0]), _mm_set1_ps(box_minimum[0])));
+
+        for (int axis = 1; axis < 3; ++axis) {
+            overlap = _mm_and_ps(overlap, _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(boxes_minimum[axis]), _mm_set1_ps(box_maximum[axis])), _mm_cmpge_ps(_mm_loadu_ps(boxes_maximum[axis]), _mm_set1_ps(box_minimum[axis]))));
+        }
+
+        return (uint32_t)_mm_movemask_ps(overlap);
+#elif defined(MCUT_OIBVH_NEON)
+        uint32x4_t overlap = vandq_u32(vcleq_f32(vld1q_f32(boxes_minimum[0]), vdupq_n_f32(box_maximum[0])), vcgeq_f32(vld1q_f32(boxes_maximum[0]), vdupq_n_f32(box_minimum[0])));
+
+        for (int axis = 1; axis < 3; ++axis) {
+            overlap = vandq_u32(overlap, vandq_u32(vcleq_f32(vld1q_f32(boxes_minimum[axis]), vdupq_n_f32(box_maximum[axis])), vcgeq_f32(vld1q_f32(boxes_maximum[axis]), vdupq_n_f32(box_minimum[axis]))));
+        }
+
+        return (vgetq_lane_u32(overlap, 0) & 1) | (vgetq_lane_u32(overlap, 1) & 2) | (vgetq_lane_u32(overlap, 2) & 4) | (vgetq_lane_u32(overlap, 3) & 8);
+#else
+        uint32_t overlap_mask = 0;
+
+        for (int i = 0; i < 4; ++i) {
+            bool overlap = true;
+
+            for (int axis = 0; axis < 3; ++axis) {
+                overlap = overlap && boxes_minimum[axis][i] <= box_maximum[axis] && boxes_maximum[axis][i] >= box_minimum[axis];
+            }
+
+            overlap_mask |= (overlap ? (1u << i) : 0u);
+        }
+
+        return overlap_mask;
+#endif
+    }
+
+    // get the node itself (if it is a leaf) or its children, with their memory indices
+    int get_oibvh_node_or_children(
+        const int node_implicit_idx,
+        const int bvh_leaf_level_idx,
+        const int bvh_rightmost_real_leaf,
+        int implicit_idx[2],
+        uint32_t mem_idx[2])
+    {
+        const int node_level_idx = get_level_from_implicit_idx(node_implicit_idx);
+
+        if (node_level_idx == bvh_leaf_level_idx) {
+            implicit_idx[0] = node_implicit_idx;
+            mem_idx[0] = (uint32_t)get_node_mem_index(
+                node_implicit_idx,
+                get_level_leftmost_node(node_level_idx),
+                0,
+                get_level_rightmost_real_node(bvh_rightmost_real_leaf, bvh_leaf_level_idx, node_level_idx));
+            return 1;
+        }
+
+        const int left_child_implicit_idx = (node_implicit_idx * 2) + 1;
+        const int right_child_implicit_idx = (node_implicit_idx * 2) + 2;
+        const int rightmost_real_node_on_child_level = get_level_rightmost_real_node(bvh_rightmost_real_leaf, bvh_leaf_level_idx, node_level_idx + 1);
+
+        implicit_idx[0] = left_child_implicit_idx;
+        mem_idx[0] = (uint32_t)get_node_mem_index(
+            left_child_implicit_idx,
+            get_level_leftmost_node(node_level_idx + 1),
             0,
-            cs_bvh_node_level_rightmost_node);
-        cs_bvh_node_bbox = SAFE_ACCESS(cutMeshBvhAABBs, cs_bvh_node_mem_idx);
+            rightmost_real_node_on_child_level);
 
-        if (cs_bvh_node_is_leaf)
-        {
-            const int cs_bvh_node_idx_on_level = cs_bvh_node_implicit_idx - cs_bvh_node_level_leftmost_node;
-            cs_node_face = SAFE_ACCESS(cutMeshBvhLeafNodeFaces, cs_bvh_node_idx_on_level);
+        if (right_child_implicit_idx > rightmost_real_node_on_child_level) {
+            return 1;
         }
 
-        const bool haveOverlap = intersect_bounding_boxes(sm_bvh_node_bbox, cs_bvh_node_bbox);
+        // NOTE: the right child is next to the left child in memory
+        implicit_idx[1] = right_child_implicit_idx;
+        mem_idx[1] = mem_idx[0] + 1;
+        return 2;
+    }
 
-        if (haveOverlap)
+    // Simultaneous traversal of the (implicit) source-mesh and cut-mesh BVH
+    class oibvh_traversal_t {
+        const oibvh_node_aabbs_t& m_sm_bvh_aabbs;
+        const std::vector<fd_t>& m_sm_bvh_leaf_faces;
+        const oibvh_node_aabbs_t& m_cs_bvh_aabbs;
+        const std::vector<fd_t>& m_cs_bvh_leaf_faces;
+        const int m_sm_bvh_leaf_level_idx;
+        const int m_cs_bvh_leaf_level_idx;
+        const int m_sm_bvh_rightmost_real_leaf;
+        const int m_cs_bvh_rightmost_real_leaf;
+
+    public:
+        typedef node_pair_t node_pair_type;
+
+        oibvh_traversal_t(
+            const oibvh_node_aabbs_t& srcMeshBvhAABBs,
+            const std::vector<fd_t>& srcMeshBvhLeafNodeFaces,
+            const oibvh_node_aabbs_t& cutMeshBvhAABBs,
+            const std::vector<fd_t>& cutMeshBvhLeafNodeFaces)
+            : m_sm_bvh_aabbs(srcMeshBvhAABBs)
+            , m_sm_bvh_leaf_faces(srcMeshBvhLeafNodeFaces)
+            , m_cs_bvh_aabbs(cutMeshBvhAABBs)
+            , m_cs_bvh_leaf_faces(cutMeshBvhLeafNodeFaces)
+            , m_sm_bvh_leaf_level_idx(get_leaf_level_from_real_leaf_count((int)srcMeshBvhLeafNodeFaces.size()))
+            , m_cs_bvh_leaf_level_idx(get_leaf_level_from_real_leaf_count((int)cutMeshBvhLeafNodeFaces.size()))
+            , m_sm_bvh_rightmost_real_leaf(get_rightmost_real_leaf(m_sm_bvh_leaf_level_idx, (int)srcMeshBvhLeafNodeFaces.size()))
+            , m_cs_bvh_rightmost_real_leaf(get_rightmost_real_leaf(m_cs_bvh_leaf_level_idx, (int)cutMeshBvhLeafNodeFaces.size()))
         {
+        }
 
-            if (cs_bvh_node_is_leaf && sm_bvh_node_is_leaf)
-            {
-                MCUT_ASSERT(cs_node_face != hmesh_t::null_face());
-                MCUT_ASSERT(sm_node_face != hmesh_t::null_face());
+        void get_root_pairs(std::vector<node_pair_type>& node_pairs) const
+        {
+            const uint32_t roots[4] = { 0, 0, 0, 0 };
 
-                fd_t cs_node_face_offsetted = fd_t(cs_node_face + numSrcMeshFaces);
+            if (intersect_node_aabbs_x4(m_sm_bvh_aabbs, roots, m_cs_bvh_aabbs, roots) & 1) {
+                node_pairs.push_back({ 0, 0 });
+            }
+        }
 
-                ps_face_to_potentially_intersecting_others[sm_node_face].push_back(cs_node_face_offsetted);
-                ps_face_to_potentially_intersecting_others[cs_node_face_offsetted].push_back(sm_node_face);
+        // Given a node pair whose bounding boxes overlap, either add the pair of faces (if both nodes are leaves) to
+        // "face_pairs" (as source-mesh face and offsetted cut-mesh face), or add the pairs of their children whose
+        // bounding boxes overlap to "node_pairs".
+        void visit(const node_pair_t& node_pair, std::vector<node_pair_t>& node_pairs, std::vector<std::pair<fd_t, fd_t>>& face_pairs) const
+        {
+            // sm
+            int sm_implicit_idx[2];
+            uint32_t sm_mem_idx[2];
+            const int sm_node_count = get_oibvh_node_or_children(node_pair.m_left, m_sm_bvh_leaf_level_idx, m_sm_bvh_rightmost_real_leaf, sm_implicit_idx, sm_mem_idx);
+            const bool sm_bvh_node_is_leaf = sm_implicit_idx[0] == node_pair.m_left;
+
+            // cs
+            int cs_implicit_idx[2];
+            uint32_t cs_mem_idx[2];
+            const int cs_node_count = get_oibvh_node_or_children(node_pair.m_right, m_cs_bvh_leaf_level_idx, m_cs_bvh_rightmost_real_leaf, cs_implicit_idx, cs_mem_idx);
+            const bool cs_bvh_node_is_leaf = cs_implicit_idx[0] == node_pair.m_right;
+
+            if (sm_bvh_node_is_leaf && cs_bvh_node_is_leaf) {
+                const fd_t sm_node_face = SAFE_ACCESS(m_sm_bvh_leaf_faces, node_pair.m_left - get_level_leftmost_node(m_sm_bvh_leaf_level_idx));
+                const fd_t cs_node_face = SAFE_ACCESS(m_cs_bvh_leaf_faces, node_pair.m_right - get_level_leftmost_node(m_cs_bvh_leaf_level_idx));
+
+                face_pairs.push_back(std::make_pair(sm_node_face, fd_t(cs_node_face + (uint32_t)m_sm_bvh_leaf_faces.size())));
+                return;
             }
-            else if (sm_bvh_node_is_leaf && !cs_bvh_node_is_leaf)
-            {
-                MCUT_ASSERT(cs_node_face == hmesh_t::null_face());
-                MCUT_ASSERT(sm_node_face != hmesh_t::null_face());
 
-                const int cs_bvh_node_left_child_implicit_idx = (cs_bvh_node_implicit_idx * 2) + 1;
-                const int cs_bvh_node_right_child_implicit_idx = (cs_bvh_node_implicit_idx * 2) + 2;
+            // test the (at most four) pairs of children at once
+            int pair_sm_implicit_idx[4];
+            int pair_cs_implicit_idx[4];
+            uint32_t pair_sm_mem_idx[4];
+            uint32_t pair_cs_mem_idx[4];
+            int pair_count = 0;
+
+            for (int i = 0; i < sm_node_count; ++i) {
+                for (int j = 0; j < cs_node_count; ++j) {
+                    pair_sm_implicit_idx[pair_count] = sm_implicit_idx[i];
+                    pair_cs_implicit_idx[pair_count] = cs_implicit_idx[j];
+                    pair_sm_mem_idx[pair_count] = sm_mem_idx[i];
+                    pair_cs_mem_idx[pair_count] = cs_mem_idx[j];
+                    pair_count++;
+                }
+            }
 
-                const int rightmost_real_node_on_child_level = get_level_rightmost_real_node(cs_bvh_rightmost_real_leaf, cs_bvh_leaf_level_idx, cs_bvh_node_level_idx + 1);
-                const bool right_child_is_real = cs_bvh_node_right_child_implicit_idx <= rightmost_real_node_on_child_level;
+            for (int i = pair_count; i < 4; ++i) { // unused
+                pair_sm_mem_idx[i] = pair_sm_mem_idx[0];
+                pair_cs_mem_idx[i] = pair_cs_mem_idx[0];
+            }
 
-                traversalQueue.push({sm_bvh_node_implicit_idx, cs_bvh_node_left_child_implicit_idx});
+            const uint32_t overlap_mask = intersect_node_aabbs_x4(m_sm_bvh_aabbs, pair_sm_mem_idx, m_cs_bvh_aabbs, pair_cs_mem_idx);
 
-                if (right_child_is_real)
-                {
-                    traversalQueue.push({sm_bvh_node_implicit_idx, cs_bvh_node_right_child_implicit_idx});
+            for (int i = 0; i < pair_count; ++i) {
+                if (overlap_mask & (1u << i)) {
+                    node_pairs.push_back({ pair_sm_implicit_idx[i], pair_cs_implicit_idx[i] });
                 }
             }
-            else if (!sm_bvh_node_is_leaf && cs_bvh_node_is_leaf)
-            {
+        }
+    };
+
+    // a pair of (source-mesh) wide-BVH node and (cut-mesh) OIBVH node
+    struct wide_bvh_node_pair_t {
+        int32_t m_left; // see: wide_bvh_t::node_t::m_children
+        int m_right; // implicit index
+        float m_left_minimum[3];
+        float m_left_maximum[3];
+    };
+
+    // Simultaneous traversal of the source-mesh wide BVH and the (implicit) cut-mesh BVH
+    class wide_bvh_oibvh_traversal_t {
+        const wide_bvh_t& m_sm_bvh;
+        const oibvh_node_aabbs_t& m_cs_bvh_aabbs;
+        const std::vector<fd_t>& m_cs_bvh_leaf_faces;
+        const int m_cs_bvh_leaf_level_idx;
+        const int m_cs_bvh_rightmost_real_leaf;
+
+    public:
+        typedef wide_bvh_node_pair_t node_pair_type;
+
+        wide_bvh_oibvh_traversal_t(
+            const wide_bvh_t& srcMeshBvh,
+            const oibvh_node_aabbs_t& cutMeshBvhAABBs,
+            const std::vector<fd_t>& cutMeshBvhLeafNodeFaces)
+            : m_sm_bvh(srcMeshBvh)
+            , m_cs_bvh_aabbs(cutMeshBvhAABBs)
+            , m_cs_bvh_leaf_faces(cutMeshBvhLeafNodeFaces)
+            , m_cs_bvh_leaf_level_idx(get_leaf_level_from_real_leaf_count((int)cutMeshBvhLeafNodeFaces.size()))
+            , m_cs_bvh_rightmost_real_leaf(get_rightmost_real_leaf(m_cs_bvh_leaf_level_idx, (int)cutMeshBvhLeafNodeFaces.size()))
+        {
+        }
+
+        void get_root_pairs(std::vector<node_pair_type>& node_pairs) const
+        {
+            node_pair_type root_pair;
+            root_pair.m_left = m_sm_bvh.root();
+            root_pair.m_right = 0;
+            bool overlap = true;
+
+            for (int axis = 0; axis < 3; ++axis) {
+                root_pair.m_left_minimum[axis] = m_sm_bvh.root_minimum()[axis];
+                root_pair.m_left_maximum[axis] = m_sm_bvh.root_maximum()[axis];
+                overlap = overlap && root_pair.m_left_minimum[axis] <= m_cs_bvh_aabbs.maximum(axis)[0] && root_pair.m_left_maximum[axis] >= m_cs_bvh_aabbs.minimum(axis)[0];
+            }
+
+            if (overlap) {
+                node_pairs.push_back(root_pair);
+            }
+        }
+
+        // Given a node pair whose bounding boxes overlap, either add the pairs of faces whose bounding boxes overlap (if
+        // both nodes are leaves) to "face_pairs", or add the pairs of children of the larger (internal) node and the
+        // other node whose bounding boxes overlap to "node_pairs".
+        void visit(const node_pair_type& node_pair, std::vector<node_pair_type>& node_pairs, std::vector<std::pair<fd_t, fd_t>>& face_pairs) const
+        {
+            // cs
+            int cs_implicit_idx[2];
+            uint32_t cs_mem_idx[2];
+            const int cs_node_count = get_oibvh_node_or_children(node_pair.m_right, m_cs_bvh_leaf_level_idx, m_cs_bvh_rightmost_real_leaf, cs_implicit_idx, cs_mem_idx);
+            const bool cs_bvh_node_is_leaf = cs_implicit_idx[0] == node_pair.m_right;
+
+            // sm
+            const bool sm_bvh_node_is_leaf = node_pair.m_left < 0;
+
+            if (!sm_bvh_node_is_leaf || cs_bvh_node_is_leaf) {
+                // the box of the cs node
+                float cs_bvh_node_minimum[3];
+                float cs_bvh_node_maximum[3];
+                const uint32_t cs_bvh_node_mem_idx = cs_bvh_node_is_leaf ? cs_mem_idx[0] : (uint32_t)get_node_mem_index(node_pair.m_right, get_level_leftmost_node(get_level_from_implicit_idx(node_pair.m_right)), 0, get_level_rightmost_real_node(m_cs_bvh_rightmost_real_leaf, m_cs_bvh_leaf_level_idx, get_level_from_implicit_idx(node_pair.m_right)));
+                float sm_bvh_node_half_area = 0.f;
+                float cs_bvh_node_half_area = 0.f;
+
+                for (int axis = 0; axis < 3; ++axis) {
+                    cs_bvh_node_minimum[axis] = m_cs_bvh_aabbs.minimum(axis)[cs_bvh_node_mem_idx];
+                    cs_bvh_node_maximum[axis] = m_cs_bvh_aabbs.maximum(axis)[cs_bvh_node_mem_idx];
+                }
+
+                for (int axis = 0; axis < 3; ++axis) {
+                    const int next_axis = (axis + 1) % 3;
+                    sm_bvh_node_half_area += (node_pair.m_left_maximum[axis] - node_pair.m_left_minimum[axis]) * (node_pair.m_left_maximum[next_axis] - node_pair.m_left_minimum[next_axis]);
+                    cs_bvh_node_half_area += (cs_bvh_node_maximum[axis] - cs_bvh_node_minimum[axis]) * (cs_bvh_node_maximum[next_axis] - cs_bvh_node_minimum[next_axis]);
+                }
+
+                if (sm_bvh_node_is_leaf) { // ... and the cs node is a leaf
+                    const wide_bvh_t::leaf_t& leaf = m_sm_bvh.leaves()[~node_pair.m_left];
+                    const uint32_t overlap_mask = intersect_aabbs_1x4(leaf.m_minimum, leaf.m_maximum, cs_bvh_node_minimum, cs_bvh_node_maximum);
+                    const fd_t cs_node_face = SAFE_ACCESS(m_cs_bvh_leaf_faces, node_pair.m_right - get_level_leftmost_node(m_cs_bvh_leaf_level_idx));
+
+                    for (uint32_t i = 0; i < leaf.m_face_count; ++i) {
+                        if (overlap_mask & (1u << i)) {
+                            face_pairs.push_back(std::make_pair(leaf.m_faces[i], fd_t(cs_node_face + m_sm_bvh.number_of_faces())));
+                        }
+                    }
+
+                    return;
+                }
 
-                MCUT_ASSERT(cs_node_face != hmesh_t::null_face());
-                MCUT_ASSERT(sm_node_face == hmesh_t::null_face());
+                if (cs_bvh_node_is_leaf || sm_bvh_node_half_area >= cs_bvh_node_half_area) {
+                    const wide_bvh_t::node_t& node = m_sm_bvh.nodes()[node_pair.m_left];
+                    const uint32_t overlap_mask = intersect_aabbs_1x4(node.m_minimum, node.m_maximum, cs_bvh_node_minimum, cs_bvh_node_maximum);
 
-                const int sm_bvh_node_left_child_implicit_idx = (sm_bvh_node_implicit_idx * 2) + 1;
-                const int sm_bvh_node_right_child_implicit_idx = (sm_bvh_node_implicit_idx * 2) + 2;
+                    for (int i = 0; i < wide_bvh_t::width; ++i) {
+                        if (overlap_mask & (1u << i)) {
+                            node_pair_type child_pair;
+                            child_pair.m_left = node.m_children[i];
+                            child_pair.m_right = node_pair.m_right;
 
-                const int rightmost_real_node_on_child_level = get_level_rightmost_real_node(sm_bvh_rightmost_real_leaf, sm_bvh_leaf_level_idx, sm_bvh_node_level_idx + 1);
-                const bool right_child_is_real = sm_bvh_node_right_child_implicit_idx <= rightmost_real_node_on_child_level;
+                            for (int axis = 0; axis < 3; ++axis) {
+                                child_pair.m_left_minimum[axis] = node.m_minimum[axis][i];
+                                child_pair.m_left_maximum[axis] = node.m_maximum[axis][i];
+                            }
 
-                traversalQueue.push({sm_bvh_node_left_child_implicit_idx, cs_bvh_node_implicit_idx});
+                            node_pairs.push_back(child_pair);
+                        }
+                    }
 
-                if (right_child_is_real)
-                {
-                    traversalQueue.push({sm_bvh_node_right_child_implicit_idx, cs_bvh_node_implicit_idx});
+                    return;
                 }
             }
-            else
-            { // both nodes are internal
-                MCUT_ASSERT(cs_node_face == hmesh_t::null_face());
-                MCUT_ASSERT(sm_node_face == hmesh_t::null_face());
 
-                const int sm_bvh_node_left_child_implicit_idx = (sm_bvh_node_implicit_idx * 2) + 1;
-                const int sm_bvh_node_right_child_implicit_idx = (sm_bvh_node_implicit_idx * 2) + 2;
+            // descend the cs node
+            for (int i = 0; i < cs_node_count; ++i) {
+                bool overlap = true;
 
-                const int cs_bvh_node_left_child_implicit_idx = (cs_bvh_node_implicit_idx * 2) + 1;
-                const int cs_bvh_node_right_child_implicit_idx = (cs_bvh_node_implicit_idx * 2) + 2;
+                for (int axis = 0; axis < 3; ++axis) {
+                    overlap = overlap && node_pair.m_left_minimum[axis] <= m_cs_bvh_aabbs.maximum(axis)[cs_mem_idx[i]] && node_pair.m_left_maximum[axis] >= m_cs_bvh_aabbs.minimum(axis)[cs_mem_idx[i]];
+                }
 
-                const int sm_rightmost_real_node_on_child_level = get_level_rightmost_real_node(sm_bvh_rightmost_real_leaf, sm_bvh_leaf_level_idx, sm_bvh_node_level_idx + 1);
-                const bool sm_right_child_is_real = sm_bvh_node_right_child_implicit_idx <= sm_rightmost_real_node_on_child_level;
+                if (overlap) {
+                    node_pair_type child_pair = node_pair;
+                    child_pair.m_right = cs_implicit_idx[i];
+                    node_pairs.push_back(child_pair);
+                }
+            }
+        }
+    };
 
-                const int cs_rightmost_real_node_on_child_level = get_level_rightmost_real_node(cs_bvh_rightmost_real_leaf, cs_bvh_leaf_level_idx, cs_bvh_node_level_idx + 1);
-                const bool cs_right_child_is_real = cs_bvh_node_right_child_implicit_idx <= cs_rightmost_real_node_on_child_level;
+    // traverse the subtrees of the given node pairs (depth first)
+    template <typename traversal_type>
+    std::vector<std::pair<fd_t, fd_t>> traverse_depth_first(
+        const traversal_type& traversal,
+        typename std::vector<typename traversal_type::node_pair_type>::const_iterator first,
+        typename std::vector<typename traversal_type::node_pair_type>::const_iterator last)
+    {
+        std::vector<std::pair<fd_t, fd_t>> face_pairs;
+        std::vector<typename traversal_type::node_pair_type> node_pairs(first, last);
 
-                traversalQueue.push({sm_bvh_node_left_child_implicit_idx, cs_bvh_node_left_child_implicit_idx});
+        while (!node_pairs.empty()) {
+            const typename traversal_type::node_pair_type node_pair = node_pairs.back();
+            node_pairs.pop_back();
+            traversal.visit(node_pair, node_pairs, face_pairs);
+        }
+
+        return face_pairs;
+    }
+
+    // simultaneuosly traverse both BVHs to find the pairs of faces whose bounding boxes overlap
+    template <typename traversal_type>
+    void traverse_bvhs(
+#if defined(MCUT_MULTI_THREADED)
+        thread_pool& scheduler,
+        uint32_t serial_execution_threshold,
+#endif
+        const traversal_type& traversal,
+        const uint32_t num_ps_faces,
+        candidate_face_pairs_t& ps_face_to_potentially_intersecting_others)
+    {
+        typedef typename traversal_type::node_pair_type node_pair_type;
+
+        std::vector<node_pair_type> node_pairs; // left = sm BVH; right = cm BVH
+        traversal.get_root_pairs(node_pairs);
+        std::vector<std::pair<fd_t, fd_t>> face_pairs; // (sm face, offsetted cm face)
+
+#if defined(MCUT_MULTI_THREADED)
+        if (scheduler.get_num_threads() > 0 && num_ps_faces >= serial_execution_threshold) {
+            // the master thread expands the top levels (breadth first) until there are enough node pairs for the
+            // worker threads to traverse the rest of the BVHs from
+            const size_t frontier_size = (scheduler.get_num_threads() + 1) * 16;
+            std::vector<node_pair_type> next_node_pairs;
+
+            while (!node_pairs.empty() && node_pairs.size() < frontier_size) {
+                next_node_pairs.clear();
 
-                if (cs_right_child_is_real)
-                {
-                    traversalQueue.push({sm_bvh_node_left_child_implicit_idx, cs_bvh_node_right_child_implicit_idx});
+                for (typename std::vector<node_pair_type>::const_iterator it = node_pairs.cbegin(); it != node_pairs.cend(); ++it) {
+                    traversal.visit(*it, next_node_pairs, face_pairs);
                 }
 
-                if (sm_right_child_is_real)
-                {
-                    traversalQueue.push({sm_bvh_node_right_child_implicit_idx, cs_bvh_node_left_child_implicit_idx});
+                node_pairs.swap(next_node_pairs);
+            }
 
-                    if (cs_right_child_is_real)
-                    {
-                        traversalQueue.push({sm_bvh_node_right_child_implicit_idx, cs_bvh_node_right_child_implicit_idx});
-                    }
+            if (!node_pairs.empty()) { // i.e. the traversal did not already finish
+                typedef typename std::vector<node_pair_type>::const_iterator InputStorageIteratorType;
+                typedef std::vector<std::pair<fd_t, fd_t>> OutputStorageType; // face pairs (local)
+
+                auto fn_traverse = [&](InputStorageIteratorType block_start_, InputStorageIteratorType block_end_) -> OutputStorageType {
+                    return traverse_depth_first(traversal, block_start_, block_end_);
+                };
+
+                std::vector<std::future<OutputStorageType>> futures;
+                OutputStorageType partial_res;
+
+                parallel_fork_and_join(
+                    scheduler,
+                    0, // always fork since each node-pair is a whole sub-traversal
+                    node_pairs.cbegin(),
+                    node_pairs.cend(),
+                    (1 << 2),
+                    fn_traverse,
+                    partial_res, // output of master thread
+                    futures);
+
+                face_pairs.insert(face_pairs.end(), partial_res.cbegin(), partial_res.cend());
+
+                for (int i = 0; i < (int)futures.size(); ++i) {
+                    std::future<OutputStorageType>& f = futures[i];
+                    MCUT_ASSERT(f.valid());
+                    OutputStorageType future_res = f.get();
+
+                    face_pairs.insert(face_pairs.end(), future_res.cbegin(), future_res.cend());
                 }
             }
+        } else
+#endif // #if defined(MCUT_MULTI_THREADED)
+        {
+            face_pairs = traverse_depth_first(traversal, node_pairs.cbegin(), node_pairs.cend());
         }
 
-        traversalQueue.pop(); // rm ct_front_node
-    } while (!traversalQueue.empty());
+#if defined(MCUT_MULTI_THREADED)
+        const block_executor_t for_each_block(scheduler, serial_execution_threshold);
+#else
+        const block_executor_t for_each_block;
+#endif
+
+        ps_face_to_potentially_intersecting_others.build(for_each_block, num_ps_faces, face_pairs);
+    }
+} // namespace
+
+void intersectOIBVHs(
+#if defined(MCUT_MULTI_THREADED)
+    thread_pool& scheduler,
+    uint32_t serial_execution_threshold,
+#endif
+    candidate_face_pairs_t &ps_face_to_potentially_intersecting_others,
+    const oibvh_node_aabbs_t &srcMeshBvhAABBs,
+    const std::vector<fd_t> &srcMeshBvhLeafNodeFaces,
+    const oibvh_node_aabbs_t &cutMeshBvhAABBs,
+    const std::vector<fd_t> &cutMeshBvhLeafNodeFaces)
+{
+    TIMESTACK_PUSH(__FUNCTION__);
+
+    MCUT_ASSERT(srcMeshBvhLeafNodeFaces.size() >= 1);
+    MCUT_ASSERT(cutMeshBvhLeafNodeFaces.size() >= 1);
+    MCUT_ASSERT(ps_face_to_potentially_intersecting_others.empty());
+
+    const oibvh_traversal_t traversal(srcMeshBvhAABBs, srcMeshBvhLeafNodeFaces, cutMeshBvhAABBs, cutMeshBvhLeafNodeFaces);
+
+    traverse_bvhs(
+#if defined(MCUT_MULTI_THREADED)
+        scheduler,
+        serial_execution_threshold,
+#endif
+        traversal,
+        (uint32_t)(srcMeshBvhLeafNodeFaces.size() + cutMeshBvhLeafNodeFaces.size()),
+        ps_face_to_potentially_intersecting_others);
+
+    TIMESTACK_POP();
+}
+
+void intersectWideBVHAndOIBVH(
+#if defined(MCUT_MULTI_THREADED)
+    thread_pool& scheduler,
+    uint32_t serial_execution_threshold,
+#endif
+    candidate_face_pairs_t& ps_face_to_potentially_intersecting_others,
+    const wide_bvh_t& srcMeshBvh,
+    const oibvh_node_aabbs_t& cutMeshBvhAABBs,
+    const std::vector<fd_t>& cutMeshBvhLeafNodeFaces)
+{
+    TIMESTACK_PUSH(__FUNCTION__);
+
+    MCUT_ASSERT(!srcMeshBvh.empty());
+    MCUT_ASSERT(cutMeshBvhLeafNodeFaces.size() >= 1);
+    MCUT_ASSERT(ps_face_to_potentially_intersecting_others.empty());
+
+    const wide_bvh_oibvh_traversal_t traversal(srcMeshBvh, cutMeshBvhAABBs, cutMeshBvhLeafNodeFaces);
+
+    traverse_bvhs(
+#if defined(MCUT_MULTI_THREADED)
+        scheduler,
+        serial_execution_threshold,
+#endif
+        traversal,
+        (uint32_t)(srcMeshBvh.number_of_faces() + cutMeshBvhLeafNodeFaces.size()),
+        ps_face_to_potentially_intersecting_others);
+
     TIMESTACK_POP();
 }
 #else
@@ -839,7 +1653,7 @@ void intersectOIBVHs(
 #if defined(MCUT_MULTI_THREADED)
         thread_pool& scheduler,
 #endif
-        std::map<fd_t, std::vector<fd_t>>& symmetric_intersecting_pairs,
+        candidate_face_pairs_t& symmetric_intersecting_pairs,
         const BoundingVolumeHierarchy& bvhA,
         const BoundingVolumeHierarchy& bvhB,
         const uint32_t primitiveOffsetA,
@@ -851,7 +1665,7 @@ void intersectOIBVHs(
 
         auto fn_intersectBVHTrees = [&bvhA, &bvhB, &primitiveOffsetA, &primitiveOffsetB](
                                         std::vector<std::pair<int, int>>& worklist_,
-                                        std::map<fd_t, std::vector<fd_t>>& symmetric_intersecting_pairs_,
+                                        std::vector<std::pair<fd_t, fd_t>>& intersecting_pairs_,
                                         const uint32_t maxWorklistSize) {
             // Simultaneous DFS traversal
             while (worklist_.size() > 0 && worklist_.size() < maxWorklistSize) {
@@ -884,8 +1698,7 @@ void intersectOIBVHs(
                                 const fd_t faceB = bvhB.GetPrimitive((uint32_t)(nodeB->primitivesOffset + j));
                                 const fd_t faceBOffsetted(primitiveOffsetB + faceB);
 
-                                symmetric_intersecting_pairs_[faceAOffsetted].push_back(faceBOffsetted);
-                                symmetric_intersecting_pairs_[faceBOffsetted].push_back(faceAOffsetted);
+                                intersecting_pairs_.push_back(std::make_pair(faceAOffsetted, faceBOffsetted));
                             }
                         }
                     } else {
@@ -919,6 +1732,7 @@ void intersectOIBVHs(
 
         // start with pair of root nodes
         std::vector<std::pair<int, int>> todo(1, std::make_pair(0, 0));
+        std::vector<std::pair<fd_t, fd_t>> intersecting_pairs;
 
 #if defined(MCUT_MULTI_THREADED)
         {
@@ -926,27 +1740,27 @@ void intersectOIBVHs(
             // reaches a threshold (or workload was small enough that traversal
             // is finished)
             const uint32_t threshold = scheduler.get_num_threads();
-            fn_intersectBVHTrees(todo, symmetric_intersecting_pairs, threshold);
+            fn_intersectBVHTrees(todo, intersecting_pairs, threshold);
 
             uint32_t remainingWorkloadCount = (uint32_t)todo.size(); // how much work do we still have left
 
             if (remainingWorkloadCount > 0) { // do parallel traversal by distributing blocks of node-pairs across worker threads
                 // NOTE: we do not manage load-balancing (too complex for the perf gain)
                 typedef std::vector<std::pair<int, int>>::const_iterator InputStorageIteratorType;
-                typedef std::map<fd_t, std::vector<fd_t>> OutputStorageType; // symmetric_intersecting_pairs (local)
+                typedef std::vector<std::pair<fd_t, fd_t>> OutputStorageType; // intersecting_pairs (local)
 
                 auto fn_intersect = [&](InputStorageIteratorType block_start_, InputStorageIteratorType block_end_) -> OutputStorageType {
-                    OutputStorageType symmetric_intersecting_pairs_local;
+                    OutputStorageType intersecting_pairs_local;
 
                     std::vector<std::pair<int, int>> todo_local(block_start_, block_end_);
 
                     fn_intersectBVHTrees(
                         todo_local,
-                        symmetric_intersecting_pairs_local,
+                        intersecting_pairs_local,
                         // traverse until leaves
                         std::numeric_limits<uint32_t>::max());
 
-                    return symmetric_intersecting_pairs_local;
+                    return intersecting_pairs_local;
                 };
 
                 std::vector<std::future<OutputStorageType>> futures;
@@ -954,6 +1768,7 @@ void intersectOIBVHs(
 
                 parallel_fork_and_join(
                     scheduler,
+                    0, // always fork since each node-pair is a whole sub-traversal
                     todo.cbegin(),
                     todo.cend(),
                     (1 << 1),
@@ -961,20 +1776,31 @@ void intersectOIBVHs(
                     partial_res, // output of master thread
                     futures);
 
-                symmetric_intersecting_pairs.insert(partial_res.cbegin(), partial_res.cend());
+                intersecting_pairs.insert(intersecting_pairs.end(), partial_res.cbegin(), partial_res.cend());
 
                 for (int i = 0; i < (int)futures.size(); ++i) {
                     std::future<OutputStorageType>& f = futures[i];
                     MCUT_ASSERT(f.valid());
                     OutputStorageType future_res = f.get();
 
-                    symmetric_intersecting_pairs.insert(future_res.cbegin(), future_res.cend());
+                    intersecting_pairs.insert(intersecting_pairs.end(), future_res.cbegin(), future_res.cend());
                 }
             }
         }
 #else
-        fn_intersectBVHTrees(todo, symmetric_intersecting_pairs, std::numeric_limits<uint32_t>::max());
+        fn_intersectBVHTrees(todo, intersecting_pairs, std::numeric_limits<uint32_t>::max());
 #endif // #if defined(MCUT_MULTI_THREADED)
+
+#if defined(MCUT_MULTI_THREADED)
+        const block_executor_t for_each_block(scheduler, 0);
+#else
+        const block_executor_t for_each_block;
+#endif
+
+        symmetric_intersecting_pairs.build(
+            for_each_block,
+            (uint32_t)(std::max(primitiveOffsetA + bvhA.primitives.size(), primitiveOffsetB + bvhB.primitives.size())),
+            intersecting_pairs);
     }
 
 #endif
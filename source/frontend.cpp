@@ -7,6 +7,7 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <fstream>
 
 #include <memory>
@@ -20,29 +21,127 @@
 
 #if defined(MCUT_MULTI_THREADED)
 #include "mcut/internal/tpool.h"
-std::atomic_bool thread_pool_terminate(false);
+
+// return the process-wide thread pool, which is created on first use and destroyed
+// when the last context that uses it is released
+std::shared_ptr<thread_pool> get_shared_thread_pool()
+{
+    static std::mutex shared_thread_pool_mutex;
+    static std::weak_ptr<thread_pool> shared_thread_pool;
+
+    std::lock_guard<std::mutex> lock(shared_thread_pool_mutex);
+
+    std::shared_ptr<thread_pool> pool = shared_thread_pool.lock();
+
+    if (pool == nullptr) {
+        pool = std::make_shared<thread_pool>(std::max(std::thread::hardware_concurrency(), 1u));
+        shared_thread_pool = pool;
+    }
+
+    return pool;
+}
 #endif
 
 #if defined(PROFILING_BUILD)
-std::stack<std::unique_ptr<mini_timer>> g_timestack = std::stack<std::unique_ptr<mini_timer>>();
+thread_local std::stack<std::unique_ptr<mini_timer>> g_timestack = std::stack<std::unique_ptr<mini_timer>>();
 #endif
 
+thread_local dispatch_stats_t* g_dispatch_stats = nullptr;
+
+// Collects the statistics of the dispatch call made on the current thread during the
+// lifetime of this object, and then stores them in the context. Does nothing unless the
+// context was created with MC_PROFILING_ENABLE.
+class scoped_dispatch_stats_t {
+    context_t& m_context;
+    const bool m_enabled;
+    dispatch_stats_t m_stats;
+    // NOTE: a thread that waits on its own dispatch may run (all of) another dispatch
+    dispatch_stats_t* m_outer_stats;
+    std::chrono::time_point<std::chrono::steady_clock> m_start;
+
+public:
+    explicit scoped_dispatch_stats_t(context_t& context)
+        : m_context(context)
+        , m_enabled((context.flags & MC_PROFILING_ENABLE) != 0)
+        , m_outer_stats(g_dispatch_stats)
+        , m_start(std::chrono::steady_clock::now())
+    {
+        if (m_enabled) {
+            g_dispatch_stats = &m_stats;
+        }
+    }
+
+    ~scoped_dispatch_stats_t()
+    {
+        if (m_enabled) {
+            g_dispatch_stats = m_outer_stats;
+
+            m_stats.total_duration_ns = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start).count();
+            m_stats.running_stages.clear(); // i.e. if the dispatch failed
+
+            std::lock_guard<std::mutex> lock(m_context.dispatch_stats_mutex);
+            m_context.dispatch_stats = std::move(m_stats);
+        }
+    }
+};
+
 std::map<McContext, std::unique_ptr<context_t>> g_contexts = {};
+reader_writer_lock_t g_contexts_lock;
+
+std::unique_ptr<context_t>& get_context(McContext context)
+{
+    g_contexts_lock.lock_shared();
+
+    std::map<McContext, std::unique_ptr<context_t>>::iterator context_entry_iter = g_contexts.find(context);
+    const bool context_found = context_entry_iter != g_contexts.end();
+
+    g_contexts_lock.unlock_shared();
+
+    if (!context_found) {
+        // "context" may not be NULL but that does not mean it maps to
+        // a valid object in "g_contexts"
+        throw std::invalid_argument("invalid context");
+    }
+
+    // NOTE: references to map elements are not invalidated by the insertion
+    // or removal of other elements
+    return context_entry_iter->second;
+}
 
-void create_context_impl(McContext* pOutContext, McFlags flags)
+void create_context_impl(McContext* pOutContext, McFlags flags, uint32_t num_helper_threads)
 {
     MCUT_ASSERT(pOutContext != nullptr);
 
-    // allocate internal context object (including associated threadpool etc.)
+    // allocate internal context object
     std::unique_ptr<context_t> context_uptr = std::unique_ptr<context_t>(new context_t());
 
     // copy context configuration flags
     context_uptr->flags = flags;
 
+    if (flags & MC_TRACING_ENABLE) {
+        context_uptr->trace = std::unique_ptr<trace_t>(new trace_t());
+    }
+
+#if defined(MCUT_MULTI_THREADED)
+    if (flags & MC_CONTEXT_SHARED_THREAD_POOL) {
+        context_uptr->scheduler = get_shared_thread_pool();
+    } else {
+        // NOTE: zero means no helper threads i.e. the context does all its work on the calling thread
+        context_uptr->scheduler = std::make_shared<thread_pool>(num_helper_threads);
+    }
+#else
+    (void)num_helper_threads;
+#endif
+
     // create handle (ptr) which will be returned and used by client to access rest of API
     const McContext handle = reinterpret_cast<McContext>(context_uptr.get());
 
-    const std::pair<std::map<McContext, std::unique_ptr<context_t>>::iterator, bool> insertion_result = g_contexts.emplace(handle, std::move(context_uptr));
+    std::pair<std::map<McContext, std::unique_ptr<context_t>>::iterator, bool> insertion_result;
+
+    {
+        std::lock_guard<reader_writer_lock_t> lock(g_contexts_lock);
+        insertion_result = g_contexts.emplace(handle, std::move(context_uptr));
+    }
 
     const bool context_inserted_ok = insertion_result.second;
 
@@ -65,15 +164,7 @@ void debug_message_callback_impl(
     MCUT_ASSERT(contextHandle != nullptr);
     MCUT_ASSERT(cb != nullptr);
 
-    std::map<McContext, std::unique_ptr<context_t>>::iterator context_entry_iter = g_contexts.find(contextHandle);
-
-    if (context_entry_iter == g_contexts.end()) {
-        // "contextHandle" may not be NULL but that does not mean it maps to
-        // a valid object in "g_contexts"
-        throw std::invalid_argument("invalid context");
-    }
-
-    const std::unique_ptr<context_t>& context_uptr = context_entry_iter->second;
+    const std::unique_ptr<context_t>& context_uptr = get_context(contextHandle);
 
     // set callback function ptr, and user pointer
     context_uptr->debugCallback = cb;
@@ -127,13 +218,7 @@ void debug_message_control_impl(
     McDebugSeverity severity,
     bool enabled)
 {
-    std::map<McContext, std::unique_ptr<context_t>>::iterator context_entry_iter = g_contexts.find(contextHandle);
-
-    if (context_entry_iter == g_contexts.end()) {
-        throw std::invalid_argument("invalid context");
-    }
-
-    const std::unique_ptr<context_t>& context_uptr = context_entry_iter->second;
+    const std::unique_ptr<context_t>& context_uptr = get_context(contextHandle);
 
     // reset
     context_uptr->debugSource = 0;
@@ -179,13 +264,7 @@ void get_info_impl(
     void* pMem,
     uint64_t* pNumBytes)
 {
-    std::map<McContext, std::unique_ptr<context_t>>::iterator context_entry_iter = g_contexts.find(context);
-
-    if (context_entry_iter == g_contexts.end()) {
-        throw std::invalid_argument("invalid context");
-    }
-
-    const std::unique_ptr<context_t>& context_uptr = context_entry_iter->second;
+    const std::unique_ptr<context_t>& context_uptr = get_context(context);
 
     switch (info) {
     case MC_CONTEXT_FLAGS:
@@ -195,14 +274,151 @@ void get_info_impl(
             memcpy(pMem, reinterpret_cast<void*>(&context_uptr->flags), bytes);
         }
         break;
+    case MC_CONTEXT_SERIAL_EXECUTION_THRESHOLD:
+        if (pMem == nullptr) {
+            *pNumBytes = sizeof(uint32_t);
+        } else {
+            const uint32_t threshold = context_uptr->serial_execution_threshold.load();
+            memcpy(pMem, reinterpret_cast<const void*>(&threshold), bytes);
+        }
+        break;
+    case MC_CONTEXT_HELPER_THREAD_COUNT:
+        if (pMem == nullptr) {
+            *pNumBytes = sizeof(uint32_t);
+        } else {
+#if defined(MCUT_MULTI_THREADED)
+            const uint32_t num_helper_threads = (uint32_t)context_uptr->scheduler->get_num_threads();
+#else
+            const uint32_t num_helper_threads = 0;
+#endif
+            memcpy(pMem, reinterpret_cast<const void*>(&num_helper_threads), bytes);
+        }
+        break;
+    case MC_CONTEXT_DISPATCH_STATS:
+        if ((context_uptr->flags & MC_PROFILING_ENABLE) == 0) {
+            throw std::runtime_error("context created without MC_PROFILING_ENABLE");
+        }
+
+        if (pMem == nullptr) {
+            *pNumBytes = sizeof(McDispatchStats);
+        } else {
+            std::lock_guard<std::mutex> lock(context_uptr->dispatch_stats_mutex);
+            const dispatch_stats_t& stats = context_uptr->dispatch_stats;
+
+            McDispatchStats dispatch_stats;
+            dispatch_stats.totalTimeNanoseconds = stats.total_duration_ns;
+            dispatch_stats.perturbationCount = stats.perturbation_count;
+            dispatch_stats.floatingPolygonRestartCount = stats.floating_polygon_restart_count;
+            dispatch_stats.bvhCandidatePairCount = stats.bvh_candidate_pair_count;
+            dispatch_stats.peakVertexCount = stats.peak_vertex_count;
+            dispatch_stats.peakEdgeCount = stats.peak_edge_count;
+            dispatch_stats.peakFaceCount = stats.peak_face_count;
+            dispatch_stats.stageCount = (uint32_t)stats.stages.size();
+
+            memcpy(pMem, reinterpret_cast<const void*>(&dispatch_stats), bytes);
+        }
+        break;
+    case MC_CONTEXT_DISPATCH_STAGE_TIMES: {
+        if ((context_uptr->flags & MC_PROFILING_ENABLE) == 0) {
+            throw std::runtime_error("context created without MC_PROFILING_ENABLE");
+        }
+
+        std::lock_guard<std::mutex> lock(context_uptr->dispatch_stats_mutex);
+        const dispatch_stats_t& stats = context_uptr->dispatch_stats;
+        const uint64_t num_bytes = stats.stages.size() * sizeof(McDispatchStageTime);
+
+        if (pMem == nullptr) {
+            *pNumBytes = num_bytes;
+        } else {
+            if (bytes > num_bytes || (bytes % sizeof(McDispatchStageTime)) != 0) {
+                throw std::invalid_argument("invalid byte size");
+            }
+
+            McDispatchStageTime* stage_times = reinterpret_cast<McDispatchStageTime*>(pMem);
+
+            for (uint32_t i = 0; i < (uint32_t)(bytes / sizeof(McDispatchStageTime)); ++i) {
+                const dispatch_stats_t::stage_t& stage = stats.stages[i];
+                McDispatchStageTime& stage_time = stage_times[i];
+                strncpy(stage_time.name, stage.name, sizeof(stage_time.name) - 1);
+                stage_time.name[sizeof(stage_time.name) - 1] = '\0';
+                stage_time.durationNanoseconds = stage.duration_ns;
+                stage_time.callCount = stage.call_count;
+                stage_time.depth = stage.depth;
+            }
+        }
+    } break;
+    case MC_CONTEXT_TRACE: {
+        if (!context_uptr->trace) {
+            throw std::runtime_error("context created without MC_TRACING_ENABLE");
+        }
+
+        const std::string json = context_uptr->trace->to_json();
+
+        if (pMem == nullptr) {
+            *pNumBytes = json.size() + 1; // i.e. including the null terminator
+        } else {
+            // NOTE: the trace may have grown since its size was queried
+            const size_t num_chars = std::min((size_t)bytes - 1, json.size());
+            memcpy(pMem, json.c_str(), num_chars);
+            reinterpret_cast<char*>(pMem)[num_chars] = '\0';
+        }
+    } break;
     default:
         throw std::invalid_argument("unknown info parameter");
         break;
     }
 }
 
-void dispatch_impl(
-    McContext context,
+void set_context_property_impl(
+    const McContext context,
+    McFlags property,
+    uint64_t bytes,
+    const void* pMem)
+{
+    const std::unique_ptr<context_t>& context_uptr = get_context(context);
+
+    switch (property) {
+    case MC_CONTEXT_SERIAL_EXECUTION_THRESHOLD: {
+        uint32_t threshold = 0;
+        memcpy(reinterpret_cast<void*>(&threshold), pMem, bytes);
+        // NOTE: dispatch calls that are already running keep using the previous value
+        context_uptr->serial_execution_threshold.store(threshold);
+    } break;
+    case MC_CONTEXT_TRACE_FILE: {
+        if (!context_uptr->trace) {
+            throw std::runtime_error("context created without MC_TRACING_ENABLE");
+        }
+
+        const std::string path(reinterpret_cast<const char*>(pMem), (size_t)bytes - 1); // i.e. without null terminator
+
+        if (!std::ofstream(path.c_str())) {
+            throw std::invalid_argument("cannot write to trace file");
+        }
+
+        context_uptr->trace_file_path = path;
+    } break;
+    default:
+        throw std::invalid_argument("unknown property parameter");
+        break;
+    }
+}
+
+// move the connected components computed by a dispatch call into the context
+void merge_connected_components(
+    std::unique_ptr<context_t>& context_uptr,
+    std::map<McConnectedComponent, std::unique_ptr<connected_component_t, void (*)(connected_component_t*)>>& connected_components)
+{
+    std::lock_guard<std::mutex> lock(context_uptr->connected_components_mutex);
+
+    for (std::map<McConnectedComponent, std::unique_ptr<connected_component_t, void (*)(connected_component_t*)>>::iterator i = connected_components.begin();
+         i != connected_components.end();
+         ++i) {
+        context_uptr->connected_components.emplace(i->first, std::move(i->second));
+    }
+}
+
+void dispatch_arrays(
+    std::unique_ptr<context_t>& context_uptr,
     McFlags flags,
     const void* pSrcMeshVertices,
     const uint32_t* pSrcMeshFaceIndices,
@@ -215,18 +431,57 @@ void dispatch_impl(
     uint32_t numCutMeshVertices,
     uint32_t numCutMeshFaces)
 {
-    std::map<McContext, std::unique_ptr<context_t>>::iterator context_entry_iter = g_contexts.find(context);
+    scoped_trace_t trace_scope(context_uptr->trace.get(), "mcDispatch");
+    scoped_dispatch_stats_t dispatch_stats(*context_uptr);
 
-    if (context_entry_iter == g_contexts.end()) {
-        throw std::invalid_argument("invalid context");
-    }
+    mesh_t source_mesh;
 
-    std::unique_ptr<context_t>& context_uptr = context_entry_iter->second;
+    preproc_mesh(
+        context_uptr,
+        source_mesh,
+        flags,
+        pSrcMeshVertices,
+        pSrcMeshFaceIndices,
+        pSrcMeshFaceSizes,
+        numSrcMeshVertices,
+        numSrcMeshFaces);
 
-    context_uptr->dispatchFlags = flags;
+    std::map<McConnectedComponent, std::unique_ptr<connected_component_t, void (*)(connected_component_t*)>> connected_components;
 
     preproc(
         context_uptr,
+        connected_components,
+        flags,
+        source_mesh,
+        false,
+        pCutMeshVertices,
+        pCutMeshFaceIndices,
+        pCutMeshFaceSizes,
+        numCutMeshVertices,
+        numCutMeshFaces);
+
+    merge_connected_components(context_uptr, connected_components);
+}
+
+void dispatch_impl(
+    McContext context,
+    McFlags flags,
+    const void* pSrcMeshVertices,
+    const uint32_t* pSrcMeshFaceIndices,
+    const uint32_t* pSrcMeshFaceSizes,
+    uint32_t numSrcMeshVertices,
+    uint32_t numSrcMeshFaces,
+    const void* pCutMeshVertices,
+    const uint32_t* pCutMeshFaceIndices,
+    const uint32_t* pCutMeshFaceSizes,
+    uint32_t numCutMeshVertices,
+    uint32_t numCutMeshFaces)
+{
+    std::unique_ptr<context_t>& context_uptr = get_context(context);
+
+    dispatch_arrays(
+        context_uptr,
+        flags,
         pSrcMeshVertices,
         pSrcMeshFaceIndices,
         pSrcMeshFaceSizes,
@@ -239,6 +494,517 @@ void dispatch_impl(
         numCutMeshFaces);
 }
 
+uint64_t get_timestamp_ns()
+{
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void enqueue_dispatch_impl(
+    McContext context,
+    McFlags flags,
+    const void* pSrcMeshVertices,
+    const uint32_t* pSrcMeshFaceIndices,
+    const uint32_t* pSrcMeshFaceSizes,
+    uint32_t numSrcMeshVertices,
+    uint32_t numSrcMeshFaces,
+    const void* pCutMeshVertices,
+    const uint32_t* pCutMeshFaceIndices,
+    const uint32_t* pCutMeshFaceSizes,
+    uint32_t numCutMeshVertices,
+    uint32_t numCutMeshFaces,
+    pfn_McEvent_CALLBACK pfnNotify,
+    void* pUserData,
+    McEvent* pEvent)
+{
+    MCUT_ASSERT(pEvent != nullptr);
+
+    std::unique_ptr<context_t>& context_uptr = get_context(context);
+
+    std::unique_ptr<event_t> event_uptr = std::unique_ptr<event_t>(new event_t());
+
+    event_uptr->callback = pfnNotify;
+    event_uptr->callback_user_data = pUserData;
+    event_uptr->timestamp_submit.store(get_timestamp_ns());
+
+    const McEvent handle = reinterpret_cast<McEvent>(event_uptr.get());
+    event_t* event_ptr = event_uptr.get();
+
+#if defined(MCUT_MULTI_THREADED)
+    // satisfied before the callback is invoked so that the callback may release its own event. The task (rather than
+    // the event) owns the promise because the event may be destroyed as soon as the promise is satisfied.
+    std::shared_ptr<std::promise<McResult>> event_promise = std::make_shared<std::promise<McResult>>();
+    event_uptr->future = event_promise->get_future().share();
+#endif
+
+    {
+        std::lock_guard<std::mutex> lock(context_uptr->events_mutex);
+
+        const std::pair<std::map<McEvent, std::unique_ptr<event_t>>::iterator, bool> insertion_result = context_uptr->events.emplace(handle, std::move(event_uptr));
+
+        if (!insertion_result.second) {
+            throw std::runtime_error("failed to create event");
+        }
+    }
+
+    // NOTE: the context (and event) outlive the task since "release_context_impl" and
+    // "release_events_impl" wait for the task to complete
+    std::unique_ptr<context_t>* context_uptr_ptr = &context_uptr;
+#if defined(MCUT_MULTI_THREADED)
+    // NOTE: "context_uptr" may be removed from "g_contexts" as soon as the event is complete, but the context itself
+    // outlives the callback (see: context_t::num_running_callbacks)
+    context_t* context_ptr = context_uptr.get();
+#endif
+
+    auto fn_dispatch = [=]() {
+        event_ptr->timestamp_start.store(get_timestamp_ns());
+        event_ptr->command_exec_status.store(MC_RUNNING);
+
+        McResult result = McResult::MC_NO_ERROR;
+
+        try {
+            dispatch_arrays(
+                *context_uptr_ptr,
+                flags,
+                pSrcMeshVertices,
+                pSrcMeshFaceIndices,
+                pSrcMeshFaceSizes,
+                numSrcMeshVertices,
+                numSrcMeshFaces,
+                pCutMeshVertices,
+                pCutMeshFaceIndices,
+                pCutMeshFaceSizes,
+                numCutMeshVertices,
+                numCutMeshFaces);
+        } catch (std::invalid_argument& e0) {
+            (*context_uptr_ptr)->log(MC_DEBUG_SOURCE_API, MC_DEBUG_TYPE_ERROR, 0, MC_DEBUG_SEVERITY_HIGH, e0.what());
+            result = McResult::MC_INVALID_VALUE;
+        } catch (std::runtime_error& e1) {
+            (*context_uptr_ptr)->log(MC_DEBUG_SOURCE_API, MC_DEBUG_TYPE_ERROR, 0, MC_DEBUG_SEVERITY_HIGH, e1.what());
+            result = McResult::MC_INVALID_OPERATION;
+        } catch (std::exception& e2) {
+            (*context_uptr_ptr)->log(MC_DEBUG_SOURCE_API, MC_DEBUG_TYPE_ERROR, 0, MC_DEBUG_SEVERITY_HIGH, e2.what());
+            result = McResult::MC_RESULT_MAX_ENUM;
+        }
+
+        event_ptr->runtime_exec_status.store((int32_t)result);
+        event_ptr->timestamp_end.store(get_timestamp_ns());
+
+        // NOTE: "event_ptr" may be dangling once the event is complete (e.g. released by the callback)
+        const pfn_McEvent_CALLBACK callback = event_ptr->callback;
+        void* const callback_user_data = event_ptr->callback_user_data;
+
+        event_ptr->command_exec_status.store(MC_COMPLETE);
+#if defined(MCUT_MULTI_THREADED)
+        if (callback != nullptr) {
+            std::lock_guard<std::mutex> lock(context_ptr->running_callbacks_mutex);
+            context_ptr->num_running_callbacks++;
+        }
+
+        event_promise->set_value(result);
+#endif
+
+        if (callback != nullptr) {
+            (*callback)(handle, callback_user_data);
+
+#if defined(MCUT_MULTI_THREADED)
+            // NOTE: notified under the lock since the context may be destroyed as soon as the count is zero
+            std::lock_guard<std::mutex> lock(context_ptr->running_callbacks_mutex);
+            context_ptr->num_running_callbacks--;
+            context_ptr->running_callbacks_cv.notify_all();
+#endif
+        }
+    };
+
+    // NOTE: before the dispatch call since the callback may compare its handle with "*pEvent"
+    *pEvent = handle;
+
+#if defined(MCUT_MULTI_THREADED)
+    {
+        // NOTE: the task is not traced as a whole (see: traced_task) since it continues after its event is complete,
+        // when the trace of the context may no longer exist. The dispatch call itself is traced by "dispatch_arrays".
+        scoped_trace_t trace_scope(nullptr, nullptr);
+        context_uptr->scheduler->submit(fn_dispatch);
+    }
+#else
+    fn_dispatch();
+#endif
+}
+
+void wait_for_events_impl(
+    McContext context,
+    uint32_t numEvents,
+    const McEvent* pEventList)
+{
+    std::unique_ptr<context_t>& context_uptr = get_context(context);
+
+    McResult first_error = McResult::MC_NO_ERROR;
+
+    for (uint32_t i = 0; i < numEvents; ++i) {
+#if defined(MCUT_MULTI_THREADED)
+        std::shared_future<McResult> future;
+#else
+        McResult result = McResult::MC_NO_ERROR;
+#endif
+
+        {
+            std::lock_guard<std::mutex> lock(context_uptr->events_mutex);
+
+            std::map<McEvent, std::unique_ptr<event_t>>::iterator event_entry_iter = context_uptr->events.find(pEventList[i]);
+
+            if (event_entry_iter == context_uptr->events.end()) {
+                throw std::invalid_argument("invalid event");
+            }
+
+#if defined(MCUT_MULTI_THREADED)
+            future = event_entry_iter->second->future; // NOTE: the event may be released (by its callback) while we wait
+#else
+            result = (McResult)event_entry_iter->second->runtime_exec_status.load();
+#endif
+        }
+
+#if defined(MCUT_MULTI_THREADED)
+        const McResult result = future.get(); // NOTE: without the lock since the dispatch call may itself access "events"
+#endif
+
+        if (first_error == McResult::MC_NO_ERROR) {
+            first_error = result;
+        }
+    }
+
+    if (first_error == McResult::MC_INVALID_VALUE) {
+        throw std::invalid_argument("dispatch call of event failed with invalid value");
+    } else if (first_error != McResult::MC_NO_ERROR) {
+        throw std::runtime_error("dispatch call of event failed");
+    }
+}
+
+void get_event_info_impl(
+    McContext context,
+    McEvent event,
+    McFlags info,
+    uint64_t bytes,
+    void* pMem,
+    uint64_t* pNumBytes)
+{
+    std::unique_ptr<context_t>& context_uptr = get_context(context);
+
+    std::lock_guard<std::mutex> lock(context_uptr->events_mutex);
+
+    std::map<McEvent, std::unique_ptr<event_t>>::iterator event_entry_iter = context_uptr->events.find(event);
+
+    if (event_entry_iter == context_uptr->events.end()) {
+        throw std::invalid_argument("invalid event");
+    }
+
+    const std::unique_ptr<event_t>& event_uptr = event_entry_iter->second;
+
+    switch (info) {
+    case MC_EVENT_COMMAND_EXECUTION_STATUS: {
+        const McEventCommandExecStatus value = (McEventCommandExecStatus)event_uptr->command_exec_status.load();
+        if (pMem == nullptr) {
+            *pNumBytes = sizeof(value);
+        } else {
+            if (bytes < sizeof(value)) {
+                throw std::invalid_argument("out of bounds memory access");
+            }
+            memcpy(pMem, reinterpret_cast<const void*>(&value), sizeof(value));
+        }
+    } break;
+    case MC_EVENT_RUNTIME_EXECUTION_STATUS: {
+        const McResult value = (McResult)event_uptr->runtime_exec_status.load();
+        if (pMem == nullptr) {
+            *pNumBytes = sizeof(value);
+        } else {
+            if (bytes < sizeof(value)) {
+                throw std::invalid_argument("out of bounds memory access");
+            }
+            memcpy(pMem, reinterpret_cast<const void*>(&value), sizeof(value));
+        }
+    } break;
+    case MC_EVENT_TIMESTAMP_SUBMIT:
+    case MC_EVENT_TIMESTAMP_START:
+    case MC_EVENT_TIMESTAMP_END: {
+        const uint64_t value = (info == MC_EVENT_TIMESTAMP_SUBMIT) ? event_uptr->timestamp_submit.load() : //
+            ((info == MC_EVENT_TIMESTAMP_START) ? event_uptr->timestamp_start.load() : event_uptr->timestamp_end.load());
+        if (pMem == nullptr) {
+            *pNumBytes = sizeof(value);
+        } else {
+            if (bytes < sizeof(value)) {
+                throw std::invalid_argument("out of bounds memory access");
+            }
+            memcpy(pMem, reinterpret_cast<const void*>(&value), sizeof(value));
+        }
+    } break;
+    default:
+        throw std::invalid_argument("unknown info parameter");
+        break;
+    }
+}
+
+void release_events_impl(
+    McContext context,
+    uint32_t numEvents,
+    const McEvent* pEvents)
+{
+    std::unique_ptr<context_t>& context_uptr = get_context(context);
+
+    for (uint32_t i = 0; i < numEvents; ++i) {
+#if defined(MCUT_MULTI_THREADED)
+        std::shared_future<McResult> future;
+
+        {
+            std::lock_guard<std::mutex> lock(context_uptr->events_mutex);
+
+            std::map<McEvent, std::unique_ptr<event_t>>::iterator event_entry_iter = context_uptr->events.find(pEvents[i]);
+
+            if (event_entry_iter == context_uptr->events.end()) {
+                throw std::invalid_argument("invalid event");
+            }
+
+            future = event_entry_iter->second->future;
+        }
+
+        future.wait(); // NOTE: without the lock since the dispatch call may itself access "events"
+#endif
+        std::lock_guard<std::mutex> lock(context_uptr->events_mutex);
+
+        std::map<McEvent, std::unique_ptr<event_t>>::iterator event_entry_iter = context_uptr->events.find(pEvents[i]);
+
+        if (event_entry_iter == context_uptr->events.end()) {
+            throw std::invalid_argument("invalid event"); // e.g. released concurrently by another thread
+        }
+
+        context_uptr->events.erase(event_entry_iter);
+    }
+}
+
+void create_mesh_impl(
+    McContext context,
+    McMesh* pMesh,
+    McFlags flags,
+    const void* pVertices,
+    const uint32_t* pFaceIndices,
+    const uint32_t* pFaceSizes,
+    uint32_t numVertices,
+    uint32_t numFaces)
+{
+    MCUT_ASSERT(pMesh != nullptr);
+
+    std::unique_ptr<context_t>& context_uptr = get_context(context);
+
+    std::unique_ptr<mesh_t> mesh_uptr = std::unique_ptr<mesh_t>(new mesh_t());
+
+    scoped_trace_t trace_scope(context_uptr->trace.get(), "mcCreateMesh");
+
+    preproc_mesh(
+        context_uptr,
+        mesh_uptr.get()[0],
+        flags,
+        pVertices,
+        pFaceIndices,
+        pFaceSizes,
+        numVertices,
+        numFaces);
+
+    const McMesh handle = reinterpret_cast<McMesh>(mesh_uptr.get());
+
+    {
+        std::lock_guard<std::mutex> lock(context_uptr->meshes_mutex);
+
+        const std::pair<std::map<McMesh, std::unique_ptr<mesh_t>>::iterator, bool> insertion_result = context_uptr->meshes.emplace(handle, std::move(mesh_uptr));
+
+        if (!insertion_result.second) {
+            throw std::runtime_error("failed to create mesh");
+        }
+    }
+
+    *pMesh = handle;
+}
+
+// return the mesh object of the given handle, or throw std::invalid_argument if the handle is not
+// an existing mesh of the context. The returned reference stays valid until the mesh is released.
+mesh_t& get_mesh(std::unique_ptr<context_t>& context_uptr, McMesh mesh)
+{
+    std::lock_guard<std::mutex> lock(context_uptr->meshes_mutex);
+
+    std::map<McMesh, std::unique_ptr<mesh_t>>::iterator mesh_entry_iter = context_uptr->meshes.find(mesh);
+
+    if (mesh_entry_iter == context_uptr->meshes.end()) {
+        throw std::invalid_argument("invalid mesh");
+    }
+
+    return mesh_entry_iter->second.get()[0];
+}
+
+void dispatch_meshes_impl(
+    McContext context,
+    McFlags flags,
+    McMesh srcMesh,
+    const void* pCutMeshVertices,
+    const uint32_t* pCutMeshFaceIndices,
+    const uint32_t* pCutMeshFaceSizes,
+    uint32_t numCutMeshVertices,
+    uint32_t numCutMeshFaces)
+{
+    std::unique_ptr<context_t>& context_uptr = get_context(context);
+    mesh_t& source_mesh = get_mesh(context_uptr, srcMesh);
+
+    std::map<McConnectedComponent, std::unique_ptr<connected_component_t, void (*)(connected_component_t*)>> connected_components;
+
+    {
+        scoped_trace_t trace_scope(context_uptr->trace.get(), "mcDispatchMeshes");
+        scoped_dispatch_stats_t dispatch_stats(*context_uptr);
+
+        preproc(
+            context_uptr,
+            connected_components,
+            flags,
+            source_mesh,
+            true,
+            pCutMeshVertices,
+            pCutMeshFaceIndices,
+            pCutMeshFaceSizes,
+            numCutMeshVertices,
+            numCutMeshFaces);
+    }
+
+    merge_connected_components(context_uptr, connected_components);
+}
+
+void dispatch_batch_impl(
+    McContext context,
+    McFlags flags,
+    McMesh srcMesh,
+    uint32_t numCutMeshes,
+    const void* const* ppCutMeshVertices,
+    const uint32_t* const* ppCutMeshFaceIndices,
+    const uint32_t* const* ppCutMeshFaceSizes,
+    const uint32_t* pNumCutMeshVertices,
+    const uint32_t* pNumCutMeshFaces,
+    McResult* pResults)
+{
+    std::unique_ptr<context_t>& context_uptr = get_context(context);
+    mesh_t& source_mesh = get_mesh(context_uptr, srcMesh);
+
+    // NOTE: the tasks that process each cut mesh are traced too, since they are submitted within this scope
+    scoped_trace_t trace_scope(context_uptr->trace.get(), "mcDispatchBatch");
+
+    // connected components from a previous batch are no longer associated with a cut mesh
+    std::unique_lock<std::mutex> lock(context_uptr->connected_components_mutex);
+
+    for (std::map<McConnectedComponent, std::unique_ptr<connected_component_t, void (*)(connected_component_t*)>>::iterator i = context_uptr->connected_components.begin();
+         i != context_uptr->connected_components.end();
+         ++i) {
+        i->second->batch_cut_mesh_index = -1;
+    }
+
+    lock.unlock();
+
+    // Each cut mesh is processed independently, with its own set of output connected components.
+    // The source mesh is shared (read-only) between all of them.
+    std::vector<std::map<McConnectedComponent, std::unique_ptr<connected_component_t, void (*)(connected_component_t*)>>> batch_connected_components(numCutMeshes);
+    std::vector<McResult> batch_results(numCutMeshes, McResult::MC_NO_ERROR);
+
+    auto fn_dispatch_cut_mesh = [&](uint32_t cut_mesh_index) {
+        try {
+            if (ppCutMeshVertices[cut_mesh_index] == nullptr) {
+                throw std::invalid_argument("cut-mesh vertex-position array ptr undef (NULL)");
+            } else if (pNumCutMeshVertices[cut_mesh_index] < 3) {
+                throw std::invalid_argument("invalid cut-mesh vertex count");
+            } else if (ppCutMeshFaceIndices[cut_mesh_index] == nullptr) {
+                throw std::invalid_argument("cut-mesh face-index array ptr undef (NULL)");
+            } else if (pNumCutMeshFaces[cut_mesh_index] < 1) {
+                throw std::invalid_argument("invalid cut-mesh face count");
+            }
+
+            scoped_dispatch_stats_t dispatch_stats(*context_uptr);
+
+            preproc(
+                context_uptr,
+                batch_connected_components[cut_mesh_index],
+                flags,
+                source_mesh,
+                true,
+                ppCutMeshVertices[cut_mesh_index],
+                ppCutMeshFaceIndices[cut_mesh_index],
+                (ppCutMeshFaceSizes != nullptr) ? ppCutMeshFaceSizes[cut_mesh_index] : nullptr,
+                pNumCutMeshVertices[cut_mesh_index],
+                pNumCutMeshFaces[cut_mesh_index]);
+        } catch (std::invalid_argument& e0) {
+            context_uptr->log(MC_DEBUG_SOURCE_API, MC_DEBUG_TYPE_ERROR, 0, MC_DEBUG_SEVERITY_HIGH, "cut-mesh " + std::to_string(cut_mesh_index) + " : " + e0.what());
+            batch_results[cut_mesh_index] = McResult::MC_INVALID_VALUE;
+        } catch (std::runtime_error& e1) {
+            context_uptr->log(MC_DEBUG_SOURCE_API, MC_DEBUG_TYPE_ERROR, 0, MC_DEBUG_SEVERITY_HIGH, "cut-mesh " + std::to_string(cut_mesh_index) + " : " + e1.what());
+            batch_results[cut_mesh_index] = McResult::MC_INVALID_OPERATION;
+        } catch (std::exception& e2) {
+            context_uptr->log(MC_DEBUG_SOURCE_API, MC_DEBUG_TYPE_ERROR, 0, MC_DEBUG_SEVERITY_HIGH, "cut-mesh " + std::to_string(cut_mesh_index) + " : " + e2.what());
+            batch_results[cut_mesh_index] = McResult::MC_RESULT_MAX_ENUM;
+        }
+    };
+
+#if defined(MCUT_MULTI_THREADED)
+    {
+        std::vector<std::future<void>> futures(numCutMeshes);
+        task_group group(*context_uptr->scheduler);
+
+        for (uint32_t i = 0; i < numCutMeshes; ++i) {
+            futures[i] = group.submit([&, i]() { fn_dispatch_cut_mesh(i); });
+        }
+
+        // help the worker threads until every cut mesh is done
+        group.wait(futures);
+    }
+#else
+    for (uint32_t i = 0; i < numCutMeshes; ++i) {
+        fn_dispatch_cut_mesh(i);
+    }
+#endif
+
+    McResult first_error = McResult::MC_NO_ERROR;
+
+    lock.lock();
+
+    for (uint32_t i = 0; i < numCutMeshes; ++i) {
+        for (std::map<McConnectedComponent, std::unique_ptr<connected_component_t, void (*)(connected_component_t*)>>::iterator j = batch_connected_components[i].begin();
+             j != batch_connected_components[i].end();
+             ++j) {
+            j->second->batch_cut_mesh_index = (int32_t)i;
+            context_uptr->connected_components.emplace(j->first, std::move(j->second));
+        }
+
+        if (pResults != nullptr) {
+            pResults[i] = batch_results[i];
+        }
+
+        if (first_error == McResult::MC_NO_ERROR) {
+            first_error = batch_results[i];
+        }
+    }
+
+    if (first_error == McResult::MC_INVALID_VALUE) {
+        throw std::invalid_argument("invalid cut-mesh in batch");
+    } else if (first_error != McResult::MC_NO_ERROR) {
+        throw std::runtime_error("incomplete batch execution");
+    }
+}
+
+void release_mesh_impl(
+    McContext context,
+    McMesh mesh)
+{
+    const std::unique_ptr<context_t>& context_uptr = get_context(context);
+
+    std::lock_guard<std::mutex> lock(context_uptr->meshes_mutex);
+
+    std::map<McMesh, std::unique_ptr<mesh_t>>::iterator mesh_entry_iter = context_uptr->meshes.find(mesh);
+
+    if (mesh_entry_iter == context_uptr->meshes.end()) {
+        throw std::invalid_argument("invalid mesh");
+    }
+
+    context_uptr->meshes.erase(mesh_entry_iter);
+}
+
 void get_connected_components_impl(
     const McContext context,
     const McConnectedComponentType connectedComponentType,
@@ -246,13 +1012,49 @@ void get_connected_components_impl(
     McConnectedComponent* pConnComps,
     uint32_t* numConnComps)
 {
-    std::map<McContext, std::unique_ptr<context_t>>::iterator context_entry_iter = g_contexts.find(context);
+    const std::unique_ptr<context_t>& context_uptr = get_context(context);
 
-    if (context_entry_iter == g_contexts.end()) {
-        throw std::invalid_argument("invalid context");
+    std::lock_guard<std::mutex> lock(context_uptr->connected_components_mutex);
+
+    if (numConnComps != nullptr) {
+        (*numConnComps) = 0; // reset
+    }
+
+    uint32_t valid_cc_counter = 0;
+
+    for (std::map<McConnectedComponent, std::unique_ptr<connected_component_t, void (*)(connected_component_t*)>>::const_iterator i = context_uptr->connected_components.cbegin();
+         i != context_uptr->connected_components.cend();
+         ++i) {
+
+        const bool is_valid = (i->second->type & connectedComponentType) != 0;
+
+        if (is_valid) {
+            if (pConnComps == nullptr) // query number
+            {
+                (*numConnComps)++;
+            } else // populate pConnComps
+            {
+                pConnComps[valid_cc_counter] = i->first;
+                valid_cc_counter += 1;
+                if (valid_cc_counter == numEntries) {
+                    break;
+                }
+            }
+        }
     }
+}
 
-    const std::unique_ptr<context_t>& context_uptr = context_entry_iter->second;
+void get_batch_connected_components_impl(
+    const McContext context,
+    const uint32_t cutMeshIndex,
+    const McConnectedComponentType connectedComponentType,
+    const uint32_t numEntries,
+    McConnectedComponent* pConnComps,
+    uint32_t* numConnComps)
+{
+    const std::unique_ptr<context_t>& context_uptr = get_context(context);
+
+    std::lock_guard<std::mutex> lock(context_uptr->connected_components_mutex);
 
     if (numConnComps != nullptr) {
         (*numConnComps) = 0; // reset
@@ -264,7 +1066,7 @@ void get_connected_components_impl(
          i != context_uptr->connected_components.cend();
          ++i) {
 
-        const bool is_valid = (i->second->type & connectedComponentType) != 0;
+        const bool is_valid = (i->second->type & connectedComponentType) != 0 && i->second->batch_cut_mesh_index == (int32_t)cutMeshIndex;
 
         if (is_valid) {
             if (pConnComps == nullptr) // query number
@@ -291,13 +1093,9 @@ void get_connected_component_data_impl(
     uint64_t* pNumBytes)
 {
 
-    std::map<McContext, std::unique_ptr<context_t>>::iterator context_entry_iter = g_contexts.find(context);
-
-    if (context_entry_iter == g_contexts.end()) {
-        throw std::invalid_argument("invalid context");
-    }
+    const std::unique_ptr<context_t>& context_uptr = get_context(context);
 
-    const std::unique_ptr<context_t>& context_uptr = context_entry_iter->second;
+    std::lock_guard<std::mutex> lock(context_uptr->connected_components_mutex);
 
     std::map<McConnectedComponent, std::unique_ptr<connected_component_t, void (*)(connected_component_t*)>>::const_iterator cc_entry_iter = context_uptr->connected_components.find(connCompId);
 
@@ -1075,6 +1873,7 @@ void get_connected_component_data_impl(
                             face_descriptor_t nfd = wot.add_face(remapped_descrs);
 
                             MCUT_ASSERT(nfd != hmesh_t::null_face());
+                            (void)nfd;
                         }
 
                         wot_traversed_neighbours.insert(neigh);
@@ -1714,13 +2513,9 @@ void release_connected_components_impl(
     uint32_t numConnComps,
     const McConnectedComponent* pConnComps)
 {
-    std::map<McContext, std::unique_ptr<context_t>>::iterator context_entry_iter = g_contexts.find(context);
-
-    if (context_entry_iter == g_contexts.end()) {
-        throw std::invalid_argument("invalid context");
-    }
+    const std::unique_ptr<context_t>& context_uptr = get_context(context);
 
-    const std::unique_ptr<context_t>& context_uptr = context_entry_iter->second;
+    std::lock_guard<std::mutex> lock(context_uptr->connected_components_mutex);
 
     if (numConnComps > (uint32_t)context_uptr->connected_components.size()) {
         throw std::invalid_argument("invalid connected component count");
@@ -1748,11 +2543,58 @@ void release_connected_components_impl(
 void release_context_impl(
     McContext context)
 {
-    std::map<McContext, std::unique_ptr<context_t>>::iterator context_entry_iter = g_contexts.find(context);
+#if defined(MCUT_MULTI_THREADED)
+    std::unique_ptr<context_t>& context_uptr = get_context(context);
 
-    if (context_entry_iter == g_contexts.end()) {
-        throw std::invalid_argument("invalid context");
+    // wait for dispatch calls that are still in flight
+    std::vector<std::shared_future<McResult>> events_in_flight;
+
+    {
+        std::lock_guard<std::mutex> lock(context_uptr->events_mutex);
+
+        for (std::map<McEvent, std::unique_ptr<event_t>>::iterator i = context_uptr->events.begin();
+             i != context_uptr->events.end();
+             ++i) {
+            events_in_flight.push_back(i->second->future);
+        }
+    }
+
+    for (std::vector<std::shared_future<McResult>>::const_iterator i = events_in_flight.cbegin(); i != events_in_flight.cend(); ++i) {
+        i->wait();
+    }
+
+    // wait for the callbacks of (possibly already released) events, which may still use the context
+    {
+        std::unique_lock<std::mutex> lock(context_uptr->running_callbacks_mutex);
+        context_uptr->running_callbacks_cv.wait(lock, [&]() { return context_uptr->num_running_callbacks == 0; });
     }
+#endif
+
+    // take ownership of the context object so that it is destroyed (which includes joining
+    // its threads) after other threads regain access to "g_contexts"
+    std::unique_ptr<context_t> released_context_uptr;
+
+    {
+        std::lock_guard<reader_writer_lock_t> lock(g_contexts_lock);
 
-    g_contexts.erase(context_entry_iter);
+        std::map<McContext, std::unique_ptr<context_t>>::iterator context_entry_iter = g_contexts.find(context);
+
+        if (context_entry_iter != g_contexts.end()) {
+            released_context_uptr = std::move(context_entry_iter->second);
+            g_contexts.erase(context_entry_iter);
+        }
+    }
+
+    if (!released_context_uptr) {
+        throw std::invalid_argument("invalid context"); // released concurrently by another thread
+    }
+
+    if (released_context_uptr->trace && !released_context_uptr->trace_file_path.empty()) {
+        std::ofstream trace_file(released_context_uptr->trace_file_path.c_str());
+        trace_file << released_context_uptr->trace->to_json();
+
+        if (!trace_file) {
+            throw std::runtime_error("failed to write trace file");
+        }
+    }
 }
\ No newline at end of file
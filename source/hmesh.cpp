@@ -23,10 +23,171 @@
 #include "mcut/internal/hmesh.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstdio>
+#include <functional>
 
 #define ENABLE_EDGE_DESCRIPTOR_TRICK 1
 
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace {
+inline uint32_t popcount64(uint64_t x)
+{
+#ifdef _MSC_VER
+    return (uint32_t)__popcnt64(x);
+#else
+    return (uint32_t)__builtin_popcountll(x);
+#endif
+}
+
+// index of the lowest set bit (x must not be zero)
+inline uint32_t count_trailing_zeros64(uint64_t x)
+{
+#ifdef _MSC_VER
+    unsigned long index = 0;
+    _BitScanForward64(&index, x);
+    return (uint32_t)index;
+#else
+    return (uint32_t)__builtin_ctzll(x);
+#endif
+}
+} // namespace
+
+//
+// removed_elements_bitset_t
+//
+removed_elements_bitset_t::removed_elements_bitset_t()
+    : m_block_counts(1, 0)
+{
+}
+
+void removed_elements_bitset_t::grow(uint32_t num_words)
+{
+    // NOTE: the number of words only grows (geometrically), so rebuilding the tree is amortized
+    num_words = std::max(num_words, (uint32_t)m_words.size() * 2);
+    num_words = ((num_words + words_per_block - 1) / words_per_block) * words_per_block;
+
+    m_words.resize(num_words, 0);
+
+    const uint32_t num_blocks = num_words / words_per_block;
+    m_block_counts.assign((size_t)num_blocks + 1, 0);
+
+    for (uint32_t b = 0; b < num_blocks; ++b) {
+        for (uint32_t w = b * words_per_block; w < (b + 1) * words_per_block; ++w) {
+            m_block_counts[(size_t)b + 1] += popcount64(m_words[w]);
+        }
+    }
+
+    // i.e. linear-time construction of the Fenwick tree from the block counts
+    for (uint32_t k = 1; k <= num_blocks; ++k) {
+        const uint32_t parent = k + (k & (~k + 1));
+
+        if (parent <= num_blocks) {
+            m_block_counts[parent] += m_block_counts[k];
+        }
+    }
+}
+
+void removed_elements_bitset_t::insert(uint32_t i)
+{
+    const uint32_t w = i / 64;
+
+    if (w >= (uint32_t)m_words.size()) {
+        grow(w + 1);
+    }
+
+    const uint64_t bit = (uint64_t)1 << (i % 64);
+    MCUT_ASSERT((m_words[w] & bit) == 0);
+    m_words[w] |= bit;
+
+    const uint32_t num_blocks = (uint32_t)m_block_counts.size() - 1;
+
+    for (uint32_t k = w / words_per_block + 1; k <= num_blocks; k += (k & (~k + 1))) {
+        m_block_counts[k] += 1;
+    }
+}
+
+void removed_elements_bitset_t::erase(uint32_t i)
+{
+    MCUT_ASSERT(contains(i));
+
+    const uint32_t w = i / 64;
+    m_words[w] &= ~((uint64_t)1 << (i % 64));
+
+    const uint32_t num_blocks = (uint32_t)m_block_counts.size() - 1;
+
+    for (uint32_t k = w / words_per_block + 1; k <= num_blocks; k += (k & (~k + 1))) {
+        m_block_counts[k] -= 1;
+    }
+}
+
+bool removed_elements_bitset_t::contains(uint32_t i) const
+{
+    const uint32_t w = i / 64;
+    return w < (uint32_t)m_words.size() && (m_words[w] & ((uint64_t)1 << (i % 64))) != 0;
+}
+
+void removed_elements_bitset_t::clear()
+{
+    std::vector<uint64_t>().swap(m_words);
+    m_block_counts.assign(1, 0);
+}
+
+uint32_t removed_elements_bitset_t::rank(uint32_t i) const
+{
+    const uint32_t num_bits = (uint32_t)m_words.size() * 64;
+    i = std::min(i, num_bits);
+
+    const uint32_t block = i / (words_per_block * 64);
+    uint32_t n = 0;
+
+    for (uint32_t k = block; k > 0; k -= (k & (~k + 1))) {
+        n += m_block_counts[k]; // i.e. the blocks before "block"
+    }
+
+    const uint32_t w_end = i / 64;
+
+    for (uint32_t w = block * words_per_block; w < w_end; ++w) {
+        n += popcount64(m_words[w]);
+    }
+
+    if (i % 64 != 0) {
+        n += popcount64(m_words[w_end] & (((uint64_t)1 << (i % 64)) - 1));
+    }
+
+    return n;
+}
+
+uint32_t removed_elements_bitset_t::count(uint32_t first, uint32_t last) const
+{
+    MCUT_ASSERT(first <= last);
+    return rank(last) - rank(first);
+}
+
+uint32_t removed_elements_bitset_t::find_next_not_removed(uint32_t i) const
+{
+    uint32_t w = i / 64;
+
+    if (w >= (uint32_t)m_words.size()) {
+        return i;
+    }
+
+    uint64_t not_removed = ~m_words[w] & (~(uint64_t)0 << (i % 64));
+
+    while (not_removed == 0) {
+        if (++w == (uint32_t)m_words.size()) {
+            return w * 64;
+        }
+
+        not_removed = ~m_words[w];
+    }
+
+    return w * 64 + count_trailing_zeros64(not_removed);
+}
+
 //
 // array_iterator_t
 //
@@ -77,11 +238,15 @@ face_array_iterator_t face_array_iterator_t::cend(id_<face_array_iterator_t>)
     return mesh_ptr->faces_end();
 }
 
+const uint32_t block_executor_t::block_size;
+
 //
 // hmesh_t
 //
 
 hmesh_t::hmesh_t()
+    : m_edge_index_enabled(false)
+    , m_compaction_count(0)
 {
 }
 hmesh_t::~hmesh_t() { }
@@ -284,9 +449,17 @@ halfedge_descriptor_t hmesh_t::halfedge(const edge_descriptor_t e, const int i)
 #endif
 }
 
-// TODO: maybe a caching mechanism might help with this lookup e,g. "std::unordered_map<std::pair<vertex_descriptor_t, vertex_descriptor_t>, halfedge_descriptor_t>"
-// But this cache need to be invalidated if we delete and edge
-halfedge_descriptor_t hmesh_t::halfedge(const vertex_descriptor_t s, const vertex_descriptor_t t, bool strict_check) const
+namespace {
+// key of the (unordered) pair of vertices of an edge in the edge index
+inline uint64_t edge_index_key(const vertex_descriptor_t a, const vertex_descriptor_t b)
+{
+    const uint64_t lo = std::min((uint32_t)a, (uint32_t)b);
+    const uint64_t hi = std::max((uint32_t)a, (uint32_t)b);
+    return (hi << 32) | lo;
+}
+} // namespace
+
+halfedge_descriptor_t hmesh_t::find_halfedge(const vertex_descriptor_t s, const vertex_descriptor_t t) const
 {
     MCUT_ASSERT((size_t)s < m_vertices.size()); // MCUT_ASSERT(m_vertices.count(s) == 1);
     const vertex_data_t& svd = m_vertices[s];
@@ -305,37 +478,47 @@ halfedge_descriptor_t hmesh_t::halfedge(const vertex_descriptor_t s, const verte
         t_edges.push_back(e);
     }
 
-    halfedge_descriptor_t result = null_halfedge();
     for (std::vector<halfedge_descriptor_t>::const_iterator i = s_halfedges.cbegin(); i != s_halfedges.cend(); ++i) {
         edge_descriptor_t s_edge = edge(*i);
         if (std::find(t_edges.cbegin(), t_edges.cend(), s_edge) != t_edges.cend()) // belong to same edge?
         {
-            
-
             // check if we need to return the opposite halfedge
             if ((source(*i) == s && target(*i) == t) == false) {
                 MCUT_ASSERT(source(*i) == t);
                 MCUT_ASSERT(target(*i) == s);
 
-                halfedge_descriptor_t h = opposite(*i);
-
-                if (strict_check || face(h) != null_face()) { // "strict_check" ensures that we return the halfedge matching the input vertices
-                    result = h;
-                }
+                return opposite(*i);
             }
-            else
-            {
-                MCUT_ASSERT(source(*i) == s); // confirm our assumption
-                MCUT_ASSERT(target(*i) == t);
 
-                if (strict_check || face(*i) != null_face()) { // "strict_check" ensures that we return the halfedge matching the input vertices
-                    result = *i;  // assume source(*i) and target(*i) match "s" and "t"
-                }
-                
-            }
-            break;
+            MCUT_ASSERT(source(*i) == s); // confirm our assumption
+            MCUT_ASSERT(target(*i) == t);
+
+            return *i;
         }
     }
+
+    return null_halfedge();
+}
+
+halfedge_descriptor_t hmesh_t::halfedge(const vertex_descriptor_t s, const vertex_descriptor_t t, bool strict_check) const
+{
+    halfedge_descriptor_t result = null_halfedge();
+
+    if (m_edge_index_enabled) {
+        std::unordered_map<uint64_t, halfedge_descriptor_t>::const_iterator entry = m_edge_index.find(edge_index_key(s, t));
+
+        if (entry != m_edge_index.cend()) {
+            result = (target(entry->second) == t) ? entry->second : opposite(entry->second);
+            MCUT_ASSERT(result == find_halfedge(s, t));
+        }
+    } else {
+        result = find_halfedge(s, t);
+    }
+
+    if (result != null_halfedge() && !strict_check && face(result) == null_face()) {
+        result = null_halfedge(); // "strict_check" ensures that we return the halfedge matching the input vertices
+    }
+
     return result;
 }
 
@@ -364,6 +547,7 @@ vertex_descriptor_t hmesh_t::add_vertex(const double& x, const double& y, const
         std::vector<vertex_descriptor_t>::iterator it = m_vertices_removed.begin(); // take the oldest unused slot (NOTE: important for user data mapping)
         vd = *it;
         m_vertices_removed.erase(it);
+        m_vertices_removed_bitset.erase(vd);
         MCUT_ASSERT((size_t)vd < m_vertices.size()); // MCUT_ASSERT(m_vertices.find(vd) != m_vertices.cend());
         data_ptr = &m_vertices[vd];
     } else {
@@ -401,6 +585,7 @@ halfedge_descriptor_t hmesh_t::add_edge(const vertex_descriptor_t v0, const vert
         std::vector<halfedge_descriptor_t>::iterator hIter = m_halfedges_removed.begin(); // take the oldest unused slot (NOTE: important for user data mapping)
         h0_idx = *hIter;
         m_halfedges_removed.erase(hIter);
+        m_halfedges_removed_bitset.erase(h0_idx);
         MCUT_ASSERT((size_t)h0_idx < m_halfedges.size() /*m_halfedges.find(h0_idx) != m_halfedges.cend()*/);
     }
 
@@ -424,6 +609,7 @@ halfedge_descriptor_t hmesh_t::add_edge(const vertex_descriptor_t v0, const vert
         std::vector<halfedge_descriptor_t>::iterator hIter = m_halfedges_removed.begin() /*+ (m_halfedges_removed.size() - 1)*/; // take the most recently removed
         h1_idx = *hIter;
         m_halfedges_removed.erase(hIter);
+        m_halfedges_removed_bitset.erase(h1_idx);
         MCUT_ASSERT((size_t)h1_idx < m_halfedges.size() /*m_halfedges.find(h1_idx) != m_halfedges.cend()*/);
     }
 
@@ -452,6 +638,7 @@ halfedge_descriptor_t hmesh_t::add_edge(const vertex_descriptor_t v0, const vert
         std::vector<edge_descriptor_t>::iterator eIter = m_edges_removed.begin(); // take the oldest unused slot (NOTE: important for user data mapping)
         e_idx = *eIter;
         m_edges_removed.erase(eIter);
+        m_edges_removed_bitset.erase(e_idx);
         MCUT_ASSERT((size_t)e_idx < m_edges.size() /*m_edges.find(e_idx) != m_edges.cend()*/);
     }
 
@@ -501,6 +688,10 @@ halfedge_descriptor_t hmesh_t::add_edge(const vertex_descriptor_t v0, const vert
         v1_data.m_halfedges.emplace_back(h0_idx); // halfedge whose target is v1
     }
 
+    if (m_edge_index_enabled) {
+        m_edge_index.emplace(edge_index_key(v0, v1), h0_idx); // NOTE: does not replace an existing edge between v0 and v1
+    }
+
     return static_cast<halfedge_descriptor_t>(h0_idx); // return halfedge whose target is v1
 }
 
@@ -519,6 +710,7 @@ face_descriptor_t hmesh_t::add_face(const std::vector<vertex_descriptor_t>& vi)
         std::vector<face_descriptor_t>::iterator fIter = m_faces_removed.begin(); // take the oldest unused slot (NOTE: important for user data mapping)
         new_face_idx = *fIter;
         m_faces_removed.erase(fIter); // slot is going to be used again
+        m_faces_removed_bitset.erase(new_face_idx);
 
         MCUT_ASSERT((size_t)new_face_idx < m_faces.size() /*m_faces.find(new_face_idx) != m_faces.cend()*/);
     }
@@ -627,6 +819,300 @@ face_descriptor_t hmesh_t::add_face(const std::vector<vertex_descriptor_t>& vi)
     return new_face_idx;
 }
 
+namespace {
+// Matches the corners of the faces of an index-array mesh (see: hmesh_t::build_from_arrays) into edges, where edge "e"
+// has the halfedges 2e and 2e+1 (see: hmesh_t::add_edge). Outputs the halfedge of each corner and the target vertex
+// of each halfedge, and returns the number of faces, or the index of the first face that is incident to a
+// non-manifold edge (in which case the outputs are unspecified).
+uint32_t match_corners_to_halfedges(
+#if defined(MCUT_MULTI_THREADED)
+    thread_pool& scheduler,
+    uint32_t serial_execution_threshold,
+#endif
+    const block_executor_t& for_each_block,
+    const uint32_t num_vertices,
+    const uint32_t* face_indices,
+    const std::vector<uint32_t>& face_offsets,
+    std::vector<halfedge_descriptor_t>& corner_halfedge,
+    std::vector<vertex_descriptor_t>& halfedge_target)
+{
+    (void)num_vertices; // i.e. only used in assertions
+
+    const uint32_t num_faces = (uint32_t)face_offsets.size() - 1;
+    const uint32_t num_corners = face_offsets.back(); // i.e. the number of halfedges used by faces
+
+    // Each "corner" (i.e. a vertex of a face) is the source of the halfedge that leads to the next vertex of the face.
+    // Sorting the corners by the (unordered) vertex pair of this halfedge groups the corners that share an edge.
+
+    std::vector<uint32_t> corner_target(num_corners);
+    std::vector<std::pair<uint64_t, uint32_t>> sorted_corners(num_corners); // (edge_index_key, corner)
+
+    for_each_block(num_faces, [&](uint32_t first_face, uint32_t last_face) {
+        for (uint32_t f = first_face; f < last_face; ++f) {
+            const uint32_t face_begin = face_offsets[f];
+            const uint32_t face_end = face_offsets[f + 1];
+
+            MCUT_ASSERT(face_end - face_begin >= 3);
+
+            for (uint32_t c = face_begin; c < face_end; ++c) {
+                const uint32_t src = face_indices[c];
+                const uint32_t tgt = face_indices[(c + 1 < face_end) ? c + 1 : face_begin];
+
+                MCUT_ASSERT(src < num_vertices && tgt < num_vertices && src != tgt);
+
+                corner_target[c] = tgt;
+                sorted_corners[c] = std::make_pair(edge_index_key(vertex_descriptor_t(src), vertex_descriptor_t(tgt)), c);
+            }
+        }
+    });
+
+    // NOTE: the corners of an edge are thus sorted in the order that add_face would visit them
+#if defined(MCUT_MULTI_THREADED)
+    parallel_sort(scheduler, serial_execution_threshold, sorted_corners.begin(), sorted_corners.end(), std::less<std::pair<uint64_t, uint32_t>>());
+#else
+    std::sort(sorted_corners.begin(), sorted_corners.end());
+#endif
+
+    // The first corner of each edge creates the edge (and its halfedge is the primary one). A later corner of the same
+    // edge must traverse it in the opposite direction, otherwise add_face would fail on its face (non-manifold edge).
+
+    std::vector<uint32_t> corner_edge(num_corners, 0); // 1 for the first corner of each edge, and later the edge index
+    std::atomic<uint32_t> first_invalid_corner(num_corners);
+
+    for_each_block(num_corners, [&](uint32_t first, uint32_t last) {
+        for (uint32_t i = first; i < last; ++i) {
+            if (i != 0 && sorted_corners[i - 1].first == sorted_corners[i].first) {
+                continue; // not the first corner of its edge
+            }
+
+            const uint32_t c0 = sorted_corners[i].second;
+            corner_edge[c0] = 1;
+
+            bool used_forward = false; // i.e. from the source to the target of the edge's primary halfedge
+            bool used_backward = false;
+
+            for (uint32_t j = i; j < num_corners && sorted_corners[j].first == sorted_corners[i].first; ++j) {
+                const uint32_t c = sorted_corners[j].second;
+                bool& used = (face_indices[c] == face_indices[c0]) ? used_forward : used_backward;
+
+                if (used) {
+                    uint32_t current = first_invalid_corner.load();
+                    while (c < current && !first_invalid_corner.compare_exchange_weak(current, c)) { }
+                    break;
+                }
+
+                used = true;
+            }
+        }
+    });
+
+    if (first_invalid_corner.load() != num_corners) {
+        // the face containing the corner
+        return (uint32_t)(std::upper_bound(face_offsets.cbegin(), face_offsets.cend(), first_invalid_corner.load()) - face_offsets.cbegin()) - 1;
+    }
+
+    uint32_t num_edges = 0;
+
+    for (uint32_t c = 0; c < num_corners; ++c) {
+        if (corner_edge[c]) {
+            corner_edge[c] = num_edges++;
+        }
+    }
+
+    halfedge_target.resize((size_t)num_edges * 2);
+    corner_halfedge.resize(num_corners);
+
+    for_each_block(num_corners, [&](uint32_t first, uint32_t last) {
+        for (uint32_t i = first; i < last; ++i) {
+            if (i != 0 && sorted_corners[i - 1].first == sorted_corners[i].first) {
+                continue;
+            }
+
+            const uint32_t c0 = sorted_corners[i].second;
+            const halfedge_descriptor_t h0(corner_edge[c0] * 2); // see: add_edge
+            const halfedge_descriptor_t h1(corner_edge[c0] * 2 + 1);
+
+            halfedge_target[h0] = vertex_descriptor_t(corner_target[c0]);
+            halfedge_target[h1] = vertex_descriptor_t(face_indices[c0]);
+
+            corner_halfedge[c0] = h0;
+
+            if (i + 1 < num_corners && sorted_corners[i + 1].first == sorted_corners[i].first) {
+                corner_halfedge[sorted_corners[i + 1].second] = h1; // i.e. the other face of a manifold edge
+            }
+        }
+    });
+
+    return num_faces;
+}
+} // namespace
+
+uint32_t hmesh_t::build_from_arrays(
+#if defined(MCUT_MULTI_THREADED)
+    thread_pool& scheduler,
+    uint32_t serial_execution_threshold,
+#endif
+    const uint32_t* face_indices,
+    const std::vector<uint32_t>& face_offsets)
+{
+    MCUT_ASSERT(!face_offsets.empty());
+    MCUT_ASSERT(m_edges.empty() && m_halfedges.empty() && m_faces.empty());
+    MCUT_ASSERT(m_edges_removed.empty() && m_halfedges_removed.empty() && m_faces_removed.empty());
+
+#if defined(MCUT_MULTI_THREADED)
+    const block_executor_t for_each_block(scheduler, serial_execution_threshold);
+#else
+    const block_executor_t for_each_block;
+#endif
+
+    const uint32_t num_faces = (uint32_t)face_offsets.size() - 1;
+    std::vector<halfedge_descriptor_t> corner_halfedge;
+    std::vector<vertex_descriptor_t> halfedge_target;
+
+    const uint32_t num_faces_matched = match_corners_to_halfedges(
+#if defined(MCUT_MULTI_THREADED)
+        scheduler,
+        serial_execution_threshold,
+#endif
+        for_each_block,
+        (uint32_t)m_vertices.size(),
+        face_indices,
+        face_offsets,
+        corner_halfedge,
+        halfedge_target);
+
+    if (num_faces_matched != num_faces) {
+        return num_faces_matched;
+    }
+
+    const uint32_t num_halfedges = (uint32_t)halfedge_target.size();
+
+    m_edges.resize(num_halfedges / 2);
+    m_halfedges.resize(num_halfedges);
+
+    for_each_block(num_halfedges, [&](uint32_t first, uint32_t last) {
+        for (uint32_t i = first; i < last; ++i) {
+            const halfedge_descriptor_t h(i);
+            const edge_descriptor_t e(i / 2);
+
+            if ((i % 2) == 0) {
+                m_edges[e].h = h; // see: add_edge
+            }
+
+            halfedge_data_t& hd = m_halfedges[h];
+            hd.t = halfedge_target[h];
+            hd.o = halfedge_descriptor_t(i ^ 1);
+            hd.e = e;
+        }
+    });
+
+    m_faces.resize(num_faces);
+
+    for_each_block(num_faces, [&](uint32_t first_face, uint32_t last_face) {
+        for (uint32_t f = first_face; f < last_face; ++f) {
+            const uint32_t face_begin = face_offsets[f];
+            const uint32_t face_end = face_offsets[f + 1];
+
+            m_faces[f].m_halfedges.assign(corner_halfedge.cbegin() + face_begin, corner_halfedge.cbegin() + face_end);
+
+            for (uint32_t c = face_begin; c < face_end; ++c) {
+                halfedge_data_t& hd = m_halfedges[corner_halfedge[c]];
+                hd.f = face_descriptor_t(f);
+                hd.n = corner_halfedge[(c + 1 < face_end) ? c + 1 : face_begin];
+                hd.p = corner_halfedge[(c > face_begin) ? c - 1 : face_end - 1];
+            }
+        }
+    });
+
+    // the halfedges that point to each vertex, in the order of creation (see: add_edge)
+    for (uint32_t h = 0; h < (uint32_t)m_halfedges.size(); ++h) {
+        m_vertices[m_halfedges[h].t].m_halfedges.emplace_back(h);
+    }
+
+    if (m_edge_index_enabled) {
+        enable_edge_index(true); // i.e. rebuild
+    }
+
+    return num_faces;
+}
+
+void hmesh_t::build_from_compact(
+#if defined(MCUT_MULTI_THREADED)
+    thread_pool& scheduler,
+    uint32_t serial_execution_threshold,
+#endif
+    const compact_hmesh_t& mesh)
+{
+    MCUT_ASSERT(m_vertices.empty() && m_edges.empty() && m_halfedges.empty() && m_faces.empty());
+    MCUT_ASSERT(mesh.number_of_vertices() == mesh.number_of_internal_vertices());
+    MCUT_ASSERT(mesh.number_of_halfedges() == mesh.number_of_internal_halfedges());
+    MCUT_ASSERT(mesh.number_of_faces() == mesh.number_of_internal_faces());
+
+#if defined(MCUT_MULTI_THREADED)
+    const block_executor_t for_each_block(scheduler, serial_execution_threshold);
+#else
+    const block_executor_t for_each_block;
+#endif
+
+    const uint32_t num_vertices = (uint32_t)mesh.number_of_internal_vertices();
+    const uint32_t num_halfedges = (uint32_t)mesh.number_of_internal_halfedges();
+    const uint32_t num_faces = (uint32_t)mesh.number_of_internal_faces();
+
+    m_vertices.resize(num_vertices);
+
+    for_each_block(num_vertices, [&](uint32_t first, uint32_t last) {
+        for (uint32_t i = first; i < last; ++i) {
+            const vertex_descriptor_t v(i);
+            m_vertices[v].p = mesh.vertex(v);
+            m_vertices[v].m_halfedges.assign(mesh.halfedges_around_vertex_begin(v), mesh.halfedges_around_vertex_end(v));
+        }
+    });
+
+    m_edges.resize(num_halfedges / 2);
+    m_halfedges.resize(num_halfedges);
+
+    for_each_block(num_halfedges, [&](uint32_t first, uint32_t last) {
+        for (uint32_t i = first; i < last; ++i) {
+            const halfedge_descriptor_t h(i);
+            const edge_descriptor_t e(i / 2);
+
+            if ((i % 2) == 0) {
+                m_edges[e].h = h; // see: add_edge
+            }
+
+            halfedge_data_t& hd = m_halfedges[h];
+            hd.t = mesh.target(h);
+            hd.o = mesh.opposite(h);
+            hd.e = e;
+            hd.f = mesh.face(h);
+            hd.n = mesh.next(h);
+        }
+    });
+
+    m_faces.resize(num_faces);
+
+    for_each_block(num_faces, [&](uint32_t first_face, uint32_t last_face) {
+        for (uint32_t f = first_face; f < last_face; ++f) {
+            std::vector<halfedge_descriptor_t>& face_halfedges = m_faces[f].m_halfedges;
+            const halfedge_descriptor_t first_halfedge = mesh.halfedge(face_descriptor_t(f));
+            halfedge_descriptor_t h = first_halfedge;
+
+            do {
+                face_halfedges.push_back(h);
+                h = mesh.next(h);
+            } while (h != first_halfedge);
+
+            for (uint32_t i = 0; i < (uint32_t)face_halfedges.size(); ++i) {
+                m_halfedges[face_halfedges[i]].p = face_halfedges[(i > 0) ? i - 1 : face_halfedges.size() - 1];
+            }
+        }
+    });
+
+    if (m_edge_index_enabled) {
+        enable_edge_index(true); // i.e. rebuild
+    }
+}
+
 bool hmesh_t::is_insertable(const std::vector<vertex_descriptor_t>& vi) const
 {
     const int face_vertex_count = static_cast<int>(vi.size());
@@ -826,10 +1312,7 @@ vertex_array_iterator_t hmesh_t::vertices_begin(bool account_for_removed_elems)
 {
     vertex_array_t::const_iterator it = m_vertices.cbegin();
     if (account_for_removed_elems) {
-        uint32_t index = 0;
-        while (it != m_vertices.cend() && is_removed(vertex_descriptor_t(index++)) /*is_removed(it)*/) {
-            ++it; // shift the pointer to the first valid mesh element
-        }
+        it += std::min(m_vertices_removed_bitset.find_next_not_removed(0), (uint32_t)m_vertices.size()); // i.e. the first valid mesh element
     }
     return vertex_array_iterator_t(it, this);
 }
@@ -843,10 +1326,7 @@ edge_array_iterator_t hmesh_t::edges_begin(bool account_for_removed_elems) const
 {
     edge_array_t::const_iterator it = m_edges.cbegin();
     if (account_for_removed_elems) {
-        uint32_t index = 0;
-        while (it != m_edges.cend() && is_removed(edge_descriptor_t(index++) /*it->first*/)) {
-            ++it; // shift the pointer to the first valid mesh element
-        }
+        it += std::min(m_edges_removed_bitset.find_next_not_removed(0), (uint32_t)m_edges.size()); // i.e. the first valid mesh element
     }
     return edge_array_iterator_t(it, this);
 }
@@ -860,10 +1340,7 @@ halfedge_array_iterator_t hmesh_t::halfedges_begin(bool account_for_removed_elem
 {
     halfedge_array_t::const_iterator it = m_halfedges.cbegin();
     if (account_for_removed_elems) {
-        uint32_t index = 0;
-        while (it != m_halfedges.cend() && is_removed(halfedge_descriptor_t(index++) /*it->first*/)) {
-            ++it; // shift the pointer to the first valid mesh element
-        }
+        it += std::min(m_halfedges_removed_bitset.find_next_not_removed(0), (uint32_t)m_halfedges.size()); // i.e. the first valid mesh element
     }
     return halfedge_array_iterator_t(it, this);
 }
@@ -877,10 +1354,7 @@ face_array_iterator_t hmesh_t::faces_begin(bool account_for_removed_elems) const
 {
     face_array_t::const_iterator it = m_faces.cbegin();
     if (account_for_removed_elems) {
-        uint32_t index = 0;
-        while (it != m_faces.cend() && is_removed(face_descriptor_t(index++) /*it->first*/)) {
-            ++it; // shift the pointer to the first valid mesh element
-        }
+        it += std::min(m_faces_removed_bitset.find_next_not_removed(0), (uint32_t)m_faces.size()); // i.e. the first valid mesh element
     }
     return face_array_iterator_t(it, this);
 }
@@ -894,7 +1368,7 @@ face_array_iterator_t hmesh_t::faces_end() const
 void hmesh_t::remove_face(const face_descriptor_t f)
 {
     MCUT_ASSERT(f != null_face());
-    MCUT_ASSERT(std::find(m_faces_removed.cbegin(), m_faces_removed.cend(), f) == m_faces_removed.cend());
+    MCUT_ASSERT(!is_removed(f));
 
     face_data_t& fd = m_faces[f];
 
@@ -947,13 +1421,14 @@ void hmesh_t::remove_face(const face_descriptor_t f)
     }
 
     m_faces_removed.push_back(f);
+    m_faces_removed_bitset.insert(f);
 }
 
 // also disassociates (not remove) the halfedges(s) and vertex incident to this halfedge
 void hmesh_t::remove_halfedge(halfedge_descriptor_t h)
 {
     MCUT_ASSERT(h != null_halfedge());
-    MCUT_ASSERT(std::find(m_halfedges_removed.cbegin(), m_halfedges_removed.cend(), h) == m_halfedges_removed.cend());
+    MCUT_ASSERT(!is_removed(h));
 
     halfedge_data_t& hd = m_halfedges[h];
 
@@ -998,13 +1473,31 @@ void hmesh_t::remove_halfedge(halfedge_descriptor_t h)
     htd.m_halfedges.erase(hIter); // remove association
 
     m_halfedges_removed.push_back(h);
+    m_halfedges_removed_bitset.insert(h);
+
+    if (m_edge_index_enabled) {
+        // the edge of "h" can no longer be found from its vertices
+        const vertex_descriptor_t s = target(opposite(h));
+        const uint64_t key = edge_index_key(s, hd.t);
+        std::unordered_map<uint64_t, halfedge_descriptor_t>::iterator entry = m_edge_index.find(key);
+
+        if (entry != m_edge_index.end() && edge(entry->second) == edge(h)) {
+            m_edge_index.erase(entry);
+
+            const halfedge_descriptor_t other = find_halfedge(s, hd.t); // i.e. another edge between the same vertices
+
+            if (other != null_halfedge()) {
+                m_edge_index.emplace(key, other);
+            }
+        }
+    }
 }
 
 // also disassociates (not remove) any face(s) incident to edge via its halfedges, and also disassociates the halfedges
 void hmesh_t::remove_edge(const edge_descriptor_t e, bool remove_halfedges)
 {
     MCUT_ASSERT(e != null_edge());
-    MCUT_ASSERT(std::find(m_edges_removed.cbegin(), m_edges_removed.cend(), e) == m_edges_removed.cend());
+    MCUT_ASSERT(!is_removed(e));
 
     edge_data_t& ed = m_edges[e];
     std::vector<halfedge_descriptor_t> halfedges = { ed.h, opposite(ed.h) }; // both halfedges incident to edge must be disassociated
@@ -1025,17 +1518,19 @@ void hmesh_t::remove_edge(const edge_descriptor_t e, bool remove_halfedges)
     ed.h = null_halfedge(); // we are removing the edge so every associated data element must be nullified
 
     m_edges_removed.push_back(e);
+    m_edges_removed_bitset.insert(e);
 }
 
 void hmesh_t::remove_vertex(const vertex_descriptor_t v)
 {
     MCUT_ASSERT(v != null_vertex());
     MCUT_ASSERT((size_t)v < m_vertices.size());
-    MCUT_ASSERT(std::find(m_vertices_removed.cbegin(), m_vertices_removed.cend(), v) == m_vertices_removed.cend());
+    MCUT_ASSERT(!is_removed(v));
     MCUT_ASSERT(m_vertices[v].m_faces.empty());
     MCUT_ASSERT(m_vertices[v].m_halfedges.empty());
 
     m_vertices_removed.emplace_back(v);
+    m_vertices_removed_bitset.insert(v);
 }
 
 void hmesh_t::remove_elements()
@@ -1063,18 +1558,188 @@ void hmesh_t::reset()
     m_vertices.shrink_to_fit();
     m_vertices_removed.clear();
     m_vertices_removed.shrink_to_fit();
+    m_vertices_removed_bitset.clear();
     m_halfedges.clear();
     m_halfedges.shrink_to_fit();
     m_halfedges_removed.clear();
     m_halfedges_removed.shrink_to_fit();
+    m_halfedges_removed_bitset.clear();
     m_edges.clear();
     m_edges.shrink_to_fit();
     m_edges_removed.clear();
     m_edges_removed.shrink_to_fit();
+    m_edges_removed_bitset.clear();
     m_faces.clear();
     m_faces.shrink_to_fit();
     m_faces_removed.clear();
     m_faces_removed.shrink_to_fit();
+    m_faces_removed_bitset.clear();
+    m_edge_index.clear();
+    m_compaction_count++;
+}
+
+namespace {
+// new descriptor of each element (in order), where removed elements map to null descriptors
+template <typename D>
+std::vector<D> make_compaction_map(uint32_t num_elements, const removed_elements_bitset_t& removed)
+{
+    std::vector<D> map(num_elements);
+    uint32_t next = 0;
+
+    for (uint32_t i = 0; i < num_elements; ++i) {
+        if (!removed.contains(i)) {
+            map[i] = D(next++);
+        }
+    }
+
+    return map;
+}
+
+template <typename D>
+inline D remap_descriptor(const std::vector<D>& map, const D d)
+{
+    return d.is_valid() ? map[d] : d;
+}
+
+template <typename D>
+void remap_descriptors(const std::vector<D>& map, std::vector<D>& descriptors)
+{
+    for (typename std::vector<D>::iterator i = descriptors.begin(); i != descriptors.end(); ++i) {
+        *i = remap_descriptor(map, *i);
+        MCUT_ASSERT(i->is_valid());
+    }
+}
+} // namespace
+
+hmesh_remap_t hmesh_t::compact()
+{
+    hmesh_remap_t remap;
+
+    remap.vertices = make_compaction_map<vertex_descriptor_t>((uint32_t)m_vertices.size(), m_vertices_removed_bitset);
+    remap.edges = make_compaction_map<edge_descriptor_t>((uint32_t)m_edges.size(), m_edges_removed_bitset);
+    remap.halfedges = make_compaction_map<halfedge_descriptor_t>((uint32_t)m_halfedges.size(), m_halfedges_removed_bitset);
+    remap.faces = make_compaction_map<face_descriptor_t>((uint32_t)m_faces.size(), m_faces_removed_bitset);
+
+    uint32_t n = 0;
+
+    for (uint32_t i = 0; i < (uint32_t)m_vertices.size(); ++i) {
+        if (!remap.vertices[i].is_valid()) {
+            continue;
+        }
+
+        vertex_data_t& vd = m_vertices[i];
+        remap_descriptors(remap.faces, vd.m_faces);
+        remap_descriptors(remap.halfedges, vd.m_halfedges);
+
+        if (n != i) {
+            m_vertices[n] = std::move(vd);
+        }
+        n++;
+    }
+
+    m_vertices.resize(n);
+    n = 0;
+
+    for (uint32_t i = 0; i < (uint32_t)m_edges.size(); ++i) {
+        if (!remap.edges[i].is_valid()) {
+            continue;
+        }
+
+        m_edges[n] = m_edges[i];
+        m_edges[n].h = remap_descriptor(remap.halfedges, m_edges[n].h);
+        n++;
+    }
+
+    m_edges.resize(n);
+    n = 0;
+
+    for (uint32_t i = 0; i < (uint32_t)m_halfedges.size(); ++i) {
+        if (!remap.halfedges[i].is_valid()) {
+            continue;
+        }
+
+#if ENABLE_EDGE_DESCRIPTOR_TRICK
+        // the halfedges of an edge must stay next to each other (see: opposite)
+        MCUT_ASSERT(remap.halfedges[i] == halfedge_descriptor_t(remap.edges[i / 2] * 2 + (i % 2)));
+#endif
+
+        halfedge_data_t hd = m_halfedges[i];
+        hd.o = remap_descriptor(remap.halfedges, hd.o);
+        hd.n = remap_descriptor(remap.halfedges, hd.n);
+        hd.p = remap_descriptor(remap.halfedges, hd.p);
+        hd.t = remap_descriptor(remap.vertices, hd.t);
+        hd.e = remap_descriptor(remap.edges, hd.e);
+        hd.f = remap_descriptor(remap.faces, hd.f);
+        m_halfedges[n++] = hd;
+    }
+
+    m_halfedges.resize(n);
+    n = 0;
+
+    for (uint32_t i = 0; i < (uint32_t)m_faces.size(); ++i) {
+        if (!remap.faces[i].is_valid()) {
+            continue;
+        }
+
+        face_data_t& fd = m_faces[i];
+        remap_descriptors(remap.halfedges, fd.m_halfedges);
+
+        if (n != i) {
+            m_faces[n] = std::move(fd);
+        }
+        n++;
+    }
+
+    m_faces.resize(n);
+
+    m_vertices_removed.clear();
+    m_vertices_removed_bitset.clear();
+    m_edges_removed.clear();
+    m_edges_removed_bitset.clear();
+    m_halfedges_removed.clear();
+    m_halfedges_removed_bitset.clear();
+    m_faces_removed.clear();
+    m_faces_removed_bitset.clear();
+
+    if (m_edge_index_enabled) {
+        enable_edge_index(true); // i.e. rebuild
+    }
+
+    m_compaction_count++;
+
+    return remap;
+}
+
+uint32_t hmesh_t::number_of_compactions() const
+{
+    return m_compaction_count;
+}
+
+void hmesh_t::enable_edge_index(bool enable)
+{
+    m_edge_index_enabled = enable;
+    m_edge_index.clear();
+
+    if (!enable) {
+        std::unordered_map<uint64_t, halfedge_descriptor_t>().swap(m_edge_index); // free memory
+        return;
+    }
+
+    m_edge_index.reserve(m_edges.size());
+
+    for (uint32_t i = 0; i + 1 < (uint32_t)m_halfedges.size(); i += 2) {
+        const halfedge_descriptor_t h0(i); // primary halfedge
+        const halfedge_descriptor_t h1(i + 1);
+
+        if (!is_removed(h0) && !is_removed(h1)) {
+            m_edge_index.emplace(edge_index_key(target(h1), target(h0)), h0);
+        }
+    }
+}
+
+bool hmesh_t::is_edge_index_enabled() const
+{
+    return m_edge_index_enabled;
 }
 
 int hmesh_t::number_of_internal_faces() const
@@ -1120,22 +1785,22 @@ int hmesh_t::number_of_faces_removed() const
 
 bool hmesh_t::is_removed(face_descriptor_t f) const
 {
-    return std::find(m_faces_removed.cbegin(), m_faces_removed.cend(), f) != m_faces_removed.cend();
+    return m_faces_removed_bitset.contains(f);
 }
 
 bool hmesh_t::is_removed(edge_descriptor_t e) const
 {
-    return std::find(m_edges_removed.cbegin(), m_edges_removed.cend(), e) != m_edges_removed.cend();
+    return m_edges_removed_bitset.contains(e);
 }
 
 bool hmesh_t::is_removed(halfedge_descriptor_t h) const
 {
-    return std::find(m_halfedges_removed.cbegin(), m_halfedges_removed.cend(), h) != m_halfedges_removed.cend();
+    return m_halfedges_removed_bitset.contains(h);
 }
 
 bool hmesh_t::is_removed(vertex_descriptor_t v) const
 {
-    return std::find(m_vertices_removed.cbegin(), m_vertices_removed.cend(), v) != m_vertices_removed.cend();
+    return m_vertices_removed_bitset.contains(v);
 }
 
 void hmesh_t::reserve_for_additional_vertices(std::uint32_t n)
@@ -1190,6 +1855,26 @@ const std::vector<face_descriptor_t>& hmesh_t::get_removed_elements(id_<array_it
     return get_removed_faces();
 }
 
+const removed_elements_bitset_t& hmesh_t::get_removed_elements_bitset(id_<array_iterator_t<vertex_array_t>>) const
+{
+    return m_vertices_removed_bitset;
+}
+
+const removed_elements_bitset_t& hmesh_t::get_removed_elements_bitset(id_<array_iterator_t<edge_array_t>>) const
+{
+    return m_edges_removed_bitset;
+}
+
+const removed_elements_bitset_t& hmesh_t::get_removed_elements_bitset(id_<array_iterator_t<halfedge_array_t>>) const
+{
+    return m_halfedges_removed_bitset;
+}
+
+const removed_elements_bitset_t& hmesh_t::get_removed_elements_bitset(id_<array_iterator_t<face_array_t>>) const
+{
+    return m_faces_removed_bitset;
+}
+
 const std::vector<vertex_descriptor_t>& hmesh_t::get_removed_vertices() const
 {
     return m_vertices_removed;
@@ -1396,3 +2081,305 @@ void read_off(hmesh_t& mesh, const char* fpath)
 
     infile.close();
 }
+
+//
+// compact_hmesh_t
+//
+
+compact_hmesh_t::compact_hmesh_t()
+    : m_num_removed_vertices(0)
+    , m_num_removed_halfedges(0)
+    , m_num_removed_faces(0)
+{
+}
+
+compact_hmesh_t::compact_hmesh_t(const hmesh_t& mesh)
+    : compact_hmesh_t()
+{
+    build(mesh);
+}
+
+void compact_hmesh_t::build(const hmesh_t& mesh)
+{
+    const uint32_t num_vertices = (uint32_t)mesh.number_of_internal_vertices();
+    const uint32_t num_halfedges = (uint32_t)mesh.number_of_internal_halfedges();
+    const uint32_t num_faces = (uint32_t)mesh.number_of_internal_faces();
+
+    m_num_removed_vertices = mesh.number_of_vertices_removed();
+    m_num_removed_halfedges = mesh.number_of_halfedges_removed();
+    m_num_removed_faces = mesh.number_of_faces_removed();
+
+    std::vector<bool> vertex_removed(num_vertices, false);
+    for (std::vector<vd_t>::const_iterator v = mesh.get_removed_vertices().cbegin(); v != mesh.get_removed_vertices().cend(); ++v) {
+        vertex_removed[*v] = true;
+    }
+
+    m_vertex_positions.resize(num_vertices);
+
+    for (uint32_t i = 0; i < num_vertices; ++i) {
+        if (!vertex_removed[i]) {
+            m_vertex_positions[i] = mesh.vertex(vd_t(i));
+        }
+    }
+
+    if (m_num_removed_vertices > 0) {
+        m_vertex_removed.swap(vertex_removed);
+    } else {
+        m_vertex_removed.clear();
+    }
+
+    m_halfedge_next.assign(num_halfedges, hmesh_t::null_halfedge());
+    m_halfedge_target.assign(num_halfedges, hmesh_t::null_vertex()); // i.e. for removed halfedges
+    m_halfedge_face.assign(num_halfedges, hmesh_t::null_face());
+
+    for (uint32_t i = 0; i < num_halfedges; ++i) {
+        if (mesh.is_removed(hd_t(i))) {
+            continue;
+        }
+
+        const hd_t h(i);
+        m_halfedge_next[i] = mesh.next(h);
+        m_halfedge_target[i] = mesh.target(h);
+        m_halfedge_face[i] = mesh.face(h);
+    }
+
+    m_face_halfedge.assign(num_faces, hmesh_t::null_halfedge());
+
+    for (uint32_t i = 0; i < num_faces; ++i) {
+        if (!mesh.is_removed(fd_t(i))) {
+            m_face_halfedge[i] = mesh.get_halfedges_around_face(fd_t(i)).front();
+        }
+    }
+
+    build_vertex_halfedges();
+}
+
+uint32_t compact_hmesh_t::build_from_arrays(
+#if defined(MCUT_MULTI_THREADED)
+    thread_pool& scheduler,
+    uint32_t serial_execution_threshold,
+#endif
+    std::vector<vec3>& vertex_positions,
+    const uint32_t* face_indices,
+    const std::vector<uint32_t>& face_offsets)
+{
+    MCUT_ASSERT(!face_offsets.empty());
+
+#if defined(MCUT_MULTI_THREADED)
+    const block_executor_t for_each_block(scheduler, serial_execution_threshold);
+#else
+    const block_executor_t for_each_block;
+#endif
+
+    const uint32_t num_faces = (uint32_t)face_offsets.size() - 1;
+    std::vector<halfedge_descriptor_t> corner_halfedge;
+    std::vector<vertex_descriptor_t> halfedge_target;
+
+    const uint32_t num_faces_matched = match_corners_to_halfedges(
+#if defined(MCUT_MULTI_THREADED)
+        scheduler,
+        serial_execution_threshold,
+#endif
+        for_each_block,
+        (uint32_t)vertex_positions.size(),
+        face_indices,
+        face_offsets,
+        corner_halfedge,
+        halfedge_target);
+
+    if (num_faces_matched != num_faces) {
+        return num_faces_matched;
+    }
+
+    const uint32_t num_halfedges = (uint32_t)halfedge_target.size();
+
+    m_num_removed_vertices = 0;
+    m_num_removed_halfedges = 0;
+    m_num_removed_faces = 0;
+
+    m_vertex_positions.swap(vertex_positions);
+    vertex_positions.clear();
+    m_vertex_removed.clear();
+
+    m_halfedge_target.swap(halfedge_target);
+    m_halfedge_next.assign(num_halfedges, hmesh_t::null_halfedge()); // i.e. a border halfedge has no face
+    m_halfedge_face.assign(num_halfedges, hmesh_t::null_face());
+    m_face_halfedge.resize(num_faces);
+
+    for_each_block(num_faces, [&](uint32_t first_face, uint32_t last_face) {
+        for (uint32_t f = first_face; f < last_face; ++f) {
+            const uint32_t face_begin = face_offsets[f];
+            const uint32_t face_end = face_offsets[f + 1];
+
+            m_face_halfedge[f] = corner_halfedge[face_begin];
+
+            for (uint32_t c = face_begin; c < face_end; ++c) {
+                const halfedge_descriptor_t h = corner_halfedge[c];
+                m_halfedge_next[h] = corner_halfedge[(c + 1 < face_end) ? c + 1 : face_begin];
+                m_halfedge_face[h] = face_descriptor_t(f);
+            }
+        }
+    });
+
+    build_vertex_halfedges();
+
+    return num_faces;
+}
+
+void compact_hmesh_t::build_vertex_halfedges()
+{
+    const uint32_t num_vertices = (uint32_t)m_vertex_positions.size();
+    const uint32_t num_halfedges = (uint32_t)m_halfedge_target.size();
+
+    // number of halfedges around each vertex, which are then turned into offsets
+    m_vertex_halfedges_offsets.assign((size_t)num_vertices + 1, 0);
+
+    for (uint32_t i = 0; i < num_halfedges; ++i) {
+        if (m_halfedge_target[i] != hmesh_t::null_vertex()) { // i.e. not removed
+            m_vertex_halfedges_offsets[(size_t)m_halfedge_target[i] + 1] += 1;
+        }
+    }
+
+    for (uint32_t i = 0; i < num_vertices; ++i) {
+        m_vertex_halfedges_offsets[(size_t)i + 1] += m_vertex_halfedges_offsets[i];
+    }
+
+    m_vertex_halfedges.resize(m_vertex_halfedges_offsets.back());
+
+    std::vector<uint32_t> vertex_halfedge_count(num_vertices, 0);
+
+    for (uint32_t i = 0; i < num_halfedges; ++i) {
+        const vd_t t = m_halfedge_target[i];
+
+        if (t == hmesh_t::null_vertex()) {
+            continue;
+        }
+
+        m_vertex_halfedges[m_vertex_halfedges_offsets[t] + vertex_halfedge_count[t]] = hd_t(i);
+        vertex_halfedge_count[t] += 1;
+    }
+}
+
+int compact_hmesh_t::number_of_vertices() const
+{
+    return number_of_internal_vertices() - m_num_removed_vertices;
+}
+
+int compact_hmesh_t::number_of_halfedges() const
+{
+    return number_of_internal_halfedges() - m_num_removed_halfedges;
+}
+
+int compact_hmesh_t::number_of_faces() const
+{
+    return number_of_internal_faces() - m_num_removed_faces;
+}
+
+int compact_hmesh_t::number_of_internal_vertices() const
+{
+    return (int)m_vertex_positions.size();
+}
+
+int compact_hmesh_t::number_of_internal_halfedges() const
+{
+    return (int)m_halfedge_next.size();
+}
+
+int compact_hmesh_t::number_of_internal_faces() const
+{
+    return (int)m_face_halfedge.size();
+}
+
+bool compact_hmesh_t::is_removed(const face_descriptor_t f) const
+{
+    MCUT_ASSERT((size_t)f < m_face_halfedge.size());
+    return m_face_halfedge[f] == hmesh_t::null_halfedge();
+}
+
+bool compact_hmesh_t::is_removed(const vertex_descriptor_t v) const
+{
+    MCUT_ASSERT((size_t)v < m_vertex_positions.size());
+    return !m_vertex_removed.empty() && m_vertex_removed[v];
+}
+
+const vec3& compact_hmesh_t::vertex(const vertex_descriptor_t v) const
+{
+    MCUT_ASSERT((size_t)v < m_vertex_positions.size());
+    return m_vertex_positions[v];
+}
+
+vertex_descriptor_t compact_hmesh_t::source(const halfedge_descriptor_t h) const
+{
+    return target(opposite(h));
+}
+
+vertex_descriptor_t compact_hmesh_t::target(const halfedge_descriptor_t h) const
+{
+    MCUT_ASSERT((size_t)h < m_halfedge_target.size());
+    return m_halfedge_target[h];
+}
+
+halfedge_descriptor_t compact_hmesh_t::opposite(const halfedge_descriptor_t h) const
+{
+    MCUT_ASSERT((size_t)h < m_halfedge_next.size());
+    return halfedge_descriptor_t((h % 2 == 0) ? h + 1 : h - 1);
+}
+
+halfedge_descriptor_t compact_hmesh_t::next(const halfedge_descriptor_t h) const
+{
+    MCUT_ASSERT((size_t)h < m_halfedge_next.size());
+    return m_halfedge_next[h];
+}
+
+face_descriptor_t compact_hmesh_t::face(const halfedge_descriptor_t h) const
+{
+    MCUT_ASSERT((size_t)h < m_halfedge_face.size());
+    return m_halfedge_face[h];
+}
+
+halfedge_descriptor_t compact_hmesh_t::halfedge(const face_descriptor_t f) const
+{
+    MCUT_ASSERT((size_t)f < m_face_halfedge.size());
+    return m_face_halfedge[f];
+}
+
+void compact_hmesh_t::get_vertices_around_face(std::vector<vertex_descriptor_t>& vertex_descriptors, const face_descriptor_t f) const
+{
+    vertex_descriptors.clear();
+
+    const halfedge_descriptor_t first = halfedge(f);
+    MCUT_ASSERT(first != hmesh_t::null_halfedge());
+    halfedge_descriptor_t h = first;
+
+    do {
+        vertex_descriptors.push_back(target(h));
+        h = next(h);
+    } while (h != first);
+}
+
+uint32_t compact_hmesh_t::get_num_vertices_around_face(const face_descriptor_t f) const
+{
+    const halfedge_descriptor_t first = halfedge(f);
+    MCUT_ASSERT(first != hmesh_t::null_halfedge());
+    halfedge_descriptor_t h = first;
+    uint32_t n = 0;
+
+    do {
+        n++;
+        h = next(h);
+    } while (h != first);
+
+    return n;
+}
+
+const halfedge_descriptor_t* compact_hmesh_t::halfedges_around_vertex_begin(const vertex_descriptor_t v) const
+{
+    MCUT_ASSERT((size_t)v < m_vertex_positions.size());
+    return m_vertex_halfedges.data() + m_vertex_halfedges_offsets[v];
+}
+
+const halfedge_descriptor_t* compact_hmesh_t::halfedges_around_vertex_end(const vertex_descriptor_t v) const
+{
+    MCUT_ASSERT((size_t)v < m_vertex_positions.size());
+    return m_vertex_halfedges.data() + m_vertex_halfedges_offsets[(size_t)v + 1];
+}
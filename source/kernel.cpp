@@ -20,6 +20,7 @@
  * Author(s)     : Floyd M. Chitalu
  */
 #include <algorithm>
+#include <array>
 #include <functional>
 #include <iterator>
 #include <numeric> // std::iota
@@ -146,6 +147,227 @@ bool inline ps_is_cutmesh_face(const fd_t& ps_fd, const int sm_face_count)
     return ((int)ps_fd) >= sm_face_count;
 }
 
+// Random-access iterator over a range of consecutive element descriptors (e.g. of the polygon soup,
+// whose elements are not stored in one array)
+template <typename D>
+class descriptor_iterator_t {
+    D m_descriptor;
+
+public:
+    typedef std::random_access_iterator_tag iterator_category;
+    typedef D value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const D* pointer;
+    typedef D reference;
+
+    descriptor_iterator_t() { }
+    explicit descriptor_iterator_t(uint32_t index)
+        : m_descriptor(index)
+    {
+    }
+
+    D operator*() const { return m_descriptor; }
+
+    descriptor_iterator_t& operator++()
+    {
+        ++m_descriptor;
+        return *this;
+    }
+
+    descriptor_iterator_t& operator--()
+    {
+        --m_descriptor;
+        return *this;
+    }
+
+    descriptor_iterator_t& operator+=(difference_type n)
+    {
+        m_descriptor += n;
+        return *this;
+    }
+
+    descriptor_iterator_t& operator-=(difference_type n)
+    {
+        m_descriptor += -n;
+        return *this;
+    }
+
+    descriptor_iterator_t operator+(difference_type n) const { return descriptor_iterator_t(*this) += n; }
+    descriptor_iterator_t operator-(difference_type n) const { return descriptor_iterator_t(*this) -= n; }
+    difference_type operator-(const descriptor_iterator_t& other) const { return (difference_type)m_descriptor - (difference_type)other.m_descriptor; }
+
+    bool operator==(const descriptor_iterator_t& other) const { return m_descriptor == other.m_descriptor; }
+    bool operator!=(const descriptor_iterator_t& other) const { return m_descriptor != other.m_descriptor; }
+    bool operator<(const descriptor_iterator_t& other) const { return m_descriptor < other.m_descriptor; }
+};
+
+// The polygon soup of the source mesh and the cut mesh, which is a view of the two meshes (i.e. not a copy).
+// The elements of the cut mesh follow those of the source mesh, so the descriptor of a cut-mesh element is that in
+// the cut mesh offset by the number of source-mesh elements (see: ps_is_cutmesh_vertex and ps_is_cutmesh_face).
+class polygon_soup_t {
+    const hmesh_t& m_sm;
+    const hmesh_t& m_cm;
+
+    // number of source-mesh elements (including any removed edges/halfedges, which are holes in the soup too)
+    const uint32_t m_sm_vertex_count;
+    const uint32_t m_sm_edge_count;
+    const uint32_t m_sm_halfedge_count;
+    const uint32_t m_sm_face_count;
+
+    bool is_cm_vertex(const vd_t& v) const { return (uint32_t)v >= m_sm_vertex_count; }
+    bool is_cm_edge(const ed_t& e) const { return (uint32_t)e >= m_sm_edge_count; }
+    bool is_cm_halfedge(const hd_t& h) const { return (uint32_t)h >= m_sm_halfedge_count; }
+    bool is_cm_face(const fd_t& f) const { return (uint32_t)f >= m_sm_face_count; }
+
+    // from the descriptors of the cut mesh to those of the soup (null descriptors stay null)
+    vd_t from_cm(const vd_t& v) const { return v.is_valid() ? vd_t(v + m_sm_vertex_count) : v; }
+    ed_t from_cm(const ed_t& e) const { return e.is_valid() ? ed_t(e + m_sm_edge_count) : e; }
+    hd_t from_cm(const hd_t& h) const { return h.is_valid() ? hd_t(h + m_sm_halfedge_count) : h; }
+    fd_t from_cm(const fd_t& f) const { return f.is_valid() ? fd_t(f + m_sm_face_count) : f; }
+
+public:
+    typedef descriptor_iterator_t<vd_t> vertex_iterator_t;
+    typedef descriptor_iterator_t<ed_t> edge_iterator_t; // NOTE: includes removed edges (see: is_removed)
+    typedef descriptor_iterator_t<fd_t> face_iterator_t;
+
+    polygon_soup_t(const hmesh_t& sm, const hmesh_t& cm)
+        : m_sm(sm)
+        , m_cm(cm)
+        , m_sm_vertex_count((uint32_t)sm.number_of_internal_vertices())
+        , m_sm_edge_count((uint32_t)sm.number_of_internal_edges())
+        , m_sm_halfedge_count((uint32_t)sm.number_of_internal_halfedges())
+        , m_sm_face_count((uint32_t)sm.number_of_internal_faces())
+    {
+        // vertices and faces are numbered consecutively in the soup (see: ps_is_cutmesh_vertex)
+        MCUT_ASSERT(sm.number_of_vertices_removed() == 0 && cm.number_of_vertices_removed() == 0);
+        MCUT_ASSERT(sm.number_of_faces_removed() == 0 && cm.number_of_faces_removed() == 0);
+    }
+
+    int number_of_vertices() const { return m_sm.number_of_vertices() + m_cm.number_of_vertices(); }
+    int number_of_edges() const { return m_sm.number_of_edges() + m_cm.number_of_edges(); }
+    int number_of_faces() const { return m_sm.number_of_faces() + m_cm.number_of_faces(); }
+    int number_of_internal_edges() const { return m_sm.number_of_internal_edges() + m_cm.number_of_internal_edges(); }
+
+    vertex_iterator_t vertices_begin() const { return vertex_iterator_t(0); }
+    vertex_iterator_t vertices_end() const { return vertex_iterator_t((uint32_t)number_of_vertices()); }
+    edge_iterator_t edges_begin() const { return edge_iterator_t(0); }
+    edge_iterator_t edges_end() const { return edge_iterator_t((uint32_t)number_of_internal_edges()); }
+    face_iterator_t faces_begin() const { return face_iterator_t(0); }
+    face_iterator_t faces_end() const { return face_iterator_t((uint32_t)number_of_faces()); }
+
+    bool is_removed(const ed_t& e) const
+    {
+        return is_cm_edge(e) ? m_cm.is_removed(ed_t(e - m_sm_edge_count)) : m_sm.is_removed(e);
+    }
+
+    const vec3& vertex(const vd_t& v) const
+    {
+        return is_cm_vertex(v) ? m_cm.vertex(vd_t(v - m_sm_vertex_count)) : m_sm.vertex(v);
+    }
+
+    vd_t vertex(const ed_t& e, const int i) const
+    {
+        return is_cm_edge(e) ? from_cm(m_cm.vertex(ed_t(e - m_sm_edge_count), i)) : m_sm.vertex(e, i);
+    }
+
+    vd_t target(const hd_t& h) const
+    {
+        return is_cm_halfedge(h) ? from_cm(m_cm.target(hd_t(h - m_sm_halfedge_count))) : m_sm.target(h);
+    }
+
+    vd_t source(const hd_t& h) const
+    {
+        return is_cm_halfedge(h) ? from_cm(m_cm.source(hd_t(h - m_sm_halfedge_count))) : m_sm.source(h);
+    }
+
+    hd_t opposite(const hd_t& h) const
+    {
+        return is_cm_halfedge(h) ? from_cm(m_cm.opposite(hd_t(h - m_sm_halfedge_count))) : m_sm.opposite(h);
+    }
+
+    ed_t edge(const hd_t& h) const
+    {
+        return is_cm_halfedge(h) ? from_cm(m_cm.edge(hd_t(h - m_sm_halfedge_count))) : m_sm.edge(h);
+    }
+
+    fd_t face(const hd_t& h) const
+    {
+        return is_cm_halfedge(h) ? from_cm(m_cm.face(hd_t(h - m_sm_halfedge_count))) : m_sm.face(h);
+    }
+
+    hd_t halfedge(const ed_t& e, const int i) const
+    {
+        return is_cm_edge(e) ? from_cm(m_cm.halfedge(ed_t(e - m_sm_edge_count), i)) : m_sm.halfedge(e, i);
+    }
+
+    // NOTE: there are no edges between source-mesh vertices and cut-mesh vertices
+    hd_t halfedge(const vd_t& s, const vd_t& t, bool strict_check = false) const
+    {
+        if (is_cm_vertex(s) != is_cm_vertex(t)) {
+            return hmesh_t::null_halfedge();
+        }
+
+        return is_cm_vertex(s) ? from_cm(m_cm.halfedge(vd_t(s - m_sm_vertex_count), vd_t(t - m_sm_vertex_count), strict_check)) : m_sm.halfedge(s, t, strict_check);
+    }
+
+    bool is_border(const ed_t& e) const
+    {
+        return face(halfedge(e, 0)) == hmesh_t::null_face() || face(halfedge(e, 1)) == hmesh_t::null_face();
+    }
+
+    // NOTE: the halfedges of a cut-mesh face start from its second halfedge (in the cut mesh). This is the order
+    // that the face would have if it were added to a mesh with hmesh_t::add_face(cm.get_vertices_around_face(f)),
+    // and the starting vertex matters to the (non-planar) polygons that we test for intersection.
+    std::vector<hd_t> get_halfedges_around_face(const fd_t& f) const
+    {
+        if (!is_cm_face(f)) {
+            return m_sm.get_halfedges_around_face(f);
+        }
+
+        const std::vector<hd_t>& cm_halfedges = m_cm.get_halfedges_around_face(fd_t(f - m_sm_face_count));
+        const uint32_t num_halfedges = (uint32_t)cm_halfedges.size();
+        std::vector<hd_t> halfedges(num_halfedges);
+
+        for (uint32_t i = 0; i < num_halfedges; ++i) {
+            halfedges[i] = from_cm(cm_halfedges[(i + 1) % num_halfedges]);
+        }
+
+        return halfedges;
+    }
+
+    // same order as polygon_soup_t::get_halfedges_around_face
+    void get_vertices_around_face(std::vector<vd_t>& vertices, const fd_t& f) const
+    {
+        if (is_cm_face(f)) {
+            m_cm.get_vertices_around_face(vertices, fd_t(f - m_sm_face_count), m_sm_vertex_count);
+            std::rotate(vertices.begin(), vertices.begin() + 1, vertices.end());
+        } else {
+            m_sm.get_vertices_around_face(vertices, f);
+        }
+    }
+
+    // NOTE: "halfedges_around_face" (optional) is only used for source-mesh faces
+    std::vector<fd_t> get_faces_around_face(const fd_t& f, const std::vector<hd_t>* halfedges_around_face = nullptr) const
+    {
+        if (!is_cm_face(f)) {
+            return m_sm.get_faces_around_face(f, halfedges_around_face);
+        }
+
+        const std::vector<hd_t> halfedges = get_halfedges_around_face(f);
+        std::vector<fd_t> faces;
+
+        for (std::vector<hd_t>::const_iterator h = halfedges.cbegin(); h != halfedges.cend(); ++h) {
+            const fd_t opposite_face = face(opposite(*h));
+
+            if (opposite_face != hmesh_t::null_face()) {
+                faces.push_back(opposite_face);
+            }
+        }
+
+        return faces;
+    }
+};
+
 void dump_mesh(const hmesh_t& mesh, const char* fbasename)
 {
     const std::string name = std::string(fbasename) + ".off";
@@ -176,6 +398,15 @@ void dump_mesh(const hmesh_t& mesh, const char* fbasename)
     write_off(name.c_str(), mesh);
 }
 
+// record the size of an intermediate mesh (see: MC_PROFILING_ENABLE)
+template <typename MeshType>
+void update_peak_element_counts(const MeshType& mesh)
+{
+    if (g_dispatch_stats != nullptr) {
+        g_dispatch_stats->update_peak_element_counts(mesh.number_of_vertices(), mesh.number_of_edges(), mesh.number_of_faces());
+    }
+}
+
 #if 0
 bool point_on_face_plane(const hmesh_t& m, const fd_t& f, const vec3& p, int& fv_count)
 {
@@ -338,12 +569,14 @@ void mark_seam_vertices(
 hmesh_t extract_connected_components(
 #if defined(MCUT_MULTI_THREADED)
     thread_pool& scheduler,
+    const uint32_t serial_execution_threshold,
 #endif
     // key = cc-id; value = list of cc copies each differing by one newly stitched polygon
     std::map<std::size_t, std::vector<std::pair<hmesh_t, connected_component_info_t>>>& connected_components,
     const hmesh_t& in,
     const int traced_polygons_base_offset,
-    const std::vector<std::vector<hd_t>>& mX_traced_polygons, // "m0" or "m1" (dependent on function-call location)
+    const int traced_polygon_count, // i.e. the polygons [traced_polygons_base_offset, traced_polygons_base_offset + traced_polygon_count)
+    const traced_polygons_t& mX_traced_polygons, // "m0" or "m1" (dependent on function-call location)
     const std::vector<int>& sm_polygons_below_cs,
     const std::vector<int>& sm_polygons_above_cs,
     const std::vector<bool>& mesh_vertex_to_seam_flag,
@@ -374,7 +607,7 @@ hmesh_t extract_connected_components(
 
     // the auxilliary halfedge mesh containing vertices and edges referenced by the traced polygons
     hmesh_t mesh = in; // copy
-    mesh.reserve_for_additional_elements((std::uint32_t)mX_traced_polygons.size() / 2);
+    mesh.reserve_for_additional_elements((std::uint32_t)traced_polygon_count / 2);
 
     ///////////////////////////////////////////////////////////////////////////
     // Insert traced polygons into the auxilliary mesh
@@ -382,92 +615,23 @@ hmesh_t extract_connected_components(
 
     TIMESTACK_PUSH("Extract CC: Insert polygons");
 
-#if defined(MCUT_MULTI_THREADED)
-    {
-        typedef std::tuple<
-            std::vector<std::vector<vd_t>> // "mesh" faces
-            >
-            OutputStorageTypesTuple;
-        typedef std::vector<std::vector<hd_t>>::const_iterator InputStorageIteratorType;
-
-        auto fn_compute_inserted_faces = [&mesh](InputStorageIteratorType block_start_, InputStorageIteratorType block_end_) -> OutputStorageTypesTuple {
-            OutputStorageTypesTuple local_output;
-            std::vector<std::vector<vd_t>>& faces_LOCAL = std::get<0>(local_output);
-
-            for (InputStorageIteratorType mX_traced_polygons_iter = block_start_; mX_traced_polygons_iter != block_end_; ++mX_traced_polygons_iter) {
-                const std::vector<hd_t>& mX_traced_polygon = *mX_traced_polygons_iter;
-
-                faces_LOCAL.push_back(std::vector<vd_t>());
-                std::vector<vd_t>& polygon_vertices = faces_LOCAL.back();
-                polygon_vertices.reserve(mX_traced_polygon.size());
+    // NOTE: face "i" is polygon "traced_polygons_base_offset + i". Gathering the vertices is cheap next to
+    // adding the faces (which is done in order), so both are done serially.
+    std::vector<vd_t> polygon_vertices; // reused by each polygon
 
-                // for each halfedge in polygon
-                for (std::vector<hd_t>::const_iterator mX_traced_polygon_halfedge_iter = mX_traced_polygon.cbegin();
-                     mX_traced_polygon_halfedge_iter != mX_traced_polygon.cend();
-                     ++mX_traced_polygon_halfedge_iter) {
-                    polygon_vertices.push_back(mesh.target(*mX_traced_polygon_halfedge_iter));
-                }
-            }
-
-            return local_output;
-        };
-
-        std::vector<std::future<OutputStorageTypesTuple>> futures;
-        OutputStorageTypesTuple partial_res;
-
-        parallel_fork_and_join(
-            scheduler,
-            mX_traced_polygons.cbegin(),
-            mX_traced_polygons.cend(),
-            (1 << 8),
-            fn_compute_inserted_faces,
-            partial_res, // output computed by master thread
-            futures);
-
-        const std::vector<std::vector<vd_t>>& faces_MASTER_THREAD_LOCAL = std::get<0>(partial_res);
-
-        auto merge_local_faces = [&mesh](const std::vector<std::vector<vd_t>>& faces_) {
-            for (std::vector<std::vector<vd_t>>::const_iterator face_iter = faces_.cbegin();
-                 face_iter != faces_.cend();
-                 ++face_iter) {
-                const fd_t f = mesh.add_face(*face_iter);
-                MCUT_ASSERT(f != hmesh_t::null_face());
-            }
-        };
-
-        for (int i = 0; i < (int)futures.size(); ++i) {
-            std::future<OutputStorageTypesTuple>& f = futures[i];
-            MCUT_ASSERT(f.valid());
-            OutputStorageTypesTuple future_result = f.get(); // "get()" is a blocking function
-
-            const std::vector<std::vector<vd_t>>& faces_FUTURE = std::get<0>(future_result);
-
-            merge_local_faces(faces_FUTURE);
-        }
-
-        // merge faces computed by master thread at the end to maintain the same order
-        // of the traced polygons
-        merge_local_faces(faces_MASTER_THREAD_LOCAL);
-    } // endif of parallel scope
-
-#else
     // for each traced polygon
-    for (std::vector<std::vector<hd_t>>::const_iterator mX_traced_polygons_iter = mX_traced_polygons.cbegin();
-         mX_traced_polygons_iter != mX_traced_polygons.cend();
-         ++mX_traced_polygons_iter) {
+    for (int i = 0; i < traced_polygon_count; ++i) {
 
-        // const int polygon_idx = (int)std::distance(traced_polygons.cbegin(), traced_sm_polygon_iter);
-        const std::vector<hd_t>& mX_traced_polygon = *mX_traced_polygons_iter;
+        const traced_polygons_t::const_polygon_t mX_traced_polygon = mX_traced_polygons[(size_t)traced_polygons_base_offset + i];
 
         //
         // gather polygon's vertices
         //
 
-        std::vector<vd_t> polygon_vertices;
-        polygon_vertices.reserve(mX_traced_polygon.size());
+        polygon_vertices.clear();
 
         // for each halfedge in polygon
-        for (std::vector<hd_t>::const_iterator mX_traced_polygon_halfedge_iter = mX_traced_polygon.cbegin();
+        for (traced_polygons_t::const_polygon_t::const_iterator mX_traced_polygon_halfedge_iter = mX_traced_polygon.cbegin();
              mX_traced_polygon_halfedge_iter != mX_traced_polygon.cend();
              ++mX_traced_polygon_halfedge_iter) {
             polygon_vertices.push_back(mesh.target(*mX_traced_polygon_halfedge_iter));
@@ -480,8 +644,8 @@ hmesh_t extract_connected_components(
         // rules probably because we are refering to a halfedge
         // and its opposite in one polygon
         MCUT_ASSERT(f != hmesh_t::null_face());
+        (void)f;
     }
-#endif
     TIMESTACK_POP();
 
     ///////////////////////////////////////////////////////////////////////////
@@ -492,14 +656,14 @@ hmesh_t extract_connected_components(
     std::map<std::size_t, hmesh_t> ccID_to_mesh;
     // location of each connected component w.r.t cut-mesh (above | below | undefined)
     std::map<std::size_t, sm_frag_location_t> ccID_to_cs_descriptor;
-    // for each component, we have a map which relates the vertex descriptors (indices) in the
-    // auxilliary halfedge data structure "mesh" to the (local) vertex descriptors in
-    // the connected-component.
+    // relates the vertex descriptors (indices) in the auxilliary halfedge data structure "mesh" to the
+    // (local) vertex descriptors in the connected-component. A single map suffices for all components
+    // because each vertex of "mesh" belongs to exactly one (vertex-connected) component.
     //
     // the "X" in "...mX_..." stands for "0" or "1" depending on where the current function is called from!
     // Before "m1" is created in "dispatch", X = "0". Afterwards, X == "1" to signify the fact that the
     // input paramater called "in" (in this function) represents "m0" or "m1"
-    std::map<std::size_t, std::unordered_map<vd_t, vd_t>> ccID_to_mX_to_cc_vertex;
+    vertex_property_map_t<vd_t> mX_to_cc_vertex(mesh, hmesh_t::null_vertex());
     // std::map<std::size_t, std::unordered_map<vd_t, vd_t>> ccID_to_cc_to_mX_vertex;
     std::map<std::size_t, std::vector<vd_t>> ccID_to_cc_to_mX_vertex;
     // the vertex descriptors [in the cc] which are seam vertices!
@@ -539,16 +703,6 @@ hmesh_t extract_connected_components(
 
         hmesh_t& cc_mesh = ccID_to_mesh_fiter->second;
 
-        std::map<std::size_t, std::unordered_map<vd_t, vd_t>>::iterator ccID_to_mX_to_cc_vertex_fiter = ccID_to_mX_to_cc_vertex.find(face_cc_id);
-
-        if (ccID_to_mX_to_cc_vertex_fiter == ccID_to_mX_to_cc_vertex.end()) {
-            // create new component descriptor map
-            std::pair<std::map<std::size_t, std::unordered_map<vd_t, vd_t>>::iterator, bool> p = ccID_to_mX_to_cc_vertex.insert(std::make_pair(face_cc_id, std::unordered_map<vd_t, vd_t>()));
-            ccID_to_mX_to_cc_vertex_fiter = p.first;
-        }
-
-        std::unordered_map<vd_t, vd_t>& mX_to_cc_vertex = ccID_to_mX_to_cc_vertex_fiter->second;
-
         std::map<std::size_t, std::vector<vd_t>>::iterator ccID_to_cc_to_mX_vertex_fiter = ccID_to_cc_to_mX_vertex.find(face_cc_id);
 
         if (ccID_to_cc_to_mX_vertex_fiter == ccID_to_cc_to_mX_vertex.end()) {
@@ -614,10 +768,8 @@ hmesh_t extract_connected_components(
              face_vertex_iter != vertices_around_face.cend();
              ++face_vertex_iter) {
 
-            MCUT_ASSERT(ccID_to_mX_to_cc_vertex.find(face_cc_id) != ccID_to_mX_to_cc_vertex.cend());
-
             // if vertex is not already mapped from "mesh" to connected component
-            if (mX_to_cc_vertex.find(*face_vertex_iter) == mX_to_cc_vertex.end()) {
+            if (!mX_to_cc_vertex.contains(*face_vertex_iter)) {
 
                 // MCUT_ASSERT(ccID_to_mesh.find(face_cc_id) != ccID_to_mesh.cend());
 
@@ -626,7 +778,7 @@ hmesh_t extract_connected_components(
                 const vd_t cc_descriptor = cc_mesh.add_vertex(mesh.vertex(*face_vertex_iter));
 
                 // map vertex
-                mX_to_cc_vertex.insert(std::make_pair(*face_vertex_iter, cc_descriptor));
+                mX_to_cc_vertex[*face_vertex_iter] = cc_descriptor;
                 if (popuplate_vertex_maps) {
                     // SAFE_ACCESS(ccID_to_cc_to_mX_vertex, face_cc_id).insert(std::make_pair(cc_descriptor, *face_vertex_iter));
                     cc_to_mX_vertex.push_back(*face_vertex_iter);
@@ -712,24 +864,17 @@ hmesh_t extract_connected_components(
                 MCUT_ASSERT(ccID_to_cc_to_mX_face.find(cc_id) != ccID_to_cc_to_mX_face.cend());
                 // std::vector<fd_t> &cc_to_mX_face = ccID_to_cc_to_mX_face_fiter->second;
 
-                // std::map<std::size_t, std::unordered_map<vd_t, vd_t>>::iterator ccID_to_mX_to_cc_vertex_fiter = ;
-                MCUT_ASSERT(ccID_to_mX_to_cc_vertex.find(cc_id) != ccID_to_mX_to_cc_vertex.end());
-                std::unordered_map<vd_t, vd_t>& mX_to_cc_vertex = SAFE_ACCESS(ccID_to_mX_to_cc_vertex, cc_id);
-
                 // for each vertex around face
                 const std::vector<vertex_descriptor_t> vertices_around_face = mesh.get_vertices_around_face(fd);
 
                 for (std::vector<vertex_descriptor_t>::const_iterator face_vertex_iter = vertices_around_face.cbegin();
                      face_vertex_iter != vertices_around_face.cend();
                      ++face_vertex_iter) {
-                    MCUT_ASSERT(ccID_to_mX_to_cc_vertex.find(cc_id) != ccID_to_mX_to_cc_vertex.cend());
-
-                    /*const*/ std::unordered_map<vd_t, vd_t>& vertex_map = mX_to_cc_vertex;
                     const vd_t m1_sm_descr = *face_vertex_iter;
 
-                    MCUT_ASSERT(vertex_map.find(m1_sm_descr) != vertex_map.cend());
+                    MCUT_ASSERT(mX_to_cc_vertex.contains(m1_sm_descr));
 
-                    const vd_t cc_descr = SAFE_ACCESS(vertex_map, m1_sm_descr);
+                    const vd_t cc_descr = mX_to_cc_vertex[m1_sm_descr];
                     remapped_face.push_back(cc_descr);
                 }
             }
@@ -742,6 +887,7 @@ hmesh_t extract_connected_components(
 
         parallel_fork_and_join(
             scheduler,
+            serial_execution_threshold,
             mesh.faces_begin(),
             mesh.faces_end(),
             (1 << 8),
@@ -773,6 +919,7 @@ hmesh_t extract_connected_components(
                 fd_t f = cc_mesh.add_face(*remapped_face_iter); // insert the face
 
                 MCUT_ASSERT(f != hmesh_t::null_face());
+                (void)f;
 
                 if (popuplate_face_maps) {
                     // NOTE: "mX" refers to our halfedge data structure called "mesh" (see single threaded code)
@@ -830,24 +977,17 @@ hmesh_t extract_connected_components(
         MCUT_ASSERT(ccID_to_cc_to_mX_face_fiter != ccID_to_cc_to_mX_face.cend());
         std::vector<fd_t>& cc_to_mX_face = ccID_to_cc_to_mX_face_fiter->second;
 
-        // std::map<std::size_t, std::unordered_map<vd_t, vd_t>>::iterator ccID_to_mX_to_cc_vertex_fiter = ;
-        MCUT_ASSERT(ccID_to_mX_to_cc_vertex.find(cc_id) != ccID_to_mX_to_cc_vertex.end());
-        std::unordered_map<vd_t, vd_t>& mX_to_cc_vertex = SAFE_ACCESS(ccID_to_mX_to_cc_vertex, cc_id);
-
         // for each vertex around face
         /*const*/ std::vector<vertex_descriptor_t> vertices_around_face = mesh.get_vertices_around_face(fd);
 
         for (std::vector<vertex_descriptor_t>::/*const_*/iterator face_vertex_iter = vertices_around_face.begin();
              face_vertex_iter != vertices_around_face.end();
              ++face_vertex_iter) {
-            MCUT_ASSERT(ccID_to_mX_to_cc_vertex.find(cc_id) != ccID_to_mX_to_cc_vertex.cend());
-
-            /*const*/ std::unordered_map<vd_t, vd_t>& vertex_map = mX_to_cc_vertex;
             const vd_t m1_sm_descr = *face_vertex_iter;
 
-            MCUT_ASSERT(vertex_map.find(m1_sm_descr) != vertex_map.cend());
+            MCUT_ASSERT(mX_to_cc_vertex.contains(m1_sm_descr));
 
-            const vd_t cc_descr = SAFE_ACCESS(vertex_map, m1_sm_descr);
+            const vd_t cc_descr = mX_to_cc_vertex[m1_sm_descr];
             remapped_face.push_back(cc_descr);
         }
 
@@ -857,6 +997,7 @@ hmesh_t extract_connected_components(
         fd_t f = cc_mesh.add_face(remapped_face); // insert the face
 
         MCUT_ASSERT(f != hmesh_t::null_face());
+        (void)f;
 
         if (popuplate_face_maps) {
             MCUT_ASSERT((size_t)f == cc_to_mX_face.size() /*cc_to_mX_face.count(f) == 0*/);
@@ -1101,7 +1242,7 @@ inline bool m0_is_polygon_boundary_edge(const ed_t& e, uint32_t m0_num_cutpath_e
 
 // point an intersection halfedge to the correct instance of an intersection point
 vd_t resolve_intersection_point_descriptor(
-    const hmesh_t& ps,
+    const polygon_soup_t& ps,
     const hmesh_t& m0,
     hmesh_t& m1,
     const hd_t& m0_h,
@@ -1315,7 +1456,7 @@ vd_t resolve_intersection_point_descriptor(
     return resolved_inst;
 };
 
-inline std::vector<fd_t> ps_get_ivtx_registry_entry_faces(const hmesh_t& ps, const std::pair<ed_t, fd_t>& ivtx_registry_entry)
+inline std::vector<fd_t> ps_get_ivtx_registry_entry_faces(const polygon_soup_t& ps, const std::pair<ed_t, fd_t>& ivtx_registry_entry)
 {
     const hd_t h0 = ps.halfedge(ivtx_registry_entry.first, 0);
     const hd_t h1 = ps.halfedge(ivtx_registry_entry.first, 1);
@@ -1331,7 +1472,7 @@ inline std::vector<fd_t> ps_get_ivtx_registry_entry_faces(const hmesh_t& ps, con
 void update_neighouring_ps_iface_m0_edge_list(
     const vd_t& src_vertex,
     const vd_t& tgt_vertex,
-    const hmesh_t& ps,
+    const polygon_soup_t& ps,
     const fd_t sm_face,
     const fd_t cs_face,
     const std::vector<std::pair<ed_t, fd_t>>& m0_ivtx_to_intersection_registry_entry,
@@ -1398,7 +1539,7 @@ void update_neighouring_ps_iface_m0_edge_list(
     }
 }
 
-typedef std::vector<hd_t> traced_polygon_t;
+typedef traced_polygons_t::const_polygon_t traced_polygon_t;
 
 bool mesh_is_closed(const hmesh_t& mesh)
 {
@@ -1413,9 +1554,28 @@ bool mesh_is_closed(const hmesh_t& mesh)
     return all_halfedges_incident_to_face;
 }
 
+// The vector from "src" to "tgt", where "tgt" is an intersection point on the polygon-soup edge "ps_edge". The two can be
+// coincident when "tgt" is an end point of "ps_edge" (see: "segment_endpoint_on_plane" in the edge-to-face
+// intersection tests), and then the vector is the direction of "ps_edge" away from that end point, which is where
+// "tgt" is symbolically displaced to.
+inline vec3 get_vector_to_ivertex_on_ps_edge(const hmesh_t& m0, const polygon_soup_t& ps, const vd_t& src, const vd_t& tgt, const ed_t& ps_edge)
+{
+    const vec3 vector = m0.vertex(tgt) - m0.vertex(src);
+
+    if (vector == vec3(0.0)) {
+        const vec3& ps_edge_v0 = ps.vertex(ps.vertex(ps_edge, 0));
+        const vec3& ps_edge_v1 = ps.vertex(ps.vertex(ps_edge, 1));
+        return m0.vertex(tgt) == ps_edge_v0 ? ps_edge_v1 - ps_edge_v0 : ps_edge_v0 - ps_edge_v1;
+    }
+
+    return vector;
+}
+
 // TODO: thsi can be improved by comparing based on the largest component of the difference vector
-// sort points along a straight line
-std::vector<vd_t> linear_projection_sort(const std::vector<std::pair<vd_t, vec3>>& points)
+// sort points along a straight line. If "first_two_points_are_end_points" is true then the first two points are the end
+// points of a segment, which are kept outermost even if other points are coincident with them (see:
+// "segment_endpoint_on_plane" in the edge-to-face intersection tests).
+std::vector<vd_t> linear_projection_sort(const std::vector<std::pair<vd_t, vec3>>& points, const bool first_two_points_are_end_points = false)
 {
     /*
 1. pick one point as the origin
@@ -1439,9 +1599,17 @@ std::vector<vd_t> linear_projection_sort(const std::vector<std::pair<vd_t, vec3>
         point_projections.emplace_back(i->first, dot_product(orig_to_point_vec, orig_to_dst_vec));
     }
 
+    // the points that are ordered first (-1) and last (1) among those with the same projection
+    auto end_point_rank = [&](const vd_t& v) {
+        if (!first_two_points_are_end_points) {
+            return 0;
+        }
+        return v == origin->first ? -1 : (v == dst->first ? 1 : 0);
+    };
+
     std::sort(point_projections.begin(), point_projections.end(),
         [&](const std::pair<vd_t, double>& a, const std::pair<vd_t, double>& b) {
-            return a.second < b.second;
+            return a.second < b.second || (a.second == b.second && end_point_rank(a.first) < end_point_rank(b.first));
         });
 
     std::vector<vd_t> sorted_descriptors;
@@ -1457,6 +1625,10 @@ std::vector<vd_t> linear_projection_sort(const std::vector<std::pair<vd_t, vec3>
 //
 void dispatch(output_t& output, const input_t& input)
 {
+    if (input.region_of_interest && dispatch_region_of_interest(output, input)) {
+        return;
+    }
+
     lmsg();
 
     TIMESTACK_PUSH(__FUNCTION__);
@@ -1483,92 +1655,45 @@ void dispatch(output_t& output, const input_t& input)
     const int cs_face_count = cs.number_of_faces();
 
     TIMESTACK_PUSH("Check source mesh is closed");
-    const bool sm_is_watertight = mesh_is_closed(sm);
+    const bool sm_is_watertight = input.mesh_closedness_is_known ? input.src_mesh_is_closed : (input.src_mesh_is_region_of_interest ? input.src_mesh_parent_is_closed : mesh_is_closed(sm));
 
     TIMESTACK_POP();
 
     TIMESTACK_PUSH("Check cut mesh is closed");
-    const bool cm_is_watertight = mesh_is_closed(cs);
+    const bool cm_is_watertight = input.mesh_closedness_is_known ? input.cut_mesh_is_closed : mesh_is_closed(cs);
 
     TIMESTACK_POP();
 
+    output.src_mesh_is_closed = sm_is_watertight;
+    output.cut_mesh_is_closed = cm_is_watertight;
+
     ///////////////////////////////////////////////////////////////////////////
     // create polygon soup
     ///////////////////////////////////////////////////////////////////////////
 
     TIMESTACK_PUSH("Create ps");
-    hmesh_t ps = sm; // copy
-
-    ps.reserve_for_additional_elements(cs.number_of_vertices()); // hint
+    // NOTE: a view of "sm" and "cs" i.e. the meshes are not copied
+    const polygon_soup_t ps(sm, cs);
 
     // std::map<vd_t, vd_t> ps_to_sm_vtx;
     std::vector<vd_t> ps_to_sm_vtx((std::size_t)sm_vtx_cnt + cs.number_of_vertices());
-#if 1
     std::iota(std::begin(ps_to_sm_vtx), std::end(ps_to_sm_vtx), vd_t(0));
-#else
-    for (vertex_array_iterator_t v = sm.vertices_begin(); v != sm.vertices_end(); ++v) {
-        ps_to_sm_vtx[*v] = *v; // one to one mapping since ps is initially a copy of sm!
-    }
-#endif
     // std::map<fd_t, fd_t> ps_to_sm_face;
     std::vector<fd_t> ps_to_sm_face((std::size_t)sm.number_of_faces() + cs.number_of_faces());
-#if 1
     std::iota(std::begin(ps_to_sm_face), std::end(ps_to_sm_face), fd_t(0));
-#else
-    for (face_array_iterator_t f = sm.faces_begin(); f != sm.faces_end(); ++f) {
-        ps_to_sm_face[*f] = *f; // one to one mapping since ps is initially a copy of sm!
-    }
-#endif
-    // std::map<vd_t, vd_t> cs_to_ps_vtx;
     // std::map<vd_t, vd_t> ps_to_cm_vtx;
-    // std::vector<vd_t> cs_to_ps_vtx(cs.number_of_vertices());
     std::vector<vd_t> ps_to_cm_vtx((std::size_t)sm_vtx_cnt + cs.number_of_vertices());
-
-    // merge cm vertices
-    for (auto i = cs.vertices_begin(); i != cs.vertices_end(); ++i) {
-        const vd_t v = ps.add_vertex(cs.vertex(*i));
-
-        MCUT_ASSERT(v != hmesh_t::null_vertex());
-
-        // cs_to_ps_vtx.insert(std::make_pair(*i, v));
-        // cs_to_ps_vtx[*i] = v;
-        ps_to_cm_vtx[v] = *i;
-    }
+    // cm vertices follow the sm vertices
+    std::iota(std::begin(ps_to_cm_vtx) + sm_vtx_cnt, std::end(ps_to_cm_vtx), vd_t(0));
 
     // std::map<fd_t, fd_t> ps_to_cm_face;
     std::vector<fd_t> ps_to_cm_face((std::size_t)sm_face_count + cs_face_count);
-
-    // merge cm faces
-    {
-        std::vector<vd_t> remapped_face_vertices_tmp;
-        for (face_array_iterator_t i = cs.faces_begin(); i != cs.faces_end(); ++i) {
-            // std::vector<vd_t> fv = get_vertices_on_face(cs, *i);
-#if 1
-            cs.get_vertices_around_face(remapped_face_vertices_tmp, *i, sm_vtx_cnt);
-            const std::vector<vd_t>& remapped_face_vertices = remapped_face_vertices_tmp;
-#else
-            const std::vector<vd_t> fv = cs.get_vertices_around_face(*i);
-            std::vector<vd_t> remapped_face_vertices;
-
-            for (std::vector<vd_t>::const_iterator j = fv.cbegin(); j != fv.cend(); ++j) {
-                remapped_face_vertices.push_back(vd_t(sm_vtx_cnt + (*j)));
-            }
-#endif
-            const fd_t f = ps.add_face(remapped_face_vertices);
-
-            MCUT_ASSERT(f != hmesh_t::null_face());
-
-            ps_to_cm_face[f] = *i;
-        }
-    }
+    // cm faces follow the sm faces
+    std::iota(std::begin(ps_to_cm_face) + sm_face_count, std::end(ps_to_cm_face), fd_t(0));
 
     TIMESTACK_POP();
 
-    // cs_to_ps_vtx.clear();
-
-    if (input.verbose) {
-        dump_mesh(ps, "polygon-soup");
-    }
+    update_peak_element_counts(ps);
 
     const int ps_vtx_cnt = ps.number_of_vertices();
     //const int ps_face_cnt = ps.number_of_faces();
@@ -1585,6 +1710,7 @@ void dispatch(output_t& output, const input_t& input)
     // 2) Non-intersecting edges of the polygon-soup
     // 3) New edges created from intersection points
     hmesh_t m0;
+    m0.enable_edge_index(true); // i.e. edges are looked up by their vertices throughout
 
     // copy ps vertices into the auxilliary mesh (map is used to maintain original vertex order)
     // std::map<vd_t, vd_t> m0_to_ps_vtx;
@@ -1609,529 +1735,202 @@ void dispatch(output_t& output, const input_t& input)
     // Calculate polygon intersection points
     ///////////////////////////////////////////////////////////////////////////
 
-    std::unordered_map<ed_t, std::vector<fd_t>> ps_edge_face_intersection_pairs;
+    // the edges of the polygon soup that are tested for intersection, and the faces that each edge is tested
+    // against (i.e. the faces of edge "i" start at "ps_edge_face_intersection_pairs_offsets[i]")
+    std::vector<ed_t> ps_edge_face_intersection_pairs_edges;
+    std::vector<uint32_t> ps_edge_face_intersection_pairs_offsets(1, 0);
+    std::vector<fd_t> ps_edge_face_intersection_pairs_faces;
 
     TIMESTACK_PUSH("Prepare edge-to-face pairs");
+    {
+        const candidate_face_pairs_t& ps_face_to_potentially_intersecting_others = *input.ps_face_to_potentially_intersecting_others;
+        const std::vector<fd_t>& ps_ifaces = ps_face_to_potentially_intersecting_others.faces(); // sorted
+        const uint32_t num_ps_ifaces = (uint32_t)ps_ifaces.size();
+        const uint32_t num_blocks = (num_ps_ifaces + block_executor_t::block_size - 1) / block_executor_t::block_size;
 
 #if defined(MCUT_MULTI_THREADED)
-    { // NOTE: parallel implementation is different from sequential one
-        typedef std::unordered_map<ed_t, std::vector<fd_t>> OutputStorageType;
-        typedef std::map<fd_t, std::vector<fd_t>>::const_iterator InputStorageIteratorType;
-
-        std::vector<std::future<OutputStorageType>> futures;
-
-        auto fn_compute_ps_edge_to_faces_map = [&](InputStorageIteratorType block_start_, InputStorageIteratorType block_end_) {
-            std::unordered_map<ed_t, std::vector<fd_t>> ps_edge_face_intersection_pairs_local;
-
-            for (InputStorageIteratorType iter = block_start_; iter != block_end_; ++iter) {
-                // the face with the intersecting edges (i.e. the edges to be tested against the other face)
-                const fd_t& intersecting_edge_face = iter->first; // sm_face != hmesh_t::null_face() ? sm_face : cm_face;
-                const std::vector<hd_t>& halfedges = ps.get_halfedges_around_face(intersecting_edge_face);
-
-                for (std::vector<hd_t>::const_iterator hIter = halfedges.cbegin(); hIter != halfedges.cend(); ++hIter) {
-                    const ed_t edge = ps.edge(*hIter);
-                    std::vector<fd_t>& edge_ifaces = ps_edge_face_intersection_pairs_local[edge];
-                    if (edge_ifaces.empty()) {
-                        edge_ifaces = iter->second;
-                        if (edge_ifaces.size() > 1) {
-                            std::sort(edge_ifaces.begin(), edge_ifaces.end()); // alows us to do binary search (std::lower_bound)
-                        }
-                    } else {
-                        for (std::vector<fd_t>::const_iterator iface_iter = iter->second.cbegin();
-                             iface_iter != iter->second.cend();
-                             ++iface_iter) {
-                            std::vector<fd_t>::iterator fiter = std::lower_bound(edge_ifaces.begin(), edge_ifaces.end(), *iface_iter);
-                            bool exists = fiter != edge_ifaces.end() && (*fiter == *iface_iter);
-                            if (!exists) {
-                                edge_ifaces.insert(fiter, *iface_iter); // insert and maintain sorted order
-                            }
-                        }
-                    }
-                }
-            }
-            return ps_edge_face_intersection_pairs_local;
-        };
-
-        parallel_fork_and_join(
-            *input.scheduler,
-            input.ps_face_to_potentially_intersecting_others->cbegin(),
-            input.ps_face_to_potentially_intersecting_others->cend(),
-            (1 << 6),
-            fn_compute_ps_edge_to_faces_map,
-            ps_edge_face_intersection_pairs, // out
-            futures);
-
-        // merge results from other threads
-
-        for (int fi = 0; fi < (int)futures.size(); ++fi) {
-            std::future<OutputStorageType>& f = futures[fi];
-            MCUT_ASSERT(f.valid()); // The behavior is undefined if valid()== false before the call to wait_for
-
-            OutputStorageType future_res = f.get();
-            // merge results for current block
-            for (OutputStorageType::const_iterator i = future_res.cbegin(); i != future_res.cend(); ++i) {
-                OutputStorageType::iterator fiter = ps_edge_face_intersection_pairs.find(i->first);
-                if (fiter == ps_edge_face_intersection_pairs.cend()) {
-                    ps_edge_face_intersection_pairs[i->first] = i->second;
-                } else {
-                    for (std::vector<fd_t>::const_iterator j = i->second.cbegin(); j != i->second.cend(); ++j) {
-                        std::vector<fd_t>::iterator lb_iter = std::lower_bound(fiter->second.begin(), fiter->second.end(), *j);
-                        bool exists = lb_iter != fiter->second.end() && (*lb_iter == *j);
-                        if (!exists) {
-                            fiter->second.insert(lb_iter, *j); // insert and maintain sorted order
-                        }
-                    }
-                }
-            }
-        }
-    } // end of parallel code
+        const block_executor_t for_each_block(*input.scheduler, input.serial_execution_threshold);
 #else
-    {
-
-        std::vector<fd_t> unvisited_ps_ifaces; //= *input.ps_face_to_potentially_intersecting_others;
-        unvisited_ps_ifaces.reserve(input.ps_face_to_potentially_intersecting_others->size());
-        // NOTE: the elements of "unvisited_ps_ifaces" are already sorted because they come directly from
-        // "input.ps_face_to_potentially_intersecting_others", which is an std::map (keys are always sorted)
-        std::transform(
-            input.ps_face_to_potentially_intersecting_others->cbegin(),
-            input.ps_face_to_potentially_intersecting_others->cend(),
-            std::back_inserter(unvisited_ps_ifaces),
-            [](const std::pair<fd_t, std::vector<fd_t>>& kv) { return kv.first; });
-
-        std::vector<bool> ps_iface_enqueued(ps.number_of_faces(), false);
-
-        std::vector<bool> ps_edge_visited(ps.number_of_edges(), false);
-        // initially null
-        std::map<fd_t, std::vector<fd_t>>::const_iterator cur_ps_cc_face = input.ps_face_to_potentially_intersecting_others->cend();
-        // start with any face, but we choose the first
-        std::map<fd_t, std::vector<fd_t>>::const_iterator next_ps_cc_face = input.ps_face_to_potentially_intersecting_others->cbegin();
-        ps_iface_enqueued[next_ps_cc_face->first] = true;
-
-         // an element of this queue is an iterator/ptr to an element of "input.ps_face_to_potentially_intersecting_others"
-            std::queue<std::map<fd_t, std::vector<fd_t>>::const_iterator> adj_ps_face_queue;
-
-        do { // each iteration will find a set of edges that belong to a connected-component patch of intersectng faces (of sm or cm) in ps
-            cur_ps_cc_face = next_ps_cc_face;
-            next_ps_cc_face = input.ps_face_to_potentially_intersecting_others->cend(); // set null
-
-            // register unique edges of current face, and the add the neighbouring faces to queue
-
-           
-            adj_ps_face_queue.push(cur_ps_cc_face);
-
-            do { // each interation will add unregistered edges of current face, and add unvisited faces to queue
-
-                const std::map<fd_t, std::vector<fd_t>>::const_iterator cc_iface = adj_ps_face_queue.front(); // current face of connected-component patch
-                adj_ps_face_queue.pop();
-
-                { // face is now visisted so we remove it
-                    std::vector<fd_t>::iterator fiter = std::lower_bound(
-                        unvisited_ps_ifaces.begin(),
-                        unvisited_ps_ifaces.end(),
-                        cc_iface->first);
-                    MCUT_ASSERT(fiter != unvisited_ps_ifaces.cend());
-                    unvisited_ps_ifaces.erase(fiter); // NOTE: list remains sorted
-                }
-
-                std::vector<fd_t> cur_ps_face_ifaces_sorted = cc_iface->second; // copy
-                if (cur_ps_face_ifaces_sorted.size() > 1) {
-                    std::sort(cur_ps_face_ifaces_sorted.begin(), cur_ps_face_ifaces_sorted.end()); // allows quick binary search
-                }
-                // bool is_sm_face = cc_iface->first < sm_face_count;
-                //  const fd_t cc_iface_descr = is_sm_face ? cc_iface->first - sm_face_count : sm_face_count;
-
-                const std::vector<hd_t>& cur_ps_face_halfedges = ps.get_halfedges_around_face(cc_iface->first);
-                // all neighbours
-                const std::vector<fd_t> cur_ps_face_neigh_faces = ps.get_faces_around_face(cc_iface->first, &cur_ps_face_halfedges);
-                // neighbours [which are intersecting faces]
-                std::vector<fd_t> cur_ps_face_neigh_ifaces;
-                cur_ps_face_neigh_ifaces.reserve(cur_ps_face_neigh_faces.size());
-
-                for (std::vector<fd_t>::const_iterator face_iter = cur_ps_face_neigh_faces.cbegin();
-                     face_iter != cur_ps_face_neigh_faces.cend();
-                     ++face_iter) {
-                    bool is_iface = input.ps_face_to_potentially_intersecting_others->find(*face_iter) != input.ps_face_to_potentially_intersecting_others->cend();
-                    if (is_iface) {
-                        cur_ps_face_neigh_ifaces.push_back(*face_iter);
-                    }
-                }
-
-                if (cur_ps_face_neigh_ifaces.size() > 1) {
-                    std::sort(cur_ps_face_neigh_ifaces.begin(), cur_ps_face_neigh_ifaces.end());
-                }
-
-                // for each halfedge of current iface
-                for (std::vector<hd_t>::const_iterator hiter = cur_ps_face_halfedges.cbegin(); hiter != cur_ps_face_halfedges.cend(); ++hiter) {
-                    const ed_t halfedge_edge = ps.edge(*hiter);
-                    const hd_t opp_he = ps.opposite(*hiter);
-                    // Here we simply access corresponding element in "cur_ps_face_neigh_faces" based on
-                    // how "ps.get_faces_around_face" populates "cur_ps_face_neigh_faces", given "cur_ps_face_halfedges"
-                    // as done above
-
-                    if (ps_edge_visited[halfedge_edge] == false) {
-                        ps_edge_face_intersection_pairs.insert(std::make_pair(halfedge_edge, cur_ps_face_ifaces_sorted)); // add edge
-                        ps_edge_visited[halfedge_edge] = true;
-
-                        bool is_border_ps_face = cur_ps_face_neigh_faces.size() != cur_ps_face_halfedges.size();
-                        const size_t idx = std::distance(cur_ps_face_halfedges.cbegin(), hiter);
-                        fd_t opp_he_face = is_border_ps_face ? ps.face(opp_he) : SAFE_ACCESS(cur_ps_face_neigh_faces, idx);
-
-                        if (!is_virtual_face(opp_he_face) && ps_iface_enqueued[opp_he_face] == false) { // two neighbouring faces might share more that 1 edge (case of non-triangulated mesh)
-                            bool is_iface = std::binary_search(cur_ps_face_neigh_ifaces.cbegin(), cur_ps_face_neigh_ifaces.cend(), opp_he_face);
-                            if (is_iface) {
-                                std::map<fd_t, std::vector<fd_t>>::const_iterator fiter = input.ps_face_to_potentially_intersecting_others->find(opp_he_face);
-                                adj_ps_face_queue.push(fiter);
-                                ps_iface_enqueued[opp_he_face] = true;
-                            }
-                        }
-                    } else {
-                        MCUT_ASSERT(ps_edge_face_intersection_pairs.find(halfedge_edge) != ps_edge_face_intersection_pairs.cend());
-                        // merge shared "intersected" faces.
-                        // Two intersecting faces that share an edge will share intersected faces. The shared faces
-                        // are those intersected by the shared edge.
-                        std::vector<fd_t>& existing_edge_ifaces = ps_edge_face_intersection_pairs[halfedge_edge]; // sorted list
-
-                        for (std::vector<fd_t>::const_iterator i = cur_ps_face_ifaces_sorted.cbegin(); i != cur_ps_face_ifaces_sorted.cend(); ++i) {
-                            std::vector<fd_t>::iterator iter = std::lower_bound(existing_edge_ifaces.begin(), existing_edge_ifaces.end(), *i);
-
-                            bool found = iter != existing_edge_ifaces.end() && iter != existing_edge_ifaces.end() && (*iter == *i);
-                            if (!found) {
-                                existing_edge_ifaces.insert(iter, *i); // insert into sorted list (i.e. possibly shifts some elements forward)
-                            }
-                        }
-                    }
-                } // for each halfedge of current iface
-
-            } while (adj_ps_face_queue.empty() == false);
-
-            // find "next_ps_cc_face" as any face in "input.ps_face_to_potentially_intersecting_others" that is not visited
-            if (unvisited_ps_ifaces.size() > 0) {
-                fd_t next_face = unvisited_ps_ifaces.back(); // pick any unvisited iface (we choose the last for faster elemt removal from std::vector)
-                next_ps_cc_face = input.ps_face_to_potentially_intersecting_others->find(next_face);
-                MCUT_ASSERT(next_ps_cc_face != input.ps_face_to_potentially_intersecting_others->cend());
-            }
-
-        } while (next_ps_cc_face != input.ps_face_to_potentially_intersecting_others->cend());
-    }
-    // std::unordered_map<ed_t, std::vector<fd_t>> ps_edge_face_intersection_pairs;
-#endif // #if defined(MCUT_MULTI_THREADED)
-    TIMESTACK_POP();
-
-    //
-    // build bounding boxes for each intersecting edge
-    //
-
-    TIMESTACK_PUSH("Build edge bounding boxes");
-
-    // http://gamma.cs.unc.edu/RTRI/i3d08_RTRI.pdf
-    std::unordered_map<ed_t, bounding_box_t<vec3>> ps_edge_to_bbox;
+        const block_executor_t for_each_block;
+#endif
 
-#if defined(MCUT_MULTI_THREADED)
-    {
-        typedef std::unordered_map<ed_t, bounding_box_t<vec3>> OutputStorageType;
-        typedef std::unordered_map<ed_t, std::vector<fd_t>>::const_iterator InputStorageIteratorType;
-
-        auto fn_compute_ps_edge_bbox = [&](InputStorageIteratorType block_start_, InputStorageIteratorType block_end_) {
-            OutputStorageType ps_edge_to_bbox_local;
-
-            for (std::unordered_map<ed_t, std::vector<fd_t>>::const_iterator iedge_iter = block_start_; iedge_iter != block_end_; iedge_iter++) {
-                const ed_t edge = iedge_iter->first;
-                const vd_t v0 = ps.vertex(edge, 0);
-                const vd_t v1 = ps.vertex(edge, 1);
-                bounding_box_t<vec3>& edge_bbox = ps_edge_to_bbox_local[edge];
-                edge_bbox.expand(ps.vertex(v0));
-                edge_bbox.expand(ps.vertex(v1));
-            }
+        // the edges (with their number of faces) and the faces that are found from each block of intersecting faces
+        std::vector<std::vector<std::pair<ed_t, uint32_t>>> block_edges(num_blocks);
+        std::vector<std::vector<fd_t>> block_faces(num_blocks);
 
-            return ps_edge_to_bbox_local;
-        };
+        for_each_block(num_ps_ifaces, [&](uint32_t first, uint32_t last) {
+            std::vector<fd_t> edge_ifaces;
 
-        std::vector<std::future<OutputStorageType>> futures;
+            // NOTE: the range may contain several blocks
+            for (uint32_t block = first / block_executor_t::block_size; block * block_executor_t::block_size < last; ++block) {
+                const uint32_t block_end = std::min(last, (block + 1) * block_executor_t::block_size);
+                std::vector<std::pair<ed_t, uint32_t>>& edges = block_edges[block];
+                std::vector<fd_t>& faces = block_faces[block];
 
-        parallel_fork_and_join(
-            *input.scheduler,
-            ps_edge_face_intersection_pairs.cbegin(),
-            ps_edge_face_intersection_pairs.cend(),
-            (1 << 8),
-            fn_compute_ps_edge_bbox,
-            ps_edge_to_bbox, // out
-            futures);
+                for (uint32_t i = block * block_executor_t::block_size; i < block_end; ++i) {
+                    // the face with the intersecting edges (i.e. the edges to be tested against the other faces)
+                    const fd_t intersecting_edge_face = ps_ifaces[i];
+                    const std::vector<hd_t>& halfedges = ps.get_halfedges_around_face(intersecting_edge_face);
 
-        // merge results from other threads
+                    for (std::vector<hd_t>::const_iterator hIter = halfedges.cbegin(); hIter != halfedges.cend(); ++hIter) {
+                        const fd_t opp_face = ps.face(ps.opposite(*hIter));
+                        const bool opp_face_is_iface = opp_face != hmesh_t::null_face() && ps_face_to_potentially_intersecting_others.is_candidate(opp_face);
 
-        for (int i = 0; i < (int)futures.size(); ++i) {
-            std::future<OutputStorageType>& f = futures[i];
-            MCUT_ASSERT(f.valid()); // The behavior is undefined if valid()== false before the call to wait_for
+                        if (opp_face_is_iface && opp_face < intersecting_edge_face) {
+                            continue; // the edge is shared with an intersecting face that comes first
+                        }
 
-            OutputStorageType future_res = f.get();
+                        // the edge is tested against the faces that may intersect either of its faces
+                        edge_ifaces.clear();
 
-            ps_edge_to_bbox.insert(future_res.cbegin(), future_res.cend());
-        }
-    }
-#else
-    for (std::unordered_map<ed_t, std::vector<fd_t>>::const_iterator iedge_iter = ps_edge_face_intersection_pairs.cbegin();
-         iedge_iter != ps_edge_face_intersection_pairs.cend();
-         iedge_iter++) {
-        MCUT_ASSERT(iedge_iter->second.size() >= 1);
-        const ed_t edge = iedge_iter->first;
-        const vd_t v0 = ps.vertex(edge, 0);
-        const vd_t v1 = ps.vertex(edge, 1);
-        bounding_box_t<vec3>& edge_bbox = ps_edge_to_bbox[edge];
-        edge_bbox.expand(ps.vertex(v0));
-        edge_bbox.expand(ps.vertex(v1));
-    }
-#endif // #if defined(MCUT_MULTI_THREADED)
+                        if (opp_face_is_iface && opp_face != intersecting_edge_face) {
+                            std::set_union(
+                                ps_face_to_potentially_intersecting_others.others_begin(intersecting_edge_face),
+                                ps_face_to_potentially_intersecting_others.others_end(intersecting_edge_face),
+                                ps_face_to_potentially_intersecting_others.others_begin(opp_face),
+                                ps_face_to_potentially_intersecting_others.others_end(opp_face),
+                                std::back_inserter(edge_ifaces));
+                        } else {
+                            edge_ifaces.assign(
+                                ps_face_to_potentially_intersecting_others.others_begin(intersecting_edge_face),
+                                ps_face_to_potentially_intersecting_others.others_end(intersecting_edge_face));
+                        }
 
-    TIMESTACK_POP();
+                        // http://gamma.cs.unc.edu/RTRI/i3d08_RTRI.pdf
+                        const ed_t edge = ps.edge(*hIter);
+                        bounding_box_t<vec3> edge_bbox;
+                        edge_bbox.expand(ps.vertex(ps.vertex(edge, 0)));
+                        edge_bbox.expand(ps.vertex(ps.vertex(edge, 1)));
 
-    //
-    // cull redundant edge to face pairs
-    //
-    TIMESTACK_PUSH("Cull redundant edge-face pairs");
+                        uint32_t num_edge_ifaces = 0;
 
-#if defined(MCUT_MULTI_THREADED)
-    {
-        typedef std::unordered_map<ed_t, std::vector<fd_t>>::iterator InputStorageIteratorType;
-
-        auto fn_compute_edgefair_pair_culling = [&](InputStorageIteratorType block_start_, InputStorageIteratorType block_end_) {
-            for (std::unordered_map<ed_t, std::vector<fd_t>>::iterator iedge_iter = block_start_; iedge_iter != block_end_; iedge_iter++) {
-                const ed_t edge = iedge_iter->first;
-                const bounding_box_t<vec3>& edge_bbox = ps_edge_to_bbox[edge];
-                std::vector<fd_t>& edge_ifaces = iedge_iter->second;
-
-                for (std::vector<fd_t>::iterator iface_iter = edge_ifaces.begin(); iface_iter != edge_ifaces.end(); /*increment inside loop*/) {
-                    const bounding_box_t<vec3>* iface_bbox = nullptr;
-                    bool is_sm_face = (size_t)(*iface_iter) < (size_t)sm_face_count;
-                    if (is_sm_face) {
+                        for (std::vector<fd_t>::const_iterator iface_iter = edge_ifaces.cbegin(); iface_iter != edge_ifaces.cend(); ++iface_iter) {
+                            const bounding_box_t<vec3>* iface_bbox = nullptr;
+                            bool is_sm_face = (size_t)(*iface_iter) < (size_t)sm_face_count;
+                            if (is_sm_face) {
 #if defined(USE_OIBVH)
-                        iface_bbox = &(SAFE_ACCESS((*input.source_hmesh_face_aabb_array_ptr), *iface_iter));
-
+                                iface_bbox = &(SAFE_ACCESS((*input.source_hmesh_face_aabb_array_ptr), *iface_iter));
 #else
-                        iface_bbox = &input.source_hmesh_BVH->GetPrimitiveBBox(*iface_iter); // SAFE_ACCESS(((*input.source_hmesh_face_aabb_array_ptr), *iface_iter));
+                                iface_bbox = &input.source_hmesh_BVH->GetPrimitiveBBox(*iface_iter);
 #endif
-                    } else {
+                            } else {
 #if defined(USE_OIBVH)
-                        iface_bbox = &(SAFE_ACCESS((*input.cut_hmesh_face_aabb_array_ptr), (size_t)(*iface_iter) - sm_face_count));
+                                iface_bbox = &(SAFE_ACCESS((*input.cut_hmesh_face_aabb_array_ptr), (size_t)(*iface_iter) - sm_face_count));
 #else
-                        iface_bbox = &input.cut_hmesh_BVH->GetPrimitiveBBox((size_t)(*iface_iter) - sm_face_count); // SAFE_ACCESS(((*input.cut_hmesh_face_aabb_array_ptr), ((size_t)(*iface_iter) - sm_face_count)));
-
+                                iface_bbox = &input.cut_hmesh_BVH->GetPrimitiveBBox((size_t)(*iface_iter) - sm_face_count);
 #endif
-                    }
+                            }
 
-                    bool intersect = intersect_bounding_boxes(edge_bbox, *iface_bbox);
+                            // cull the face if it was paired with a face of "edge" only because they are in close
+                            // proximity (from BVH traversal)
+                            if (intersect_bounding_boxes(edge_bbox, *iface_bbox)) {
+                                faces.push_back(*iface_iter);
+                                num_edge_ifaces++;
+                            }
+                        }
 
-                    if (!intersect) {
-                        // remove because "iface_iter" was paired with a coincident face (of "edge") based on
-                        // the mere fact that the coincident face was found to be in close proximity with
-                        // "iface_iter" (from BVH tree proximity search)
-                        iface_iter = edge_ifaces.erase(iface_iter); // NOTE: "erase" return iterator to next after
-                    } else {
-                        iface_iter++;
+                        if (num_edge_ifaces > 0) {
+                            edges.push_back(std::make_pair(edge, num_edge_ifaces));
+                        }
                     }
                 }
             }
-            return 0;
-        };
-
-        std::vector<std::future<int>> futures;
-        int _1;
+        });
 
-        parallel_fork_and_join(
-            *input.scheduler,
-            ps_edge_face_intersection_pairs.begin(),
-            ps_edge_face_intersection_pairs.end(),
-            (1 << 8),
-            fn_compute_edgefair_pair_culling,
-            _1, // out
-            futures);
+        // concatenate the edges and faces of the blocks (in order)
+        std::vector<uint32_t> block_edges_offset(num_blocks + 1, 0);
+        std::vector<uint32_t> block_faces_offset(num_blocks + 1, 0);
 
-        for (int i = 0; i < (int)futures.size(); ++i) {
-            std::future<int>& f = futures[i];
-            MCUT_ASSERT(f.valid());
-            f.wait(); // simply wait for result to be done
+        for (uint32_t block = 0; block < num_blocks; ++block) {
+            block_edges_offset[block + 1] = block_edges_offset[block] + (uint32_t)block_edges[block].size();
+            block_faces_offset[block + 1] = block_faces_offset[block] + (uint32_t)block_faces[block].size();
         }
-    }
-#else
-    for (std::unordered_map<ed_t, std::vector<fd_t>>::iterator iedge_iter = ps_edge_face_intersection_pairs.begin();
-         iedge_iter != ps_edge_face_intersection_pairs.end();
-         iedge_iter++) {
-        const ed_t edge = iedge_iter->first;
-        const bounding_box_t<vec3>& edge_bbox = ps_edge_to_bbox[edge];
-        std::vector<fd_t>& edge_ifaces = iedge_iter->second;
-
-        for (std::vector<fd_t>::iterator iface_iter = edge_ifaces.begin(); iface_iter != edge_ifaces.end(); /*increment inside loop*/) {
-            const bounding_box_t<vec3>* iface_bbox = nullptr;
-            bool is_sm_face = (size_t)(*iface_iter) < (size_t)sm_face_count;
-            if (is_sm_face) {
-#if defined(USE_OIBVH)
-                iface_bbox = SAFE_ACCESS(&((*input.source_hmesh_face_aabb_array_ptr)), *iface_iter);
 
-#else
-                iface_bbox = &input.source_hmesh_BVH->GetPrimitiveBBox(*iface_iter); // SAFE_ACCESS(((*input.source_hmesh_face_aabb_array_ptr), *iface_iter));
-#endif
-            } else {
-#if defined(USE_OIBVH)
-                iface_bbox = SAFE_ACCESS(&((*input.cut_hmesh_face_aabb_array_ptr)), ((size_t)(*iface_iter) - sm_face_count));
-#else
-                iface_bbox = &input.cut_hmesh_BVH->GetPrimitiveBBox((size_t)(*iface_iter) - sm_face_count); // SAFE_ACCESS(((*input.cut_hmesh_face_aabb_array_ptr), ((size_t)(*iface_iter) - sm_face_count)));
+        ps_edge_face_intersection_pairs_edges.resize(block_edges_offset.back());
+        ps_edge_face_intersection_pairs_offsets.resize(block_edges_offset.back() + 1);
+        ps_edge_face_intersection_pairs_faces.resize(block_faces_offset.back());
 
-#endif
-            }
+        for_each_block(num_ps_ifaces, [&](uint32_t first, uint32_t last) {
+            for (uint32_t block = first / block_executor_t::block_size; block * block_executor_t::block_size < last; ++block) {
+                uint32_t edge_idx = block_edges_offset[block];
+                uint32_t face_offset = block_faces_offset[block];
 
-            bool intersect = intersect_bounding_boxes(edge_bbox, *iface_bbox);
+                for (std::vector<std::pair<ed_t, uint32_t>>::const_iterator it = block_edges[block].cbegin(); it != block_edges[block].cend(); ++it) {
+                    ps_edge_face_intersection_pairs_edges[edge_idx] = it->first;
+                    face_offset += it->second;
+                    ps_edge_face_intersection_pairs_offsets[++edge_idx] = face_offset;
+                }
 
-            if (!intersect) {
-                // remove because "iface_iter" was paired with a coincident face (of "edge") based on
-                // the mere fact that the coincident face was found to be in close proximity with
-                // "iface_iter" (from BVH tree proximity search)
-                iface_iter = edge_ifaces.erase(iface_iter); // NOTE: "erase" return iterator to next after
-            } else {
-                iface_iter++;
+                std::copy(block_faces[block].cbegin(), block_faces[block].cend(), ps_edge_face_intersection_pairs_faces.begin() + block_faces_offset[block]);
             }
-        }
+        });
     }
-#endif // #if defined(MCUT_MULTI_THREADED)
     TIMESTACK_POP();
 
-    ps_edge_to_bbox.clear();
-
     // assuming each edge will produce a new vertex
-    m0.reserve_for_additional_elements((std::uint32_t)ps_edge_face_intersection_pairs.size());
+    m0.reserve_for_additional_elements((std::uint32_t)ps_edge_face_intersection_pairs_edges.size());
 
     TIMESTACK_PUSH("Compute intersecting face properties");
     // compute/extract geometry properties of each tested face
     //--------------------------------------------------------
 
-    std::unordered_map<fd_t, vec3> ps_tested_face_to_plane_normal;
-    std::unordered_map<fd_t, double> ps_tested_face_to_plane_normal_d_param;
-    std::unordered_map<fd_t, int> ps_tested_face_to_plane_normal_max_comp;
-    std::unordered_map<fd_t, std::vector<vec3>> ps_tested_face_to_vertices;
+    // NOTE: the values are indexed by polygon-soup face, and only the tested faces have a value
+    const uint32_t ps_face_cnt = (uint32_t)ps.number_of_faces();
+    face_property_map_t<vec3> ps_tested_face_to_plane_normal(ps_face_cnt, vec3(0.0));
+    face_property_map_t<double> ps_tested_face_to_plane_normal_d_param(ps_face_cnt, 0.0);
+    face_property_map_t<int> ps_tested_face_to_plane_normal_max_comp(ps_face_cnt, -1);
+    face_property_map_t<std::vector<vec3>> ps_tested_face_to_vertices(ps_face_cnt, std::vector<vec3>());
+    // three non-collinear vertices of each tested face with more than three vertices, which define its plane (see:
+    // "orient3d"), or {-1, -1, -1} if all the vertices of the face are collinear
+    face_property_map_t<std::array<int, 3>> ps_tested_face_to_plane_vertices(ps_face_cnt, std::array<int, 3> { { -1, -1, -1 } });
 
-#if defined(MCUT_MULTI_THREADED)
     {
-        typedef std::tuple<
-            std::unordered_map<fd_t, vec3>, // ps_tested_face_to_plane_normal;
-            std::unordered_map<fd_t, double>, // ps_tested_face_to_plane_normal_d_param;
-            std::unordered_map<fd_t, int>, // ps_tested_face_to_plane_normal_max_comp;
-            std::unordered_map<fd_t, std::vector<vec3>> // ps_tested_face_to_vertices;
-            >
-            OutputStorageTypesTuple;
-        typedef std::map<fd_t, std::vector<fd_t>>::const_iterator InputStorageIteratorType;
-
-        auto fn_compute_intersecting_face_properties = [&](InputStorageIteratorType block_start_, InputStorageIteratorType block_end_) -> OutputStorageTypesTuple {
-            OutputStorageTypesTuple output_res;
-            std::unordered_map<fd_t, vec3>& ps_tested_face_to_plane_normal_LOCAL = std::get<0>(output_res);
-            std::unordered_map<fd_t, double>& ps_tested_face_to_plane_normal_d_param_LOCAL = std::get<1>(output_res);
-            std::unordered_map<fd_t, int>& ps_tested_face_to_plane_normal_max_comp_LOCAL = std::get<2>(output_res);
-            std::unordered_map<fd_t, std::vector<vec3>>& ps_tested_face_to_vertices_LOCAL = std::get<3>(output_res);
-            std::vector<vd_t> tested_face_descriptors_tmp;
-            for (std::map<fd_t, std::vector<fd_t>>::const_iterator tested_faces_iter = block_start_;
-                 tested_faces_iter != block_end_;
-                 tested_faces_iter++) {
+        // NOTE: the faces of input.ps_face_to_potentially_intersecting_others are the potentially colliding polygons
+        // that we get after BVH traversal
+        const std::vector<fd_t>& ps_tested_faces = input.ps_face_to_potentially_intersecting_others->faces();
+
+#if defined(MCUT_MULTI_THREADED)
+        const block_executor_t for_each_block(*input.scheduler, input.serial_execution_threshold);
+#else
+        const block_executor_t for_each_block;
+#endif
+
+        // each face is tested once, so blocks write the values of different faces (and the arrays do not grow)
+        for_each_block((uint32_t)ps_tested_faces.size(), [&](uint32_t first, uint32_t last) {
+            std::vector<vd_t> tested_face_descriptors;
+
+            for (uint32_t i = first; i < last; ++i) {
+                const fd_t tested_face = ps_tested_faces[i];
+
                 // get the vertices of tested_face (used to estimate its normal etc.)
-                ps.get_vertices_around_face(tested_face_descriptors_tmp, tested_faces_iter->first);
-                std::vector<vd_t> &tested_face_descriptors = tested_face_descriptors_tmp;
-                std::vector<vec3>& tested_face_vertices = ps_tested_face_to_vertices_LOCAL[tested_faces_iter->first]; // insert and get reference
+                ps.get_vertices_around_face(tested_face_descriptors, tested_face);
+                std::vector<vec3>& tested_face_vertices = ps_tested_face_to_vertices[tested_face];
 
                 for (std::vector<vd_t>::const_iterator it = tested_face_descriptors.cbegin(); it != tested_face_descriptors.cend(); ++it) {
                     const vec3& vertex = ps.vertex(*it);
                     tested_face_vertices.push_back(vertex);
                 }
 
-                vec3& tested_face_plane_normal = ps_tested_face_to_plane_normal_LOCAL[tested_faces_iter->first];
-                double& tested_face_plane_param_d = ps_tested_face_to_plane_normal_d_param_LOCAL[tested_faces_iter->first];
-                int& tested_face_plane_normal_max_comp = ps_tested_face_to_plane_normal_max_comp_LOCAL[tested_faces_iter->first];
+                vec3& tested_face_plane_normal = ps_tested_face_to_plane_normal[tested_face];
+                double& tested_face_plane_param_d = ps_tested_face_to_plane_normal_d_param[tested_face];
+                int& tested_face_plane_normal_max_comp = ps_tested_face_to_plane_normal_max_comp[tested_face];
 
                 tested_face_plane_normal_max_comp = compute_polygon_plane_coefficients(
                     tested_face_plane_normal,
                     tested_face_plane_param_d,
                     tested_face_vertices.data(),
                     (int)tested_face_vertices.size());
-            }
-            return output_res;
-        };
-
-        std::vector<std::future<OutputStorageTypesTuple>> futures;
-        OutputStorageTypesTuple partial_res;
-
-        parallel_fork_and_join(
-            *input.scheduler,
-            input.ps_face_to_potentially_intersecting_others->cbegin(),
-            input.ps_face_to_potentially_intersecting_others->cend(),
-            (1 << 7),
-            fn_compute_intersecting_face_properties,
-            partial_res, // out
-            futures);
-
-        std::tie(
-            ps_tested_face_to_plane_normal,
-            ps_tested_face_to_plane_normal_d_param,
-            ps_tested_face_to_plane_normal_max_comp,
-            ps_tested_face_to_vertices)
-            = partial_res;
-        // merge results from other threads
 
-        for (int i = 0; i < (int)futures.size(); ++i) {
-
-            std::future<OutputStorageTypesTuple>& f = futures[i];
-            MCUT_ASSERT(f.valid()); // The behavior is undefined if valid()== false before the call to wait_for
-
-            OutputStorageTypesTuple future_res = f.get();
-
-            std::unordered_map<fd_t, vec3>& ps_tested_face_to_plane_normal_FUTURE = std::get<0>(future_res);
-            std::unordered_map<fd_t, double>& ps_tested_face_to_plane_normal_d_param_FUTURE = std::get<1>(future_res);
-            std::unordered_map<fd_t, int>& ps_tested_face_to_plane_normal_max_comp_FUTURE = std::get<2>(future_res);
-            std::unordered_map<fd_t, std::vector<vec3>>& ps_tested_face_to_vertices_FUTURE = std::get<3>(future_res);
-
-            ps_tested_face_to_plane_normal.insert(
-                ps_tested_face_to_plane_normal_FUTURE.cbegin(),
-                ps_tested_face_to_plane_normal_FUTURE.cend());
-
-            ps_tested_face_to_plane_normal_d_param.insert(
-                ps_tested_face_to_plane_normal_d_param_FUTURE.cbegin(),
-                ps_tested_face_to_plane_normal_d_param_FUTURE.cend());
-
-            ps_tested_face_to_plane_normal_max_comp.insert(
-                ps_tested_face_to_plane_normal_max_comp_FUTURE.cbegin(),
-                ps_tested_face_to_plane_normal_max_comp_FUTURE.cend());
-
-            ps_tested_face_to_vertices.insert(
-                ps_tested_face_to_vertices_FUTURE.cbegin(),
-                ps_tested_face_to_vertices_FUTURE.cend());
-        }
-
-    } // end of parallel scope
-#else
-    // for each face that is to be tested for intersection
-    // NOTE: the keys of input.ps_face_to_potentially_intersecting_others are the potentially colliding polygons
-    // that we get after BVH traversal
-    {
-        std::vector<vd_t> tested_face_descriptors_tmp ;
-    for (std::map<fd_t, std::vector<fd_t>>::const_iterator tested_faces_iter = input.ps_face_to_potentially_intersecting_others->cbegin();
-         tested_faces_iter != input.ps_face_to_potentially_intersecting_others->cend();
-         tested_faces_iter++) {
-        // get the vertices of tested_face (used to estimate its normal etc.)
-        ps.get_vertices_around_face(tested_face_descriptors_tmp, tested_faces_iter->first);
-        const std::vector<vd_t> &tested_face_descriptors = tested_face_descriptors_tmp;
-        std::vector<vec3>& tested_face_vertices = ps_tested_face_to_vertices[tested_faces_iter->first]; // insert and get reference
-
-        for (std::vector<vd_t>::const_iterator it = tested_face_descriptors.cbegin(); it != tested_face_descriptors.cend(); ++it) {
-            const vec3& vertex = ps.vertex(*it);
-            tested_face_vertices.push_back(vertex);
-        }
+                if (tested_face_vertices.size() > 3) {
+                    std::array<int, 3>& tested_face_plane_vertices = ps_tested_face_to_plane_vertices[tested_face];
 
-        vec3& tested_face_plane_normal = ps_tested_face_to_plane_normal[tested_faces_iter->first];
-        double& tested_face_plane_param_d = ps_tested_face_to_plane_normal_d_param[tested_faces_iter->first];
-        int& tested_face_plane_normal_max_comp = ps_tested_face_to_plane_normal_max_comp[tested_faces_iter->first];
-
-        tested_face_plane_normal_max_comp = compute_polygon_plane_coefficients(
-            tested_face_plane_normal,
-            tested_face_plane_param_d,
-            tested_face_vertices.data(),
-            (int)tested_face_vertices.size());
-    }
+                    if (!determine_three_noncollinear_vertices(tested_face_plane_vertices[0], tested_face_plane_vertices[1], tested_face_plane_vertices[2], tested_face_vertices, tested_face_plane_normal, tested_face_plane_normal_max_comp)) {
+                        tested_face_plane_vertices = { { -1, -1, -1 } };
+                    }
+                }
+            }
+        });
     }
-#endif
     TIMESTACK_POP();
 
     // edge-to-face intersection tests (narrow-phase)
@@ -2208,8 +2007,8 @@ void dispatch(output_t& output, const input_t& input)
             OutputStorageTypesTuple;
 
         auto fn_compute_intersection_points = [&](
-                                                  std::unordered_map<ed_t, std::vector<fd_t>>::const_iterator block_start_,
-                                                  std::unordered_map<ed_t, std::vector<fd_t>>::const_iterator block_end_) -> OutputStorageTypesTuple {
+                                                  std::vector<ed_t>::const_iterator block_start_,
+                                                  std::vector<ed_t>::const_iterator block_end_) -> OutputStorageTypesTuple {
             OutputStorageTypesTuple local_output;
 
             std::vector<std::pair<ed_t, fd_t>>& m0_ivtx_to_intersection_registry_entry_LOCAL = std::get<0>(local_output);
@@ -2220,6 +2019,12 @@ void dispatch(output_t& output, const input_t& input)
             bool& partial_cut_detected_LOCAL = std::get<5>(local_output);
             std::vector<vec3>& intersection_points_LOCAL = std::get<6>(local_output);
 
+            // the orientation predicates of the current edge (reused for each edge)
+            std::vector<const vec3*> tested_faces_orient3d_queries;
+            std::vector<double> tested_faces_orient3d_results;
+            std::vector<const std::vector<vec3>*> tested_faces_vertices;
+            std::vector<bool> tested_faces_degenerate;
+
             // NOTE: threads do not add vertices into m0 to prevent contention on a shared resource.
             // They instead store a placeholder value that is analogous to an local offset i.e.
             // as if each thread was writing into its own mesh.
@@ -2232,14 +2037,16 @@ void dispatch(output_t& output, const input_t& input)
             }
 
             // for each edge
-            for (std::unordered_map<ed_t, std::vector<fd_t>>::const_iterator ps_edge_face_intersection_pairs_iter = block_start_;
+            for (std::vector<ed_t>::const_iterator ps_edge_face_intersection_pairs_iter = block_start_;
                  ps_edge_face_intersection_pairs_iter != block_end_;
                  ps_edge_face_intersection_pairs_iter++) {
 
                 // our edge that we test for intersection with other faces
-                const ed_t tested_edge = ps_edge_face_intersection_pairs_iter->first;
+                const ed_t tested_edge = *ps_edge_face_intersection_pairs_iter;
                 // the faces against which the edge is tested for intersection
-                const std::vector<fd_t>& tested_faces = ps_edge_face_intersection_pairs_iter->second;
+                const size_t tested_edge_idx = std::distance(ps_edge_face_intersection_pairs_edges.cbegin(), ps_edge_face_intersection_pairs_iter);
+                const std::vector<fd_t>::const_iterator tested_faces_begin = ps_edge_face_intersection_pairs_faces.cbegin() + ps_edge_face_intersection_pairs_offsets[tested_edge_idx];
+                const std::vector<fd_t>::const_iterator tested_faces_end = ps_edge_face_intersection_pairs_faces.cbegin() + ps_edge_face_intersection_pairs_offsets[tested_edge_idx + 1];
 
                 // the halfedges of our edge
                 const hd_t tested_edge_h0 = ps.halfedge(tested_edge, 0);
@@ -2258,37 +2065,83 @@ void dispatch(output_t& output, const input_t& input)
                 const fd_t tested_edge_face = tested_edge_h0_face != hmesh_t::null_face() ? tested_edge_h0_face : tested_edge_h1_face;
                 const bool tested_edge_belongs_to_cm = ps_is_cutmesh_face(tested_edge_face, sm_face_count);
 
+                // evaluate the orientation predicates of the edge's endpoints with respect to the planes of all the tested
+                // faces in one batch (two results per face)
+                tested_faces_orient3d_queries.clear();
+                tested_faces_vertices.clear();
+                tested_faces_degenerate.clear();
+
+                for (std::vector<fd_t>::const_iterator tested_faces_iter = tested_faces_begin; tested_faces_iter != tested_faces_end; ++tested_faces_iter) {
+                    MCUT_ASSERT(ps_tested_face_to_vertices.contains(*tested_faces_iter));
+                    const std::vector<vec3>& tested_face_vertices = ps_tested_face_to_vertices[*tested_faces_iter];
+                    const std::array<int, 3> tested_face_plane_vertices = tested_face_vertices.size() == 3 ? std::array<int, 3> { { 0, 1, 2 } } : ps_tested_face_to_plane_vertices[*tested_faces_iter];
+                    const bool tested_face_is_degenerate = tested_face_plane_vertices[0] == -1;
+                    const vec3* const tested_face_plane_points[3] = {
+                        &tested_face_vertices[tested_face_is_degenerate ? 0 : tested_face_plane_vertices[0]],
+                        &tested_face_vertices[tested_face_is_degenerate ? 1 : tested_face_plane_vertices[1]],
+                        &tested_face_vertices[tested_face_is_degenerate ? 2 : tested_face_plane_vertices[2]]
+                    };
+
+                    for (int endpoint = 0; endpoint < 2; ++endpoint) {
+                        tested_faces_orient3d_queries.insert(tested_faces_orient3d_queries.end(), tested_face_plane_points, tested_face_plane_points + 3);
+                        tested_faces_orient3d_queries.push_back(endpoint == 0 ? &tested_edge_h0_source_vertex : &tested_edge_h0_target_vertex);
+                    }
+
+                    tested_faces_vertices.push_back(&tested_face_vertices);
+                    tested_faces_degenerate.push_back(tested_face_is_degenerate);
+                }
+
+                tested_faces_orient3d_results.resize(tested_faces_orient3d_queries.size() / 4);
+                orient3d(tested_faces_orient3d_results.data(), tested_faces_orient3d_queries.data(), (uint32_t)tested_faces_orient3d_results.size());
+
                 // for each face that is to be intersected with the tested-edge
-                for (std::vector<fd_t>::const_iterator tested_faces_iter = tested_faces.cbegin();
-                     tested_faces_iter != tested_faces.cend();
+                for (std::vector<fd_t>::const_iterator tested_faces_iter = tested_faces_begin;
+                     tested_faces_iter != tested_faces_end;
                      ++tested_faces_iter) {
                     const fd_t tested_face = *tested_faces_iter;
 
                     // We are now finding the intersection points determined by calculating the location
                     // where each halfedge of face A intersects the area defined by face B (if it exists).
 
+                    const size_t tested_face_idx = std::distance(tested_faces_begin, tested_faces_iter);
+
                     // get the vertices of tested_face (used to estimate its normal etc.)
-                    MCUT_ASSERT(ps_tested_face_to_vertices.find(tested_face) != ps_tested_face_to_vertices.end());
-                    const std::vector<vec3>& tested_face_vertices = SAFE_ACCESS(ps_tested_face_to_vertices, tested_face);
+                    const std::vector<vec3>& tested_face_vertices = *tested_faces_vertices[tested_face_idx];
 
                     // compute plane of tested_face
                     // -----------------------
 
-                    MCUT_ASSERT(ps_tested_face_to_plane_normal.find(tested_face) != ps_tested_face_to_plane_normal.end());
-                    const vec3& tested_face_plane_normal = SAFE_ACCESS(ps_tested_face_to_plane_normal, tested_face);
-                    MCUT_ASSERT(ps_tested_face_to_plane_normal_d_param.find(tested_face) != ps_tested_face_to_plane_normal_d_param.end());
-                    const double& tested_face_plane_param_d = SAFE_ACCESS(ps_tested_face_to_plane_normal_d_param, tested_face);
-                    MCUT_ASSERT(ps_tested_face_to_plane_normal_max_comp.find(tested_face) != ps_tested_face_to_plane_normal_max_comp.end());
-                    const int& tested_face_plane_normal_max_comp = SAFE_ACCESS(ps_tested_face_to_plane_normal_max_comp, tested_face); // compute_polygon_plane_coefficients(
+                    MCUT_ASSERT(ps_tested_face_to_plane_normal_max_comp.contains(tested_face));
+                    const vec3& tested_face_plane_normal = ps_tested_face_to_plane_normal[tested_face];
+                    const double& tested_face_plane_param_d = ps_tested_face_to_plane_normal_d_param[tested_face];
+                    const int& tested_face_plane_normal_max_comp = ps_tested_face_to_plane_normal_max_comp[tested_face]; // compute_polygon_plane_coefficients(
 
                     vec3 intersection_point(0., 0., 0.); // the intersection point to be computed
 
-                    char segment_intersection_type = compute_segment_plane_intersection_type( // exact**
-                        tested_edge_h0_source_vertex,
-                        tested_edge_h0_target_vertex,
-                        tested_face_vertices,
-                        tested_face_plane_normal,
-                        tested_face_plane_normal_max_comp);
+                    char segment_intersection_type = tested_faces_degenerate[tested_face_idx] ? '0' : compute_segment_plane_intersection_type( // exact**
+                        tested_faces_orient3d_results[2 * tested_face_idx],
+                        tested_faces_orient3d_results[(2 * tested_face_idx) + 1]);
+
+                    // the endpoint of the edge that is on the plane of "tested_face" (if any), which is then the intersection point
+                    const vec3* segment_endpoint_on_plane = nullptr;
+
+                    if (input.enforce_general_position_symbolically && segment_intersection_type != '0' && segment_intersection_type != '1') {
+                        // resolve the side of the plane that the endpoints touching it are on, as if the cut-mesh was translated by an
+                        // infinitesimal vector (see: "orient3d_symbolic_translation_of_d"). A segment in the plane then misses the face.
+                        const vec3* const* tested_face_plane_points = &tested_faces_orient3d_queries[8 * tested_face_idx];
+                        const int side = orient3d_symbolic_translation_of_d(*tested_face_plane_points[0], *tested_face_plane_points[1], *tested_face_plane_points[2]);
+                        const double endpoint_on_plane_result = tested_edge_belongs_to_cm ? side : -side;
+                        const bool source_on_plane = segment_intersection_type != 'r';
+                        const bool target_on_plane = segment_intersection_type != 'q';
+
+                        segment_intersection_type = compute_segment_plane_intersection_type(
+                            source_on_plane ? endpoint_on_plane_result : tested_faces_orient3d_results[2 * tested_face_idx],
+                            target_on_plane ? endpoint_on_plane_result : tested_faces_orient3d_results[(2 * tested_face_idx) + 1]);
+
+                        if (segment_intersection_type == '1') {
+                            segment_endpoint_on_plane = source_on_plane ? &tested_edge_h0_source_vertex : &tested_edge_h0_target_vertex;
+                        }
+                    }
 
                     bool have_plane_intersection = (segment_intersection_type != '0'); // any intersection !
 
@@ -2333,22 +2186,37 @@ void dispatch(output_t& output, const input_t& input)
                             }
                         }
 
-                        compute_segment_plane_intersection(
-                            intersection_point,
-                            tested_face_plane_normal,
-                            tested_face_plane_param_d,
-                            tested_edge_h0_source_vertex,
-                            tested_edge_h0_target_vertex);
+                        if (segment_endpoint_on_plane != nullptr) {
+                            intersection_point = *segment_endpoint_on_plane;
+                        } else {
+                            compute_segment_plane_intersection(
+                                intersection_point,
+                                tested_face_plane_normal,
+                                tested_face_plane_param_d,
+                                tested_edge_h0_source_vertex,
+                                tested_edge_h0_target_vertex);
+                        }
 
-                        char in_poly_test_intersection_type = compute_point_in_polygon_test(
-                            intersection_point,
-                            tested_face_vertices,
-                            //#if 1
-                            tested_face_plane_normal,
-                            //#else
-                            tested_face_plane_normal_max_comp
-                            //#endif
-                        );
+                        char in_poly_test_intersection_type = '0';
+
+                        if (input.enforce_general_position_symbolically) {
+                            // exact test, which never finds the intersection point on an edge or vertex of "tested_face"
+                            in_poly_test_intersection_type = compute_segment_polygon_crossing_type(
+                                tested_edge_h0_source_vertex,
+                                tested_edge_h0_target_vertex,
+                                tested_face_vertices,
+                                tested_edge_belongs_to_cm);
+                        } else {
+                            in_poly_test_intersection_type = compute_point_in_polygon_test(
+                                intersection_point,
+                                tested_face_vertices,
+                                //#if 1
+                                tested_face_plane_normal,
+                                //#else
+                                tested_face_plane_normal_max_comp
+                                //#endif
+                            );
+                        }
 
                         if (in_poly_test_intersection_type == 'v' || in_poly_test_intersection_type == 'e') {
                             status_t okay_status = status_t::SUCCESS;
@@ -2366,7 +2234,6 @@ void dispatch(output_t& output, const input_t& input)
                         if (have_point_in_polygon) {
 
                             fd_t face_pqr = tested_edge_face;
-                            fd_t face_xyz = tested_face;
                             fd_t face_pqs = tested_edge_face == tested_edge_h0_face ? tested_edge_h1_face : hmesh_t::null_face();
 
                             vd_t new_vertex_descr((vd_t::index_type)intersection_points_LOCAL.size());
@@ -2378,9 +2245,6 @@ void dispatch(output_t& output, const input_t& input)
 
                             ps_intersecting_edges_LOCAL[tested_edge].push_back(new_vertex_descr);
 
-                            const fd_t cm_face = tested_edge_belongs_to_cm ? tested_edge_face : tested_face;
-                            const fd_t sm_face = tested_edge_belongs_to_cm ? tested_face : tested_edge_face;
-
                             if (tested_edge_belongs_to_cm) {
                                 // NOTE: std::pair format/order is {source-mesh-face, cut-mesh-face}
                                 cutpath_edge_creation_info_LOCAL[make_pair(tested_face, face_pqr)].push_back(new_vertex_descr);
@@ -2420,7 +2284,7 @@ void dispatch(output_t& output, const input_t& input)
                         } // if (have_point_in_polygon)
                     } // if (have_plane_intersection) {
                 } // for (std::vector<fd_t>::const_iterator intersected_faces_iter = intersected_faces.cbegin(); intersected_faces_iter != intersected_faces.cend(); ++intersected_faces_iter) {
-            } // for (std::map<ed_t, std::vector<fd_t>>::const_iterator ps_edge_face_intersection_pairs_iter = ps_edge_face_intersection_pairs.cbegin(); ps_edge_face_intersection_pairs_iter != ps_edge_face_intersection_pairs.cend(); ps_edge_face_intersection_pairs_iter++) {
+            } // for (std::vector<ed_t>::const_iterator ps_edge_face_intersection_pairs_iter = block_start_; ps_edge_face_intersection_pairs_iter != block_end_; ps_edge_face_intersection_pairs_iter++) {
 
             return local_output;
         };
@@ -2429,8 +2293,9 @@ void dispatch(output_t& output, const input_t& input)
         OutputStorageTypesTuple partial_res;
         parallel_fork_and_join(
             *input.scheduler,
-            ps_edge_face_intersection_pairs.cbegin(),
-            ps_edge_face_intersection_pairs.cend(),
+            input.serial_execution_threshold,
+            ps_edge_face_intersection_pairs_edges.cbegin(),
+            ps_edge_face_intersection_pairs_edges.cend(),
             (1 << 6),
             fn_compute_intersection_points,
             partial_res, // output computed by master thread
@@ -2452,6 +2317,7 @@ void dispatch(output_t& output, const input_t& input)
         for (std::vector<vec3>::const_iterator i = intersection_points.cbegin(); i != intersection_points.cend(); ++i) {
             const vd_t stored_descr = m0.add_vertex(*i);
             MCUT_ASSERT(stored_descr != hmesh_t::null_vertex());
+            (void)stored_descr;
         }
 
         for (int i = 0; i < (int)cm_border_reentrant_ivtx_list.size(); ++i) {
@@ -2536,6 +2402,7 @@ void dispatch(output_t& output, const input_t& input)
                      ++it) {
                     const vd_t stored_descr = m0.add_vertex(*it);
                     MCUT_ASSERT(stored_descr != hmesh_t::null_vertex());
+                    (void)stored_descr;
                 }
 
                 // merge m0_ivtx_to_intersection_registry_entry_FUTURE
@@ -2643,14 +2510,19 @@ void dispatch(output_t& output, const input_t& input)
         }
     } // end of parallel execution scope
 #else
-    for (std::unordered_map<ed_t, std::vector<fd_t>>::const_iterator ps_edge_face_intersection_pairs_iter = ps_edge_face_intersection_pairs.cbegin();
-         ps_edge_face_intersection_pairs_iter != ps_edge_face_intersection_pairs.cend();
-         ps_edge_face_intersection_pairs_iter++) {
+    // the orientation predicates of the current edge (reused for each edge)
+    std::vector<const vec3*> tested_faces_orient3d_queries;
+    std::vector<double> tested_faces_orient3d_results;
+    std::vector<const std::vector<vec3>*> tested_faces_vertices;
+    std::vector<bool> tested_faces_degenerate;
+
+    for (uint32_t tested_edge_idx = 0; tested_edge_idx < (uint32_t)ps_edge_face_intersection_pairs_edges.size(); ++tested_edge_idx) {
 
         // our edge that we test for intersection with other faces
-        const ed_t tested_edge = ps_edge_face_intersection_pairs_iter->first;
+        const ed_t tested_edge = ps_edge_face_intersection_pairs_edges[tested_edge_idx];
         // the faces against which the edge is tested for intersection
-        const std::vector<fd_t>& tested_faces = ps_edge_face_intersection_pairs_iter->second;
+        const std::vector<fd_t>::const_iterator tested_faces_begin = ps_edge_face_intersection_pairs_faces.cbegin() + ps_edge_face_intersection_pairs_offsets[tested_edge_idx];
+        const std::vector<fd_t>::const_iterator tested_faces_end = ps_edge_face_intersection_pairs_faces.cbegin() + ps_edge_face_intersection_pairs_offsets[tested_edge_idx + 1];
 
         // the halfedges of our edge
         const hd_t tested_edge_h0 = ps.halfedge(tested_edge, 0);
@@ -2669,29 +2541,56 @@ void dispatch(output_t& output, const input_t& input)
         const fd_t tested_edge_face = tested_edge_h0_face != hmesh_t::null_face() ? tested_edge_h0_face : tested_edge_h1_face;
         const bool tested_edge_belongs_to_cm = ps_is_cutmesh_face(tested_edge_face, sm_face_count);
 
+        // evaluate the orientation predicates of the edge's endpoints with respect to the planes of all the tested
+        // faces in one batch (two results per face)
+        tested_faces_orient3d_queries.clear();
+        tested_faces_vertices.clear();
+        tested_faces_degenerate.clear();
+
+        for (std::vector<fd_t>::const_iterator tested_faces_iter = tested_faces_begin; tested_faces_iter != tested_faces_end; ++tested_faces_iter) {
+            MCUT_ASSERT(ps_tested_face_to_vertices.contains(*tested_faces_iter));
+            const std::vector<vec3>& tested_face_vertices = ps_tested_face_to_vertices[*tested_faces_iter];
+            const std::array<int, 3> tested_face_plane_vertices = tested_face_vertices.size() == 3 ? std::array<int, 3> { { 0, 1, 2 } } : ps_tested_face_to_plane_vertices[*tested_faces_iter];
+            const bool tested_face_is_degenerate = tested_face_plane_vertices[0] == -1;
+            const vec3* const tested_face_plane_points[3] = {
+                &tested_face_vertices[tested_face_is_degenerate ? 0 : tested_face_plane_vertices[0]],
+                &tested_face_vertices[tested_face_is_degenerate ? 1 : tested_face_plane_vertices[1]],
+                &tested_face_vertices[tested_face_is_degenerate ? 2 : tested_face_plane_vertices[2]]
+            };
+
+            for (int endpoint = 0; endpoint < 2; ++endpoint) {
+                tested_faces_orient3d_queries.insert(tested_faces_orient3d_queries.end(), tested_face_plane_points, tested_face_plane_points + 3);
+                tested_faces_orient3d_queries.push_back(endpoint == 0 ? &tested_edge_h0_source_vertex : &tested_edge_h0_target_vertex);
+            }
+
+            tested_faces_vertices.push_back(&tested_face_vertices);
+            tested_faces_degenerate.push_back(tested_face_is_degenerate);
+        }
+
+        tested_faces_orient3d_results.resize(tested_faces_orient3d_queries.size() / 4);
+        orient3d(tested_faces_orient3d_results.data(), tested_faces_orient3d_queries.data(), (uint32_t)tested_faces_orient3d_results.size());
+
         // for each face that is to be intersected with the tested-edge
-        for (std::vector<fd_t>::const_iterator tested_faces_iter = tested_faces.cbegin();
-             tested_faces_iter != tested_faces.cend();
+        for (std::vector<fd_t>::const_iterator tested_faces_iter = tested_faces_begin;
+             tested_faces_iter != tested_faces_end;
              ++tested_faces_iter) {
             const fd_t tested_face = *tested_faces_iter;
 
             // We are now finding the intersection points determined by calculating the location
             // where each halfedge of face A intersects the area defined by face B (if it exists).
 
+            const size_t tested_face_idx = std::distance(tested_faces_begin, tested_faces_iter);
+
             // get the vertices of tested_face (used to estimate its normal etc.)
-            // std::vector<vd_t> tested_face_descriptors = ps.get_vertices_around_face(tested_face);
-            MCUT_ASSERT(ps_tested_face_to_vertices.find(tested_face) != ps_tested_face_to_vertices.end());
-            const std::vector<vec3>& tested_face_vertices = SAFE_ACCESS(ps_tested_face_to_vertices, tested_face);
+            const std::vector<vec3>& tested_face_vertices = *tested_faces_vertices[tested_face_idx];
 
             // compute plane of tested_face
             // -----------------------
 
-            MCUT_ASSERT(ps_tested_face_to_plane_normal.find(tested_face) != ps_tested_face_to_plane_normal.end());
-            const vec3& tested_face_plane_normal = SAFE_ACCESS(ps_tested_face_to_plane_normal, tested_face);
-            MCUT_ASSERT(ps_tested_face_to_plane_normal_d_param.find(tested_face) != ps_tested_face_to_plane_normal_d_param.end());
-            const double& tested_face_plane_param_d = SAFE_ACCESS(ps_tested_face_to_plane_normal_d_param, tested_face);
-            MCUT_ASSERT(ps_tested_face_to_plane_normal_max_comp.find(tested_face) != ps_tested_face_to_plane_normal_max_comp.end());
-            const int& tested_face_plane_normal_max_comp = SAFE_ACCESS(ps_tested_face_to_plane_normal_max_comp, tested_face);
+            MCUT_ASSERT(ps_tested_face_to_plane_normal_max_comp.contains(tested_face));
+            const vec3& tested_face_plane_normal = ps_tested_face_to_plane_normal[tested_face];
+            const double& tested_face_plane_param_d = ps_tested_face_to_plane_normal_d_param[tested_face];
+            const int& tested_face_plane_normal_max_comp = ps_tested_face_to_plane_normal_max_comp[tested_face];
 
             vec3 intersection_point(0., 0., 0.); // the intersection po int to be computed
 
@@ -2708,13 +2607,31 @@ void dispatch(output_t& output, const input_t& input)
                 tested_face_plane_normal,
                 tested_face_plane_param_d);
 #else
-            char segment_intersection_type = compute_segment_plane_intersection_type( // exact**
-                tested_edge_h0_source_vertex,
-                tested_edge_h0_target_vertex,
-                tested_face_vertices,
-                tested_face_plane_normal,
-                tested_face_plane_normal_max_comp);
+            char segment_intersection_type = tested_faces_degenerate[tested_face_idx] ? '0' : compute_segment_plane_intersection_type( // exact**
+                tested_faces_orient3d_results[2 * tested_face_idx],
+                tested_faces_orient3d_results[(2 * tested_face_idx) + 1]);
 #endif
+
+            // the endpoint of the edge that is on the plane of "tested_face" (if any), which is then the intersection point
+            const vec3* segment_endpoint_on_plane = nullptr;
+
+            if (input.enforce_general_position_symbolically && segment_intersection_type != '0' && segment_intersection_type != '1') {
+                // resolve the side of the plane that the endpoints touching it are on, as if the cut-mesh was translated by an
+                // infinitesimal vector (see: "orient3d_symbolic_translation_of_d"). A segment in the plane then misses the face.
+                const vec3* const* tested_face_plane_points = &tested_faces_orient3d_queries[8 * tested_face_idx];
+                const int side = orient3d_symbolic_translation_of_d(*tested_face_plane_points[0], *tested_face_plane_points[1], *tested_face_plane_points[2]);
+                const double endpoint_on_plane_result = tested_edge_belongs_to_cm ? side : -side;
+                const bool source_on_plane = segment_intersection_type != 'r';
+                const bool target_on_plane = segment_intersection_type != 'q';
+
+                segment_intersection_type = compute_segment_plane_intersection_type(
+                    source_on_plane ? endpoint_on_plane_result : tested_faces_orient3d_results[2 * tested_face_idx],
+                    target_on_plane ? endpoint_on_plane_result : tested_faces_orient3d_results[(2 * tested_face_idx) + 1]);
+
+                if (segment_intersection_type == '1') {
+                    segment_endpoint_on_plane = source_on_plane ? &tested_edge_h0_source_vertex : &tested_edge_h0_target_vertex;
+                }
+            }
             bool have_plane_intersection = (segment_intersection_type != '0'); // any intersection !
 
             if (have_plane_intersection) { // does the segment intersect the plane?
@@ -2782,19 +2699,34 @@ void dispatch(output_t& output, const input_t& input)
                 // NOTE: if using fixed precision floats (i.e. double), then here we just care about getting the intersection point
                 // irrespective of whether "segment_intersection_result" is consistent with "segment_intersection_type" from above.
                 // The inconsistency can happen during edge cases. see e.g. test 42.
-                compute_segment_plane_intersection(
-                    intersection_point,
-                    tested_face_plane_normal,
-                    tested_face_plane_param_d,
-                    tested_edge_h0_source_vertex,
-                    tested_edge_h0_target_vertex);
+                if (segment_endpoint_on_plane != nullptr) {
+                    intersection_point = *segment_endpoint_on_plane;
+                } else {
+                    compute_segment_plane_intersection(
+                        intersection_point,
+                        tested_face_plane_normal,
+                        tested_face_plane_param_d,
+                        tested_edge_h0_source_vertex,
+                        tested_edge_h0_target_vertex);
+                }
 
                 // is our intersection point in the polygon?
-                char in_poly_test_intersection_type = compute_point_in_polygon_test(
-                    intersection_point,
-                    tested_face_vertices,
-                    tested_face_plane_normal,
-                    tested_face_plane_normal_max_comp);
+                char in_poly_test_intersection_type = '0';
+
+                if (input.enforce_general_position_symbolically) {
+                    // exact test, which never finds the intersection point on an edge or vertex of "tested_face"
+                    in_poly_test_intersection_type = compute_segment_polygon_crossing_type(
+                        tested_edge_h0_source_vertex,
+                        tested_edge_h0_target_vertex,
+                        tested_face_vertices,
+                        tested_edge_belongs_to_cm);
+                } else {
+                    in_poly_test_intersection_type = compute_point_in_polygon_test(
+                        intersection_point,
+                        tested_face_vertices,
+                        tested_face_plane_normal,
+                        tested_face_plane_normal_max_comp);
+                }
 
                 if (
                     // illegal on-edge and on-vertex intersections
@@ -2834,7 +2766,7 @@ void dispatch(output_t& output, const input_t& input)
                     // hd_t halfedge_pq = tested_edge_h0; // the halfedge which is intersected with polygon
                     // hd_t halfedge_pq_opp = tested_edge_h1; // ps.opposite(halfedge_pq);
                     fd_t face_pqr = tested_edge_face; // the face which is incident to halfedge-pq
-                    fd_t face_xyz = tested_face; // the face which is intersected with halfedge-pq
+                    // fd_t face_xyz = tested_face; // the face which is intersected with halfedge-pq
                     fd_t face_pqs = tested_edge_face == tested_edge_h0_face ? tested_edge_h1_face : hmesh_t::null_face(); // ps.face(halfedge_pq_opp); // the face which is incident to the halfedge opposite to halfedge-pq
                                                                                                                           // fd_t face_pqX = hmesh_t::null_face(); // a virtual face pqX (where X denotes an unspecified auxiliary point)
 
@@ -2907,9 +2839,6 @@ void dispatch(output_t& output, const input_t& input)
 
                     // intersection_test_ivtx_list.push_back(new_vertex_descr);
 
-                    const fd_t cm_face = tested_edge_belongs_to_cm ? tested_edge_face : tested_face;
-                    const fd_t sm_face = tested_edge_belongs_to_cm ? tested_face : tested_edge_face;
-
                     if (tested_edge_belongs_to_cm) {
                         // "tested_face" is from the source mesh
 
@@ -2968,7 +2897,7 @@ void dispatch(output_t& output, const input_t& input)
             } // if (have_plane_intersection) {
         } // for (std::vector<fd_t>::const_iterator intersected_faces_iter = intersected_faces.cbegin(); intersected_faces_iter != intersected_faces.cend(); ++intersected_faces_iter) {
 
-    } // for (std::map<ed_t, std::vector<fd_t>>::const_iterator ps_edge_face_intersection_pairs_iter = ps_edge_face_intersection_pairs.cbegin(); ps_edge_face_intersection_pairs_iter != ps_edge_face_intersection_pairs.cend(); ps_edge_face_intersection_pairs_iter++) {
+    } // for (uint32_t tested_edge_idx = 0; tested_edge_idx < (uint32_t)ps_edge_face_intersection_pairs_edges.size(); ++tested_edge_idx) {
 #endif
 
     // Create edges from the new intersection points
@@ -3117,9 +3046,7 @@ void dispatch(output_t& output, const input_t& input)
          cutpath_edge_creation_info_iter != cutpath_edge_creation_info.cend();
          ++cutpath_edge_creation_info_iter) {
 
-        const fd_t sm_face = cutpath_edge_creation_info_iter->first.first;
-        const fd_t cm_face = cutpath_edge_creation_info_iter->first.second;
-        MCUT_ASSERT(!ps_is_cutmesh_face(sm_face, sm_face_count));
+        MCUT_ASSERT(!ps_is_cutmesh_face(cutpath_edge_creation_info_iter->first.first, sm_face_count));
         const std::vector<vd_t>& intersection_test_ivtx_list = cutpath_edge_creation_info_iter->second;
         if ((int)intersection_test_ivtx_list.size() < 2) {
             const vd_t ivtx = intersection_test_ivtx_list.back();
@@ -3132,7 +3059,7 @@ void dispatch(output_t& output, const input_t& input)
                 auto dump_faces = [&](std::vector<fd_t> fv, std::string fpath)
                 {
                     std::ofstream file(fpath);
-                    for(vertex_array_iterator_t v = ps.vertices_begin(); v != ps.vertices_end(); ++v)
+                    for(polygon_soup_t::vertex_iterator_t v = ps.vertices_begin(); v != ps.vertices_end(); ++v)
                     {
                         file << "v " << ps.vertex(*v).x() << " " << ps.vertex(*v).y() << " " << ps.vertex(*v).z() << std::endl;
                     }
@@ -3301,14 +3228,13 @@ void dispatch(output_t& output, const input_t& input)
                     for (std::vector<fd_t>::const_iterator sf_iter = shared_faces.cbegin(); sf_iter != shared_faces.cend(); ++sf_iter) {
                         const fd_t shared_face = *sf_iter;
 
-                        MCUT_ASSERT(ps_tested_face_to_plane_normal.find(shared_face) != ps_tested_face_to_plane_normal.cend());
-                        const vec3& shared_face_plane_normal = SAFE_ACCESS(ps_tested_face_to_plane_normal, shared_face);
+                        const vec3& shared_face_plane_normal = ps_tested_face_to_plane_normal[shared_face];
 
-                        MCUT_ASSERT(ps_tested_face_to_plane_normal_max_comp.find(shared_face) != ps_tested_face_to_plane_normal_max_comp.cend());
-                        int shared_face_normal_max_comp = SAFE_ACCESS(ps_tested_face_to_plane_normal_max_comp, shared_face);
+                        MCUT_ASSERT(ps_tested_face_to_plane_normal_max_comp.contains(shared_face));
+                        int shared_face_normal_max_comp = ps_tested_face_to_plane_normal_max_comp[shared_face];
 
-                        MCUT_ASSERT(ps_tested_face_to_vertices.find(shared_face) != ps_tested_face_to_vertices.cend());
-                        const std::vector<vec3>& shared_face_vertices = SAFE_ACCESS(ps_tested_face_to_vertices, shared_face);
+                        MCUT_ASSERT(ps_tested_face_to_vertices.contains(shared_face));
+                        const std::vector<vec3>& shared_face_vertices = ps_tested_face_to_vertices[shared_face];
 
                         char in_poly_test_intersection_type = compute_point_in_polygon_test(
                             midpoint,
@@ -3404,13 +3330,21 @@ void dispatch(output_t& output, const input_t& input)
     // this means that in memory, edges are placed next to others they connect to).
 
     std::vector<std::vector<ed_t>> m0_cutpath_sequences;
-    std::unordered_map<vd_t, int> m0_ivtx_to_cutpath_sequence;
-    std::unordered_map<ed_t, int> m0_edge_to_cutpath_sequence;
+    vertex_property_map_t<int> m0_ivtx_to_cutpath_sequence(m0, -1);
+    edge_property_map_t<int> m0_edge_to_cutpath_sequence(m0, -1);
+    int m0_num_sequenced_ivertices = 0;
+    int m0_num_sequenced_edges = 0;
+
+    auto map_ivtx_to_cutpath_sequence = [&](const vd_t& ivtx, int sequence_index) {
+        if (!m0_ivtx_to_cutpath_sequence.contains(ivtx)) {
+            m0_num_sequenced_ivertices++;
+        }
+        m0_ivtx_to_cutpath_sequence[ivtx] = sequence_index;
+    };
 
     do { // an iteration will build a cut-path sequence
 
-        // const int diff = (int)m0_ivtx_to_cutpath_edges.size() - (int)m0_ivtx_to_cutpath_sequence.size();
-        MCUT_ASSERT((int)m0_ivtx_to_cutpath_edges.size() - (int)m0_ivtx_to_cutpath_sequence.size() >= 2); // need a minimum of 2 intersection points (one edge) to form a sequence
+        MCUT_ASSERT((int)m0_ivtx_to_cutpath_edges.size() - m0_num_sequenced_ivertices >= 2); // need a minimum of 2 intersection points (one edge) to form a sequence
 
         int cur_cutpath_sequence_index = (int)m0_cutpath_sequences.size();
 
@@ -3423,7 +3357,7 @@ void dispatch(output_t& output, const input_t& input)
         std::unordered_map<vd_t, std::vector<ed_t>>::const_iterator m0_ivtx_to_cutpath_edges_iter = std::find_if(
             m0_ivtx_to_cutpath_edges.cbegin(), m0_ivtx_to_cutpath_edges.cend(),
             [&](const std::pair<vd_t, std::vector<ed_t>>& elem) {
-                bool is_mapped = m0_ivtx_to_cutpath_sequence.find(elem.first) != m0_ivtx_to_cutpath_sequence.cend();
+                bool is_mapped = m0_ivtx_to_cutpath_sequence.contains(elem.first);
                 bool is_connected_to_one_edge = elem.second.size() == 1;
                 return (!is_mapped && is_connected_to_one_edge);
             });
@@ -3433,7 +3367,7 @@ void dispatch(output_t& output, const input_t& input)
             m0_ivtx_to_cutpath_edges_iter = std::find_if(
                 m0_ivtx_to_cutpath_edges.cbegin(), m0_ivtx_to_cutpath_edges.cend(),
                 [&](const std::pair<vd_t, std::vector<ed_t>>& elem) {
-                    bool is_mapped = m0_ivtx_to_cutpath_sequence.find(elem.first) != m0_ivtx_to_cutpath_sequence.cend();
+                    bool is_mapped = m0_ivtx_to_cutpath_sequence.contains(elem.first);
                     return !is_mapped;
                 });
         }
@@ -3465,7 +3399,7 @@ void dispatch(output_t& output, const input_t& input)
             cutpath_edges_connected_to_first_vertex.cbegin(),
             cutpath_edges_connected_to_first_vertex.cend(),
             [&](const ed_t& incident_edge) {
-                return m0_edge_to_cutpath_sequence.find(incident_edge) == m0_edge_to_cutpath_sequence.cend();
+                return !m0_edge_to_cutpath_sequence.contains(incident_edge);
             });
 
         MCUT_ASSERT(incident_edge_find_iter != cutpath_edges_connected_to_first_vertex.cend());
@@ -3491,14 +3425,13 @@ void dispatch(output_t& output, const input_t& input)
             cur_cutpath_sequence.emplace_back(current_edge);
 
             // map vertex to current disjoint implicit cut-path sequence
-            MCUT_ASSERT(m0_ivtx_to_cutpath_sequence.count(current_vertex) == 0);
-            m0_ivtx_to_cutpath_sequence[current_vertex] = cur_cutpath_sequence_index;
-            MCUT_ASSERT(m0_ivtx_to_cutpath_sequence.count(current_vertex) == 1);
+            MCUT_ASSERT(!m0_ivtx_to_cutpath_sequence.contains(current_vertex));
+            map_ivtx_to_cutpath_sequence(current_vertex, cur_cutpath_sequence_index);
 
             // map edge to current disjoint implicit cut-path sequence
-            MCUT_ASSERT(m0_edge_to_cutpath_sequence.count(current_edge) == 0);
+            MCUT_ASSERT(!m0_edge_to_cutpath_sequence.contains(current_edge));
             m0_edge_to_cutpath_sequence[current_edge] = cur_cutpath_sequence_index;
-            MCUT_ASSERT(m0_edge_to_cutpath_sequence.count(current_edge) == 1);
+            m0_num_sequenced_edges++;
 
             // reset state
             next_vertex = hmesh_t::null_vertex();
@@ -3520,7 +3453,7 @@ void dispatch(output_t& output, const input_t& input)
             // ----------------------------------------------------------------
 
             // check if next vertex has already been associated with the cut-path sequence.
-            bool reached_end_of_sequence = m0_ivtx_to_cutpath_sequence.find(next_vertex) != m0_ivtx_to_cutpath_sequence.cend();
+            bool reached_end_of_sequence = m0_ivtx_to_cutpath_sequence.contains(next_vertex);
 
             if (!reached_end_of_sequence) {
                 // get the other edge connected to "next_vertex" i.e. the edge which is not the "current_edge"
@@ -3538,23 +3471,20 @@ void dispatch(output_t& output, const input_t& input)
                     const ed_t& other_edge = (current_edge == edge0) ? edge1 : edge0;
 
                     // check that "other_edge" has not already been mapped to a disjoint implicit cutpath sequence
-                    std::unordered_map<ed_t, int>::const_iterator find_iter = m0_edge_to_cutpath_sequence.find(other_edge);
-                    bool other_edge_is_already_mapped = (find_iter != m0_edge_to_cutpath_sequence.cend());
+                    bool other_edge_is_already_mapped = m0_edge_to_cutpath_sequence.contains(other_edge);
 
                     if (other_edge_is_already_mapped == false) {
                         next_edge = other_edge; // set sext edge
                     } else {
                         // reached end of sequence
-                        MCUT_ASSERT(m0_ivtx_to_cutpath_sequence.count(next_vertex) == 0);
+                        MCUT_ASSERT(!m0_ivtx_to_cutpath_sequence.contains(next_vertex));
                         // need to update this state here because we wont jump back up to the top of the loop as in the normal case.
                         // This is because "next_edge" is null, and the do-while loop continues iff "next_edge != hmesh_t::null_edge()"
-                        m0_ivtx_to_cutpath_sequence[next_vertex] = cur_cutpath_sequence_index;
-
-                        MCUT_ASSERT(m0_ivtx_to_cutpath_sequence.count(next_vertex) == 1);
+                        map_ivtx_to_cutpath_sequence(next_vertex, cur_cutpath_sequence_index);
                     }
                 } // if (current_edge_is_terminal == false) {
                 else {
-                    m0_ivtx_to_cutpath_sequence[next_vertex] = cur_cutpath_sequence_index;
+                    map_ivtx_to_cutpath_sequence(next_vertex, cur_cutpath_sequence_index);
                 }
             } // if (!reached_end_of_sequence) {
 
@@ -3562,7 +3492,7 @@ void dispatch(output_t& output, const input_t& input)
         } while (next_edge != hmesh_t::null_edge());
 
         // while not all intersection-points have been mapped to a disjoint implicit cutpath sequence
-    } while (m0_edge_to_cutpath_sequence.size() != m0_cutpath_edges.size());
+    } while (m0_num_sequenced_edges != (int)m0_cutpath_edges.size());
 
     MCUT_ASSERT(m0_cutpath_sequences.empty() == false);
 
@@ -3571,7 +3501,7 @@ void dispatch(output_t& output, const input_t& input)
 
     m0_cutpath_edges.clear(); // free
 
-    m0_edge_to_cutpath_sequence.clear(); // free
+    m0_edge_to_cutpath_sequence = edge_property_map_t<int>(); // free
     // m0_ivtx_to_cutpath_edges.clear();      // free
     // m0_cutpath_sequences.clear(); // free
 
@@ -3927,11 +3857,9 @@ void dispatch(output_t& output, const input_t& input)
 
             } while (next != ivtx_to_cp_edges.cend());
 
-            MCUT_ASSERT(ps_tested_face_to_plane_normal.find(shared_registry_entry_intersected_face) != ps_tested_face_to_plane_normal.end());
-            fpi.polygon_normal = SAFE_ACCESS(ps_tested_face_to_plane_normal, shared_registry_entry_intersected_face); // used for 2d project
-
-            MCUT_ASSERT(ps_tested_face_to_plane_normal_max_comp.find(shared_registry_entry_intersected_face) != ps_tested_face_to_plane_normal_max_comp.end());
-            fpi.polygon_normal_largest_component = SAFE_ACCESS(ps_tested_face_to_plane_normal_max_comp, shared_registry_entry_intersected_face);
+            MCUT_ASSERT(ps_tested_face_to_plane_normal_max_comp.contains(shared_registry_entry_intersected_face));
+            fpi.polygon_normal = ps_tested_face_to_plane_normal[shared_registry_entry_intersected_face]; // used for 2d project
+            fpi.polygon_normal_largest_component = ps_tested_face_to_plane_normal_max_comp[shared_registry_entry_intersected_face];
         }
     }
 
@@ -4107,7 +4035,7 @@ void dispatch(output_t& output, const input_t& input)
     for (std::unordered_map<ed_t, std::vector<std::pair<vd_t, vec3>>>::iterator edge_vertices_iter = ps_edge_to_vertices.begin(); edge_vertices_iter != ps_edge_to_vertices.end(); ++edge_vertices_iter) {
         std::vector<std::pair<vd_t, vec3>>& incident_vertices = edge_vertices_iter->second;
 
-        ps_edge_to_sorted_descriptors[edge_vertices_iter->first] = linear_projection_sort(incident_vertices);
+        ps_edge_to_sorted_descriptors[edge_vertices_iter->first] = linear_projection_sort(incident_vertices, true);
 
 #if 0
       // since all points are on straight line, we sort them by x-coord and by y-coord if x-coord is the same for all vertices
@@ -4251,7 +4179,7 @@ void dispatch(output_t& output, const input_t& input)
 
 #if defined(MCUT_MULTI_THREADED)
     {
-        typedef edge_array_iterator_t InputStorageIteratorType;
+        typedef polygon_soup_t::edge_iterator_t InputStorageIteratorType;
         typedef std::tuple<
             std::unordered_map<ed_t, ed_t>, // ps_to_m0_non_intersecting_edge
             std::unordered_map<fd_t, std::vector<ed_t>>, // ps_iface_to_m0_edge_list
@@ -4274,8 +4202,12 @@ void dispatch(output_t& output, const input_t& input)
             const uint32_t rough_number_of_edges = (uint32_t)std::distance(block_start_, block_end_);
             edges_LOCAL.reserve((uint32_t)(rough_number_of_edges * 1.2)); // most edges are original
 
-            for (edge_array_iterator_t iter_ps_edge = block_start_; iter_ps_edge != block_end_; ++iter_ps_edge) {
+            for (polygon_soup_t::edge_iterator_t iter_ps_edge = block_start_; iter_ps_edge != block_end_; ++iter_ps_edge) {
                 // std::cout << (uint32_t)(*iter_ps_edge) << std::endl;
+                if (ps.is_removed(*iter_ps_edge)) {
+                    continue;
+                }
+
                 if (ps_edge_to_vertices.find(*iter_ps_edge) != ps_edge_to_vertices.end()) {
                     continue; // the case of more than 3 vertices (handled above)
                 }
@@ -4284,11 +4216,6 @@ void dispatch(output_t& output, const input_t& input)
                 const vd_t ps_v0 = ps.vertex(ps_edge, 0);
                 const vd_t ps_v1 = ps.vertex(ps_edge, 1);
 
-                MCUT_ASSERT((int)(ps_v0) < (int)ps_to_m0_vtx.size());
-                const vd_t m0_v0 = ps_to_m0_vtx[ps_v0];
-                MCUT_ASSERT((int)(ps_v1) < (int)ps_to_m0_vtx.size());
-                const vd_t m0_v1 = ps_to_m0_vtx[ps_v1];
-
                 std::vector<vd_t> vertices_on_ps_edge = { ps_v0, ps_v1 };
                 std::unordered_map<ed_t, std::vector<vd_t>>::const_iterator ps_intersecting_edges_iter = ps_intersecting_edges.find(ps_edge);
                 if (ps_intersecting_edges_iter != ps_intersecting_edges.cend()) {
@@ -4424,6 +4351,7 @@ void dispatch(output_t& output, const input_t& input)
 
         parallel_fork_and_join(
             *input.scheduler,
+            input.serial_execution_threshold,
             ps.edges_begin(),
             ps.edges_end(),
             (1 << 10),
@@ -4528,7 +4456,11 @@ void dispatch(output_t& output, const input_t& input)
 #else
 
     // for each ps-edge
-    for (edge_array_iterator_t iter_ps_edge = ps.edges_begin(); iter_ps_edge != ps.edges_end(); ++iter_ps_edge) {
+    for (polygon_soup_t::edge_iterator_t iter_ps_edge = ps.edges_begin(); iter_ps_edge != ps.edges_end(); ++iter_ps_edge) {
+
+        if (ps.is_removed(*iter_ps_edge)) {
+            continue;
+        }
 
         if (ps_edge_to_vertices.empty() == false && ps_edge_to_vertices.find(*iter_ps_edge) != ps_edge_to_vertices.end()) {
             continue; // the case of more than 3 vertices (handled above)
@@ -4538,11 +4470,6 @@ void dispatch(output_t& output, const input_t& input)
         const vd_t ps_v0 = ps.vertex(ps_edge, 0);
         const vd_t ps_v1 = ps.vertex(ps_edge, 1);
 
-        MCUT_ASSERT((int)(ps_v0) < (int)ps_to_m0_vtx.size() /*ps_to_m0_vtx.find(ps_v0) != ps_to_m0_vtx.cend())*/);
-        const vd_t m0_v0 = ps_to_m0_vtx[ps_v0];
-        MCUT_ASSERT((int)(ps_v1) < (int)ps_to_m0_vtx.size() /*ps_to_m0_vtx.find(ps_v1) != ps_to_m0_vtx.cend()*/);
-        const vd_t m0_v1 = ps_to_m0_vtx[ps_v1];
-
         std::vector<vd_t> vertices_on_ps_edge = { ps_v0, ps_v1 }; // get_vertices_on_ps_edge(*iter_ps_edge, m0_ivtx_to_ps_edge, ps, m0_to_ps_vtx);
         std::unordered_map<ed_t, std::vector<vd_t>>::const_iterator ps_intersecting_edges_iter = ps_intersecting_edges.find(ps_edge);
         if (ps_intersecting_edges_iter != ps_intersecting_edges.cend()) {
@@ -4670,7 +4597,7 @@ void dispatch(output_t& output, const input_t& input)
     //
     // I use the word "polygon" here because they are not yet used to define a mesh -
     // at which point they become faces!
-    std::vector<traced_polygon_t> m0_polygons;
+    traced_polygons_t m0_polygons;
 
     // m0 polygons adjacent to cutpath from source-mesh faces
     std::vector<int> m0_sm_cutpath_adjacent_polygons;
@@ -4683,9 +4610,9 @@ void dispatch(output_t& output, const input_t& input)
 
 #if defined(MCUT_MULTI_THREADED)
     {
-        typedef face_array_iterator_t InputStorageIteratorType;
+        typedef polygon_soup_t::face_iterator_t InputStorageIteratorType;
         typedef std::tuple<
-            std::vector<traced_polygon_t>, // m0_polygons;
+            traced_polygons_t, // m0_polygons;
             std::vector<int>, // m0_sm_cutpath_adjacent_polygons
             std::vector<int>, // m0_cm_cutpath_adjacent_polygons;
             int, // traced_sm_polygon_count
@@ -4697,7 +4624,7 @@ void dispatch(output_t& output, const input_t& input)
                                      InputStorageIteratorType block_end_) -> OutputStorageTypesTuple {
             OutputStorageTypesTuple local_output;
 
-            std::vector<traced_polygon_t>& m0_polygons_LOCAL = std::get<0>(local_output);
+            traced_polygons_t& m0_polygons_LOCAL = std::get<0>(local_output);
             std::vector<int>& m0_sm_cutpath_adjacent_polygons_LOCAL = std::get<1>(local_output);
             std::vector<int>& m0_cm_cutpath_adjacent_polygons_LOCAL = std::get<2>(local_output);
             int& traced_sm_polygon_count_LOCAL = std::get<3>(local_output);
@@ -4705,7 +4632,9 @@ void dispatch(output_t& output, const input_t& input)
 
             traced_sm_polygon_count_LOCAL = 0;
 
-            for (face_array_iterator_t ps_face_iter = block_start_; ps_face_iter != block_end_; ++ps_face_iter) {
+            traced_polygons_t child_polygons; // new polygons traced on current face
+
+            for (polygon_soup_t::face_iterator_t ps_face_iter = block_start_; ps_face_iter != block_end_; ++ps_face_iter) {
                 const fd_t& ps_face = *ps_face_iter;
 
                 // get all the edges that lie on "ps_face", including the new one after partiting acording to intersection
@@ -4715,11 +4644,11 @@ void dispatch(output_t& output, const input_t& input)
                 bool is_intersecting_ps_face = ps_iface_to_m0_edge_list_fiter != ps_iface_to_m0_edge_list.end();
                 bool is_from_cut_mesh = ps_is_cutmesh_face(ps_face, sm_face_count);
 
-                std::vector<traced_polygon_t> child_polygons; // new polygons traced on current face
+                child_polygons.clear();
 
                 if (is_intersecting_ps_face == false) { // non-intersecting face
 
-                    traced_polygon_t retraced_poly; // ordered sequence of halfedges defining the unchanged polygon
+                    std::vector<hd_t> retraced_poly; // ordered sequence of halfedges defining the unchanged polygon
                     std::vector<hd_t> halfedges_around_face = ps.get_halfedges_around_face(ps_face);
                     retraced_poly.reserve(halfedges_around_face.size()); // minimum 3 (triangle)
 
@@ -4752,7 +4681,7 @@ void dispatch(output_t& output, const input_t& input)
                     const int poly_idx = (int)(m0_polygons_LOCAL.size() + child_polygons.size());
                     m0_to_ps_face_LOCAL[poly_idx] = ps_face;
 
-                    child_polygons.emplace_back(retraced_poly);
+                    child_polygons.push_back(retraced_poly);
                 } else {
 
                     // Here we enter the complex case of having to actually clip the current face
@@ -5054,7 +4983,7 @@ void dispatch(output_t& output, const input_t& input)
 
                     do { // each iteration traces a child polygon
 
-                        traced_polygon_t child_polygon;
+                        std::vector<hd_t> child_polygon;
                         hd_t current_halfedge = hmesh_t::null_halfedge();
                         hd_t next_halfedge = incident_halfedges_to_be_walked.front();
 
@@ -5186,13 +5115,13 @@ void dispatch(output_t& output, const input_t& input)
                             }
 
                             m0_to_ps_face_LOCAL[poly_idx] = ps_face;
-                            child_polygons.emplace_back(child_polygon);
+                            child_polygons.push_back(child_polygon);
                         }
 
                     } while (!incident_halfedges_to_be_walked.empty());
                 } // if (!is_intersecting_ps_face) {
 
-                m0_polygons_LOCAL.insert(m0_polygons_LOCAL.end(), child_polygons.cbegin(), child_polygons.cend());
+                m0_polygons_LOCAL.append(child_polygons);
 
                 if (!is_from_cut_mesh) {
                     traced_sm_polygon_count_LOCAL += (int)child_polygons.size();
@@ -5207,6 +5136,7 @@ void dispatch(output_t& output, const input_t& input)
 
         parallel_fork_and_join(
             *input.scheduler,
+            input.serial_execution_threshold,
             ps.faces_begin(),
             ps.faces_end(),
             (1 << 7),
@@ -5217,19 +5147,18 @@ void dispatch(output_t& output, const input_t& input)
         // This lambda merges the local traced face data structures computed by each
         // thread into their corresponding global data structure.
         auto merge_local_traced_faces = [](
-                                            const std::vector<traced_polygon_t>& m0_polygons_FUTURE,
+                                            const traced_polygons_t& m0_polygons_FUTURE,
                                             const std::vector<int>& m0_sm_cutpath_adjacent_polygons_FUTURE,
                                             const std::vector<int>& m0_cm_cutpath_adjacent_polygons_FUTURE,
                                             const int& traced_sm_polygon_count_FUTURE,
                                             const std::unordered_map<int, fd_t>& m0_to_ps_face_FUTURE,
-                                            std::vector<traced_polygon_t>& m0_polygons,
+                                            traced_polygons_t& m0_polygons,
                                             std::vector<int>& m0_sm_cutpath_adjacent_polygons,
                                             std::vector<int>& m0_cm_cutpath_adjacent_polygons,
                                             int& traced_sm_polygon_count,
                                             std::unordered_map<int, fd_t>& m0_to_ps_face) {
             int base_offset = (int)m0_polygons.size();
-            m0_polygons.reserve(m0_polygons.size() + m0_polygons_FUTURE.size());
-            m0_polygons.insert(m0_polygons.end(), m0_polygons_FUTURE.cbegin(), m0_polygons_FUTURE.cend());
+            m0_polygons.append(m0_polygons_FUTURE);
 
             m0_sm_cutpath_adjacent_polygons.reserve(m0_sm_cutpath_adjacent_polygons.size() + m0_sm_cutpath_adjacent_polygons_FUTURE.size());
             for (int i = 0; i < (int)m0_sm_cutpath_adjacent_polygons_FUTURE.size(); ++i) {
@@ -5260,7 +5189,7 @@ void dispatch(output_t& output, const input_t& input)
             MCUT_ASSERT(f.valid());
             OutputStorageTypesTuple future_result = f.get(); // "get()" is a blocking function
 
-            const std::vector<traced_polygon_t>& m0_polygons_FUTURE = std::get<0>(future_result);
+            const traced_polygons_t& m0_polygons_FUTURE = std::get<0>(future_result);
             const std::vector<int>& m0_sm_cutpath_adjacent_polygons_FUTURE = std::get<1>(future_result);
             const std::vector<int>& m0_cm_cutpath_adjacent_polygons_FUTURE = std::get<2>(future_result);
             const int& traced_sm_polygon_count_FUTURE = std::get<3>(future_result);
@@ -5282,7 +5211,7 @@ void dispatch(output_t& output, const input_t& input)
         // merge master thread output at the end to that we maintain the order of the traced polygons
         // This order is important for a number of tricks employed throughout the code in following parts
         // e.g. using integer offsets to infer the start of cm traced polygons etc.
-        const std::vector<traced_polygon_t>& m0_polygons_MASTER_THREAD_LOCAL = std::get<0>(partial_res);
+        const traced_polygons_t& m0_polygons_MASTER_THREAD_LOCAL = std::get<0>(partial_res);
         const std::vector<int>& m0_sm_cutpath_adjacent_polygons_MASTER_THREAD_LOCAL = std::get<1>(partial_res);
         const std::vector<int>& m0_cm_cutpath_adjacent_polygons_MASTER_THREAD_LOCAL = std::get<2>(partial_res);
         const int& traced_sm_polygon_count_MASTER_THREAD_LOCAL = std::get<3>(partial_res);
@@ -5301,8 +5230,10 @@ void dispatch(output_t& output, const input_t& input)
             m0_to_ps_face);
     } // end of parallel scope
 #else
+    traced_polygons_t child_polygons; // new polygons traced on current face
+
     // for each face in the polygon-soup mesh
-    for (face_array_iterator_t ps_face_iter = ps.faces_begin(); ps_face_iter != ps.faces_end(); ++ps_face_iter) {
+    for (polygon_soup_t::face_iterator_t ps_face_iter = ps.faces_begin(); ps_face_iter != ps.faces_end(); ++ps_face_iter) {
 
         const fd_t& ps_face = *ps_face_iter;
 
@@ -5313,14 +5244,14 @@ void dispatch(output_t& output, const input_t& input)
         bool is_intersecting_ps_face = ps_iface_to_m0_edge_list_fiter != ps_iface_to_m0_edge_list.end();
         bool is_from_cut_mesh = ps_is_cutmesh_face(ps_face, sm_face_count);
 
-        std::vector<traced_polygon_t> child_polygons; // new polygons traced on current face
+        child_polygons.clear();
 
         if (is_intersecting_ps_face == false) { // non-intersecting face
 
             // NOTE: here we just copy the polygon as-is because it does not change.
             // --------------------------------------------------------------------
 
-            traced_polygon_t retraced_poly; // ordered sequence of halfedges defining the unchanged polygon
+            std::vector<hd_t> retraced_poly; // ordered sequence of halfedges defining the unchanged polygon
 
             // query the halfedge sequence in the polygon soup that defines our polygon
             std::vector<hd_t> halfedges_around_face = ps.get_halfedges_around_face(ps_face);
@@ -5369,7 +5300,7 @@ void dispatch(output_t& output, const input_t& input)
             m0_to_ps_face[poly_idx] = ps_face;
 
             // save the retraced polygon, using the information in "m0" from "ps"
-            child_polygons.emplace_back(retraced_poly);
+            child_polygons.push_back(retraced_poly);
         } else {
 
             // Here we enter the complex case of having to actually clip the current face
@@ -5823,7 +5754,7 @@ void dispatch(output_t& output, const input_t& input)
 
             do { // each iteration traces a child polygon
 
-                traced_polygon_t child_polygon;
+                std::vector<hd_t> child_polygon;
 
                 hd_t current_halfedge = hmesh_t::null_halfedge();
                 // can be any boundary halfedge in vector (NOTE: boundary halfedges come first in the std::vector)
@@ -5979,13 +5910,13 @@ void dispatch(output_t& output, const input_t& input)
 
                     m0_to_ps_face[poly_idx] = ps_face;
 
-                    child_polygons.emplace_back(child_polygon);
+                    child_polygons.push_back(child_polygon);
                 }
 
             } while (!incident_halfedges_to_be_walked.empty());
         } // if (!is_intersecting_ps_face) {
 
-        m0_polygons.insert(m0_polygons.end(), child_polygons.cbegin(), child_polygons.cend());
+        m0_polygons.append(child_polygons);
 
         if (!is_from_cut_mesh /*!ps_is_cutmesh_face(ps_face, sm_face_count)*/) {
             traced_sm_polygon_count += (int)child_polygons.size();
@@ -5997,6 +5928,8 @@ void dispatch(output_t& output, const input_t& input)
 
     TIMESTACK_POP(); // &&&&&
 
+    update_peak_element_counts(m0);
+
     // m0_ivtx_to_ps_faces.clear(); // free
     ps_iface_to_m0_edge_list.clear(); // free
     ps_to_m0_edges.clear(); // free
@@ -6021,10 +5954,7 @@ void dispatch(output_t& output, const input_t& input)
 
     MCUT_ASSERT((int)m0_polygons.size() >= ps.number_of_faces());
 
-    const std::vector<traced_polygon_t>::iterator traced_sm_polygons_iter_end = m0_polygons.begin() + traced_sm_polygon_count;
-    // const std::vector<traced_polygon_t>::iterator& traced_cs_polygons_iter_begin = traced_sm_polygons_iter_end;
-    const std::vector<traced_polygon_t>::const_iterator m0_traced_sm_polygons_iter_cend = m0_polygons.cbegin() + traced_sm_polygon_count;
-    const std::vector<traced_polygon_t>::const_iterator& traced_cs_polygons_iter_cbegin = traced_sm_polygons_iter_end;
+    const int traced_cs_polygon_count = (int)m0_polygons.size() - traced_sm_polygon_count;
 
     TIMESTACK_PUSH("Mark seam edges *");
     // extract the seam vertices
@@ -6066,11 +5996,13 @@ void dispatch(output_t& output, const input_t& input)
             extract_connected_components(
 #if defined(MCUT_MULTI_THREADED)
                 *input.scheduler,
+                input.serial_execution_threshold,
 #endif
                 separated_src_mesh_fragments,
                 m0,
                 0, // no offset because traced source-mesh polygons start from the beginning of "m0_polygons"
-                std::vector<traced_polygon_t>(m0_polygons.begin(), traced_sm_polygons_iter_end),
+                traced_sm_polygon_count,
+                m0_polygons,
                 std::vector<int>(), // sm_polygons_below_cs
                 std::vector<int>(), // sm_polygons_above_cs
                 m0_vertex_to_seam_flag,
@@ -6115,11 +6047,13 @@ void dispatch(output_t& output, const input_t& input)
             hmesh_t merged = extract_connected_components(
 #if defined(MCUT_MULTI_THREADED)
                 *input.scheduler,
+                input.serial_execution_threshold,
 #endif
                 separated_cut_mesh_fragments,
                 m0,
                 traced_sm_polygon_count, // offset to start of traced cut-mesh polygons in "m0_polygons".
-                std::vector<traced_polygon_t>(traced_cs_polygons_iter_cbegin, m0_polygons.cend()),
+                traced_cs_polygon_count,
+                m0_polygons,
                 std::vector<int>(),
                 std::vector<int>(),
                 m0_vertex_to_seam_flag,
@@ -6191,12 +6125,9 @@ void dispatch(output_t& output, const input_t& input)
     std::vector<std::vector<int>> m0_h_to_ply(m0.number_of_halfedges());
 
     // for each traced polygon
-    for (std::vector<traced_polygon_t>::const_iterator traced_polygon_iter = m0_polygons.cbegin();
-         traced_polygon_iter != m0_polygons.cend();
-         ++traced_polygon_iter) {
+    for (int traced_polygon_index = 0; traced_polygon_index < (int)m0_polygons.size(); ++traced_polygon_index) {
 
-        const traced_polygon_t& traced_polygon = *traced_polygon_iter;
-        const int traced_polygon_index = (int)std::distance(m0_polygons.cbegin(), traced_polygon_iter);
+        const traced_polygon_t traced_polygon = m0_polygons[traced_polygon_index];
 
         // for each halfedge in polygon
         for (traced_polygon_t::const_iterator traced_polygon_halfedge_iter = traced_polygon.cbegin();
@@ -6299,7 +6230,8 @@ void dispatch(output_t& output, const input_t& input)
                 }
 
                 // check that the target vertex is along a cut-path making a hole
-                const int tgt_explicit_cutpath_sequence_idx = SAFE_ACCESS(m0_ivtx_to_cutpath_sequence, cs_poly_he_tgt);
+                MCUT_ASSERT(m0_ivtx_to_cutpath_sequence.contains(cs_poly_he_tgt));
+                const int tgt_explicit_cutpath_sequence_idx = m0_ivtx_to_cutpath_sequence[cs_poly_he_tgt];
                 bool cutpath_makes_a_hole = std::find(explicit_cutpaths_making_holes.cbegin(),
                                                 explicit_cutpaths_making_holes.cend(),
                                                 tgt_explicit_cutpath_sequence_idx)
@@ -6395,17 +6327,17 @@ void dispatch(output_t& output, const input_t& input)
                 }
 
                 MCUT_ASSERT(tested_face != registry_entry_faces.cend()); // "registry_entry_faces" must have at least one face from cm and at least one from sm
-                MCUT_ASSERT(ps_tested_face_to_plane_normal.find(*tested_face) != ps_tested_face_to_plane_normal.cend());
+                MCUT_ASSERT(ps_tested_face_to_plane_normal_max_comp.contains(*tested_face));
 
                 // get normal of face
-                const vec3& polygon_normal = SAFE_ACCESS(ps_tested_face_to_plane_normal, *tested_face); // SAFE_ACCESS(m0_ivtx_to_tested_polygon_normal, cs_poly_he_tgt);
+                const vec3& polygon_normal = ps_tested_face_to_plane_normal[*tested_face]; // SAFE_ACCESS(m0_ivtx_to_tested_polygon_normal, cs_poly_he_tgt);
                 // const vec3& polygon_normal = geometric_data.first; // source-mesh face normal
                 // const double& orig_scalar_prod = geometric_data.second; // the dot product result we computed earlier
 
                 // MCUT_ASSERT(sign(orig_scalar_prod) == NEGATIVE);
 
                 // calculate the vector represented by the current halfedge
-                const vec3 cs_poly_he_vector = m0.vertex(cs_poly_he_tgt) - m0.vertex(cs_poly_he_src);
+                const vec3 cs_poly_he_vector = get_vector_to_ivertex_on_ps_edge(m0, ps, cs_poly_he_src, cs_poly_he_tgt, cs_poly_he_tgt_ipair.first);
                 // calculate dot product with the src-mesh normal
                 const double scalar_prod = dot_product(polygon_normal, cs_poly_he_vector);
                 // the original ps-halfedge was "incoming" (pointing inwards) and gave a
@@ -6426,7 +6358,7 @@ void dispatch(output_t& output, const input_t& input)
     }
 
     // cm_nonborder_reentrant_ivtx_list.clear(); // free
-    m0_ivtx_to_cutpath_sequence.clear(); // free
+    m0_ivtx_to_cutpath_sequence = vertex_property_map_t<int>(); // free
 
     TIMESTACK_POP();
 
@@ -6545,17 +6477,17 @@ void dispatch(output_t& output, const input_t& input)
             }
 
             MCUT_ASSERT(tested_face != registry_entry_faces.cend()); // "registry_entry_faces" must have at least one face from cm and at least one from sm
-            MCUT_ASSERT(ps_tested_face_to_plane_normal.find(*tested_face) != ps_tested_face_to_plane_normal.cend());
+            MCUT_ASSERT(ps_tested_face_to_plane_normal_max_comp.contains(*tested_face));
 
             // get normal of face
-            const vec3& polygon_normal = SAFE_ACCESS(ps_tested_face_to_plane_normal, *tested_face);
+            const vec3& polygon_normal = ps_tested_face_to_plane_normal[*tested_face];
             // const vec3& polygon_normal = SAFE_ACCESS(m0_ivtx_to_tested_polygon_normal, sm_poly_he_tgt);
             // const vec3& polygon_normal = geometric_data.first;
             // const double& orig_scalar_prod = geometric_data.second;
 
             // MCUT_ASSERT(sign(orig_scalar_prod) == NEGATIVE);
 
-            const vec3 sm_poly_he_vector = m0.vertex(sm_poly_he_tgt) - m0.vertex(sm_poly_he_src);
+            const vec3 sm_poly_he_vector = get_vector_to_ivertex_on_ps_edge(m0, ps, sm_poly_he_src, sm_poly_he_tgt, tgt_ps_edge);
             const double scalar_prod = dot_product(polygon_normal, sm_poly_he_vector);
 
             // Again, the notion of exterior is denoted by a negative dot-product.
@@ -6780,6 +6712,7 @@ void dispatch(output_t& output, const input_t& input)
 
     // store's the (unsealed) connected components (fragments of the source-mesh)
     hmesh_t m1;
+    m1.enable_edge_index(true);
 
     // copy vertices from m0 t0 m1 (and save mapping to avoid assumptions).
     // This map DOES NOT include patch intersection points because they are new
@@ -6811,7 +6744,7 @@ void dispatch(output_t& output, const input_t& input)
     // lost after duplicating intersection points and transforming all halfedges
     // along the cut-path.
 
-    std::unordered_map<hd_t, hd_t> m0_to_m1_he;
+    halfedge_property_map_t<hd_t> m0_to_m1_he(m0, hmesh_t::null_halfedge());
 
     for (edge_array_iterator_t e = m0.edges_begin(); e != m0.edges_end(); ++e) {
         const ed_t& m0_edge = (*e);
@@ -6829,20 +6762,21 @@ void dispatch(output_t& output, const input_t& input)
             const vd_t m0_h0_src = m0.source(m0_h0);
             const hd_t m0_h1 = m0.halfedge(m0_edge, 1);
             const vd_t m1_halfedge_src = m1.source(m1_halfedge);
-            const vd_t m1_halfedge_tgt = m1.target(m1_halfedge);
 
             if (SAFE_ACCESS(m0_to_m1_vtx, m0_h0_src) == m1_halfedge_src) { // i.e. "is the m0_h0 equivalent to m1_halfedge?"
-                m0_to_m1_he.insert(std::make_pair(m0_h0, m1_halfedge));
-                m0_to_m1_he.insert(std::make_pair(m0_h1, m1.opposite(m1_halfedge)));
+                m0_to_m1_he[m0_h0] = m1_halfedge;
+                m0_to_m1_he[m0_h1] = m1.opposite(m1_halfedge);
             } else {
-                m0_to_m1_he.insert(std::make_pair(m0_h1, m1_halfedge));
-                m0_to_m1_he.insert(std::make_pair(m0_h0, m1.opposite(m1_halfedge)));
+                m0_to_m1_he[m0_h1] = m1_halfedge;
+                m0_to_m1_he[m0_h0] = m1.opposite(m1_halfedge);
             }
         }
     }
 
     TIMESTACK_POP();
 
+    update_peak_element_counts(m1);
+
     TIMESTACK_PUSH("m0 source mesh set next");
     //
     // For each src-mesh halfedge we store "next-halfedge" state for quick-lookup in "m0".
@@ -6858,10 +6792,8 @@ void dispatch(output_t& output, const input_t& input)
     //
 
     // for each source-mesh polygon
-    for (std::vector<traced_polygon_t>::const_iterator traced_sm_polygon_iter = m0_polygons.cbegin();
-         traced_sm_polygon_iter != m0_traced_sm_polygons_iter_cend;
-         ++traced_sm_polygon_iter) {
-        const traced_polygon_t& traced_sm_polygon = *traced_sm_polygon_iter;
+    for (int traced_sm_polygon_index = 0; traced_sm_polygon_index < traced_sm_polygon_count; ++traced_sm_polygon_index) {
+        const traced_polygon_t traced_sm_polygon = m0_polygons[traced_sm_polygon_index];
 
         // for each halfedge of polygon
         for (traced_polygon_t::const_iterator traced_sm_polygon_halfedge_iter = traced_sm_polygon.cbegin();
@@ -7227,7 +7159,6 @@ void dispatch(output_t& output, const input_t& input)
                     // here, we have an exterior halfedge whose "m1" version has already been created.
                     //
                     MCUT_ASSERT(m0_to_m1_ihe.find(m0_cur_h) != m0_to_m1_ihe.cend());
-                    const hd_t m1_cur_h = SAFE_ACCESS(m0_to_m1_ihe, m0_cur_h);
                 }
 
                 //
@@ -7390,8 +7321,9 @@ void dispatch(output_t& output, const input_t& input)
     //
 
     // the updated polygons (with the partitioning)
-    std::vector<traced_polygon_t> m1_polygons;
-    m1_polygons.resize(traced_sm_polygon_count); // resize to match
+    // NOTE: the halfedges of each polygon are copied from "m0" and then replaced with their "m1" versions
+    traced_polygons_t m1_polygons;
+    m1_polygons.reserve(traced_sm_polygon_count, m0_polygons.number_of_halfedges());
 
     // NOTE: this map contains polygons which are traced on the source mesh only.
     // We do this because cut-mesh polygon will have two version each, where
@@ -7401,17 +7333,12 @@ void dispatch(output_t& output, const input_t& input)
     std::unordered_map<int, int> m1_to_m0_face;
 
     // for each traced polygon (in "m0")
-    for (std::vector<traced_polygon_t>::const_iterator m0_traced_sm_polygon_iter = m0_polygons.cbegin();
-         m0_traced_sm_polygon_iter != m0_traced_sm_polygons_iter_cend;
-         ++m0_traced_sm_polygon_iter) {
-        const traced_polygon_t& m0_sm_polygon = *m0_traced_sm_polygon_iter; // m0 version (unpartitioned)
-        // get index of polygon
-        const int polygon_index = (int)std::distance(m0_polygons.cbegin(), m0_traced_sm_polygon_iter);
+    for (int polygon_index = 0; polygon_index < traced_sm_polygon_count; ++polygon_index) {
+        const traced_polygon_t m0_sm_polygon = m0_polygons[polygon_index]; // m0 version (unpartitioned)
 
-        MCUT_ASSERT(polygon_index < (int)m1_polygons.size()); // sanity check
+        m1_polygons.push_back(m0_sm_polygon.cbegin(), m0_sm_polygon.cend()); // same size as the m0 version
 
-        traced_polygon_t& m1_sm_polygon = SAFE_ACCESS(m1_polygons, polygon_index); // m1 version (partitioned)
-        m1_sm_polygon.resize(m0_sm_polygon.size()); // resize to match
+        const traced_polygons_t::polygon_t m1_sm_polygon = m1_polygons[polygon_index]; // m1 version (partitioned)
 
         // for each halfedge of current polygon
         for (traced_polygon_t::const_iterator m0_traced_sm_polygon_halfedge_iter = m0_sm_polygon.cbegin();
@@ -7431,9 +7358,9 @@ void dispatch(output_t& output, const input_t& input)
 
                 m1_he = SAFE_ACCESS(m0_to_m1_ihe, m0_he); // m1 version
             } else {
-                MCUT_ASSERT(m0_to_m1_he.find(m0_he) != m0_to_m1_he.cend());
+                MCUT_ASSERT(m0_to_m1_he.contains(m0_he));
 
-                m1_he = SAFE_ACCESS(m0_to_m1_he, m0_he); // m1 version
+                m1_he = m0_to_m1_he[m0_he]; // m1 version
             }
 
             // get halfedge index in polygon
@@ -7448,7 +7375,7 @@ void dispatch(output_t& output, const input_t& input)
         m1_to_m0_face[polygon_index] = polygon_index;
     }
 
-    m0_to_m1_he.clear();
+    m0_to_m1_he = halfedge_property_map_t<hd_t>(); // free
 
     TIMESTACK_POP();
 
@@ -7479,10 +7406,12 @@ void dispatch(output_t& output, const input_t& input)
         extract_connected_components(
 #if defined(MCUT_MULTI_THREADED)
             *input.scheduler,
+            input.serial_execution_threshold,
 #endif
             unsealed_connected_components,
             m1,
             0,
+            (int)m1_polygons.size(),
             m1_polygons,
             sm_polygons_below_cs,
             sm_polygons_above_cs,
@@ -7630,9 +7559,9 @@ void dispatch(output_t& output, const input_t& input)
             // the actual polygon
             MCUT_ASSERT(h_polygon_idx < (int)m0_polygons.size());
 
-            const std::vector<hd_t>& h_polygon = SAFE_ACCESS(m0_polygons, h_polygon_idx);
+            const traced_polygon_t h_polygon = m0_polygons[h_polygon_idx];
             // find the index of h0 in the polygon
-            std::vector<hd_t>::const_iterator h_polygon_find_iter = std::find_if(
+            traced_polygon_t::const_iterator h_polygon_find_iter = std::find_if(
                 h_polygon.cbegin(), h_polygon.cend(),
                 [&](const hd_t& e) {
                     return e == h;
@@ -8067,80 +7996,85 @@ void dispatch(output_t& output, const input_t& input)
 
         do {
 
-            // pull any re-entrant vertex from queue
-            const vd_t current_reentrant_ivertex = reentrant_ivertex_queue.front();
-
             hd_t current_cs_border_he = hmesh_t::null_halfedge();
             hd_t next_cs_border_he = hmesh_t::null_halfedge();
             int current_cs_border_he_idx = -1;
             int next_cs_border_he_idx = -1;
 
             //
-            // find polygon, and its halfedge whose src vertex is the current re-entrant vertex
-            // "current_reentrant_ivertex", and the target is not an intersection point
+            // find polygon, and its halfedge whose src vertex is a re-entrant vertex in
+            // "reentrant_ivertex_queue", and the target is not an intersection point
             // keep in mind that we are looking for the non-intersection points that lie
             // inside the src-mesh - so that we dont duplicate them.
             //
-            std::vector<traced_polygon_t>::const_iterator next_cs_border_he_poly_find_iter = std::find_if(
-                m0_polygons.cbegin() + traced_sm_polygon_count, // offset to start of traced cut-mesh polygons
-                m0_polygons.cend(),
-                [&](const traced_polygon_t& cs_poly) {
-                    // for each halfedge of cut-mesh polygon
-                    for (traced_polygon_t::const_iterator cs_poly_he_iter = cs_poly.cbegin();
-                         cs_poly_he_iter != cs_poly.cend();
-                         ++cs_poly_he_iter) {
-
-                        // check if the target is an intersection point
-                        const vd_t tgt = m0.target(*cs_poly_he_iter);
-                        const bool tgt_is_ivertex = m0_is_intersection_point(tgt, ps_vtx_cnt);
-
-                        if (tgt_is_ivertex) { //..-->x
-                            continue;
-                        }
+            auto find_next_cs_border_he = [&](const traced_polygon_t& cs_poly) {
+                // for each halfedge of cut-mesh polygon
+                for (traced_polygon_t::const_iterator cs_poly_he_iter = cs_poly.cbegin();
+                     cs_poly_he_iter != cs_poly.cend();
+                     ++cs_poly_he_iter) {
+
+                    // check if the target is an intersection point
+                    const vd_t tgt = m0.target(*cs_poly_he_iter);
+                    const bool tgt_is_ivertex = m0_is_intersection_point(tgt, ps_vtx_cnt);
+
+                    if (tgt_is_ivertex) { //..-->x
+                        continue;
+                    }
 
-                        // is the halfedge on the border of the cut-mesh i.e. its opposite halfedge is not
-                        // used to trace a polygon
-                        const bool is_on_cs_border = SAFE_ACCESS(m0_h_to_ply, m0.opposite(*cs_poly_he_iter)).size() == 0; // m0_h_to_ply.find(m0.opposite(*cs_poly_he_iter)) == m0_h_to_ply.cend(); // opposite is used to traced a polygon
+                    // is the halfedge on the border of the cut-mesh i.e. its opposite halfedge is not
+                    // used to trace a polygon
+                    const bool is_on_cs_border = SAFE_ACCESS(m0_h_to_ply, m0.opposite(*cs_poly_he_iter)).size() == 0; // m0_h_to_ply.find(m0.opposite(*cs_poly_he_iter)) == m0_h_to_ply.cend(); // opposite is used to traced a polygon
 
-                        if (is_on_cs_border) {
+                    if (is_on_cs_border) {
 
-                            // check if the src vertex of the current halfedge is a re-entrant vertex
-                            // we search through the queue because it contains the tip re-entrant vertices
-                            // that have not yet been visited (valid set).
-                            // Note that this implies that src is also an intersection point
-                            const vd_t src = m0.source(*cs_poly_he_iter);
-                            const bool src_is_reentrant = std::find(reentrant_ivertex_queue.cbegin(), reentrant_ivertex_queue.cend(), src) != reentrant_ivertex_queue.cend();
+                        // check if the src vertex of the current halfedge is a re-entrant vertex
+                        // we search through the queue because it contains the tip re-entrant vertices
+                        // that have not yet been visited (valid set).
+                        // Note that this implies that src is also an intersection point
+                        const vd_t src = m0.source(*cs_poly_he_iter);
+                        const bool src_is_reentrant = std::find(reentrant_ivertex_queue.cbegin(), reentrant_ivertex_queue.cend(), src) != reentrant_ivertex_queue.cend();
 
-                            if (src_is_reentrant) {
+                        if (src_is_reentrant) {
 
-                                // we have found that first halfedge from which the remaining one(s)
-                                // inside the src-mesh can be found
-                                next_cs_border_he = *cs_poly_he_iter;
-                                next_cs_border_he_idx = (int)std::distance(cs_poly.cbegin(), cs_poly_he_iter);
-                                break;
-                            } else {
-                                continue;
-                            }
+                            // we have found that first halfedge from which the remaining one(s)
+                            // inside the src-mesh can be found
+                            next_cs_border_he = *cs_poly_he_iter;
+                            next_cs_border_he_idx = (int)std::distance(cs_poly.cbegin(), cs_poly_he_iter);
+                            break;
                         } else {
                             continue;
                         }
+                    } else {
+                        continue;
                     }
+                }
 
-                    return (next_cs_border_he != hmesh_t::null_halfedge());
-                });
+                return (next_cs_border_he != hmesh_t::null_halfedge());
+            };
+
+            // index of the polygon which is traced with the halfedge we found
+            int next_cs_border_he_poly_idx = -1;
 
-            reentrant_ivertex_queue.pop_front(); // rm current_reentrant_ivertex
+            // for each traced cut-mesh polygon
+            for (int cs_poly_idx = traced_sm_polygon_count; cs_poly_idx < (int)m0_polygons.size(); ++cs_poly_idx) {
+                if (find_next_cs_border_he(m0_polygons[cs_poly_idx])) {
+                    next_cs_border_he_poly_idx = cs_poly_idx;
+                    break;
+                }
+            }
+
+            reentrant_ivertex_queue.pop_front();
 
             // we could not find a halfedge whose src vertex is the current re-entrant vertex
-            if (next_cs_border_he_poly_find_iter == m0_polygons.cend()) {
+            if (next_cs_border_he_poly_idx == -1) {
                 // happens when a single cut-mesh partially cuts the src-mesh whereby
                 // a single edge passes through 2 or more src-mesh faces e.g.
                 // tet vs triangle partial cut
                 continue;
             }
 
-            // a reference to the polygon which is traced with the halfedge we found
-            std::vector<traced_polygon_t>::const_iterator current_cs_border_he_poly_find_iter = m0_polygons.cend();
+            // the index of the polygon which is traced with the halfedge we found
+            int current_cs_border_he_poly_idx = -1;
 
             //
             // we will now walk along the border of the cut-mesh saving all non
@@ -8151,14 +8085,14 @@ void dispatch(output_t& output, const input_t& input)
                 // current border halfedge
                 current_cs_border_he = next_cs_border_he;
                 // polygon of current border halfedge
-                current_cs_border_he_poly_find_iter = next_cs_border_he_poly_find_iter;
+                current_cs_border_he_poly_idx = next_cs_border_he_poly_idx;
                 // index of current border halfedge
                 current_cs_border_he_idx = next_cs_border_he_idx;
 
                 // reset
                 next_cs_border_he = hmesh_t::null_halfedge();
                 next_cs_border_he_idx = -1;
-                next_cs_border_he_poly_find_iter = m0_polygons.cend();
+                next_cs_border_he_poly_idx = -1;
 
                 // save the non-intersection point on the border
                 const vd_t current_cs_border_he_tgt = m0.target(current_cs_border_he);
@@ -8190,11 +8124,11 @@ void dispatch(output_t& output, const input_t& input)
 
                 // We do this by circulating around "current_cs_border_he_tgt" to find the next border halfedge
                 // starting from the next after the current halfedge (around the vertex)
-                std::vector<traced_polygon_t>::const_iterator next_he_poly_iter = current_cs_border_he_poly_find_iter;
-                std::vector<traced_polygon_t>::const_iterator cur_he_poly_iter = m0_polygons.cend();
-                int next_he_idx = wrap_integer(current_cs_border_he_idx + 1, 0, (int)next_he_poly_iter->size() - 1);
+                int next_he_poly_idx = current_cs_border_he_poly_idx;
+                int cur_he_poly_idx = -1;
+                int next_he_idx = wrap_integer(current_cs_border_he_idx + 1, 0, (int)m0_polygons[next_he_poly_idx].size() - 1);
                 int cur_he_idx = -1;
-                hd_t next_he = next_he_poly_iter->at(next_he_idx);
+                hd_t next_he = m0_polygons[next_he_poly_idx][next_he_idx];
                 hd_t cur_he = hmesh_t::null_halfedge();
 
                 do {
@@ -8206,9 +8140,9 @@ void dispatch(output_t& output, const input_t& input)
                     MCUT_ASSERT(cur_he_idx != -1);
                     next_he_idx = -1;
 
-                    cur_he_poly_iter = next_he_poly_iter;
-                    MCUT_ASSERT(cur_he_poly_iter != m0_polygons.cend());
-                    next_he_poly_iter = m0_polygons.cend();
+                    cur_he_poly_idx = next_he_poly_idx;
+                    MCUT_ASSERT(cur_he_poly_idx != -1);
+                    next_he_poly_idx = -1;
 
                     // the next halfedge descriptor itself
                     // const hd_t& cur_he = SAFE_ACCESS(current_cs_border_he_poly, cur_he_idx); // in the polygon of current_cs_border_he
@@ -8222,19 +8156,16 @@ void dispatch(output_t& output, const input_t& input)
                     if (opp_of_cur_he_is_border) { // found!
                         next_cs_border_he = cur_he;
                         next_cs_border_he_idx = cur_he_idx;
-                        next_cs_border_he_poly_find_iter = cur_he_poly_iter;
+                        next_cs_border_he_poly_idx = cur_he_poly_idx;
                     } else {
 
                         // get index of this neighouring polygon
                         MCUT_ASSERT(SAFE_ACCESS(m0_h_to_ply, opp_of_cur_he).size() > 0 /*m0_h_to_ply.find(opp_of_cur_he) != m0_h_to_ply.cend()*/);
                         const int& opp_of_cur_he_poly_idx = SAFE_ACCESS(m0_h_to_ply, opp_of_cur_he).front(); // NOTE: class-2 or class-1 ihalfedges are incident to only one polygon
-                        // reference to the neighbour/adjacent polygon
-                        std::vector<traced_polygon_t>::const_iterator opp_of_cur_he_poly_iter = m0_polygons.cbegin() + (opp_of_cur_he_poly_idx);
-
-                        MCUT_ASSERT(opp_of_cur_he_poly_iter != m0_polygons.cend());
+                        MCUT_ASSERT(opp_of_cur_he_poly_idx < (int)m0_polygons.size());
 
                         // get the neighbouring polygon itself
-                        const traced_polygon_t& opp_of_cur_he_poly = *opp_of_cur_he_poly_iter;
+                        const traced_polygon_t opp_of_cur_he_poly = m0_polygons[opp_of_cur_he_poly_idx];
                         // get the reference to the next of opposite of current halfedge
                         const traced_polygon_t::const_iterator opp_of_cur_he_find_iter = std::find(
                             opp_of_cur_he_poly.cbegin(), opp_of_cur_he_poly.cend(), opp_of_cur_he);
@@ -8256,7 +8187,7 @@ void dispatch(output_t& output, const input_t& input)
                         if (opp_of_next_of_opp_of_cur_he_is_border) { // found!
                             next_cs_border_he = next_of_opp_of_cur_he;
                             next_cs_border_he_idx = next_of_opp_of_cur_he_idx;
-                            next_cs_border_he_poly_find_iter = opp_of_cur_he_poly_iter;
+                            next_cs_border_he_poly_idx = opp_of_cur_he_poly_idx;
                         } // else if (opp_of_next_of_opp_of_cur_he_is_border) {
 
                         // this is an edge-case:
@@ -8273,9 +8204,9 @@ void dispatch(output_t& output, const input_t& input)
 
                             const int& poly_idx = SAFE_ACCESS(m0_h_to_ply, opp_of_next_of_opp_of_cur_he).front(); // NOTE: class-2 or class-1 ihalfedges are incident to only one polygon
                             //
-                            next_he_poly_iter = m0_polygons.cbegin() + (poly_idx);
-                            MCUT_ASSERT(next_he_poly_iter != m0_polygons.cend());
-                            const traced_polygon_t& poly = *next_he_poly_iter;
+                            next_he_poly_idx = poly_idx;
+                            MCUT_ASSERT(next_he_poly_idx < (int)m0_polygons.size());
+                            const traced_polygon_t poly = m0_polygons[next_he_poly_idx];
                             const traced_polygon_t::const_iterator he_find_iter = std::find(poly.cbegin(), poly.cend(), opp_of_next_of_opp_of_cur_he);
                             MCUT_ASSERT(he_find_iter != poly.cend());
                             const int idx = (int)std::distance(poly.cbegin(), he_find_iter);
@@ -8544,6 +8475,8 @@ void dispatch(output_t& output, const input_t& input)
             // number of polygons in the ccw patch
             const int initial_patch_size = (int)patch.size();
 
+            std::vector<hd_t> cw_poly; // reused by each polygon
+
             // for each polygon in the ccw patch
             for (int ccw_patch_iter = 0; ccw_patch_iter < initial_patch_size; ++ccw_patch_iter) {
 
@@ -8555,7 +8488,8 @@ void dispatch(output_t& output, const input_t& input)
                 int cw_poly_idx = (int)m0_polygons.size();
 
                 // get the normal polygon
-                const traced_polygon_t& patch_poly = SAFE_ACCESS(m0_polygons, ccw_patch_poly_idx);
+                // NOTE: this is invalidated when the reversed polygon is added to "m0_polygons"
+                const traced_polygon_t patch_poly = m0_polygons[ccw_patch_poly_idx];
 #if 0
                     const bool is_floating_patch = SAFE_ACCESS(patch_to_floating_flag, patch_idx);
 
@@ -8594,8 +8528,7 @@ void dispatch(output_t& output, const input_t& input)
                     // connectivity in reverse order
                     //
 
-                    traced_polygon_t cw_poly;
-                    traced_polygon_t tmp;
+                    cw_poly.clear();
 
                     // for each halfedge of the ccw polygon
                     for (traced_polygon_t::const_iterator patch_poly_he_iter = patch_poly.cbegin();
@@ -8607,7 +8540,7 @@ void dispatch(output_t& output, const input_t& input)
                         // get the opposite halfedge
                         const hd_t patch_poly_he_opp = m0.opposite(patch_poly_he);
                         // add into list defining reversed polygon
-                        tmp.push_back(patch_poly_he_opp);
+                        cw_poly.push_back(patch_poly_he_opp);
                         // check if another cut-mesh polygon is traced with this opposite halfedge.
                         std::vector<std::vector<int>>::iterator find_iter = m0_h_to_ply.begin() + patch_poly_he_opp; // m0_h_to_ply.find(patch_poly_he_opp);
 #if 0
@@ -8629,22 +8562,14 @@ void dispatch(output_t& output, const input_t& input)
                         find_iter->push_back(cw_poly_idx);
                     }
 
-                    MCUT_ASSERT(tmp.size() == patch_poly.size());
-
-                    // reverse the order to ensure correct winding, last halfedge for goes to beginning, and so on...
-                    for (int h = 0; h < (int)tmp.size(); ++h) {
-                        const int index = (int)tmp.size() - 1 - h;
-                        cw_poly.push_back(SAFE_ACCESS(tmp, index));
-                    }
+                    MCUT_ASSERT(cw_poly.size() == patch_poly.size());
 
-                    {
-                        for (traced_polygon_t::const_iterator cw_poly_he_iter = cw_poly.cbegin(); cw_poly_he_iter != cw_poly.cend(); ++cw_poly_he_iter) {
-                        }
-                    }
+                    m0_polygons.push_back(cw_poly); // save the new polygon!
 
-                    MCUT_ASSERT(m0.source(cw_poly.front()) == m0.target(cw_poly.back())); // must form loop
+                    // reverse the order to ensure correct winding, last halfedge for goes to beginning, and so on...
+                    m0_polygons.reverse(cw_poly_idx);
 
-                    m0_polygons.push_back(cw_poly); // save the new polygon!
+                    MCUT_ASSERT(m0.source(m0_polygons[cw_poly_idx].front()) == m0.target(m0_polygons[cw_poly_idx].back())); // must form loop
                 }
 
                 // the new polygon's index as being part of the patch
@@ -9051,7 +8976,7 @@ void dispatch(output_t& output, const input_t& input)
 
     std::map<
         char, // color tag
-        std::vector<traced_polygon_t> // traced polygons in colored "m1" mesh
+        traced_polygons_t // traced polygons in colored "m1" mesh
         >
         color_to_m1_polygons;
 
@@ -9135,13 +9060,13 @@ void dispatch(output_t& output, const input_t& input)
         // copy all of the "m1_polygons" that were created before we got to the stitching stage
         // Note: Before stitching has began, "m1_polygons" contains only source-mesh polygons,
         // which have been partition to allow separation of unsealed connected components
-        std::pair<std::map<char, std::vector<traced_polygon_t>>::iterator, bool> color_to_m1_polygons_insertion = color_to_m1_polygons.insert(std::make_pair(color_id, m1_polygons)); // copy!
+        std::pair<std::map<char, traced_polygons_t>::iterator, bool> color_to_m1_polygons_insertion = color_to_m1_polygons.insert(std::make_pair(color_id, m1_polygons)); // copy!
 
         MCUT_ASSERT(color_to_m1_polygons_insertion.second == true);
 
         // ref to "m1_polygons" i.e. the source-mesh polygons with partitioning
-        std::vector<traced_polygon_t>& m1_polygons_colored = color_to_m1_polygons_insertion.first->second;
-        m1_polygons_colored.reserve(m1_polygons_colored.size() + cs_face_count);
+        traced_polygons_t& m1_polygons_colored = color_to_m1_polygons_insertion.first->second;
+        m1_polygons_colored.reserve(m1_polygons_colored.size() + cs_face_count, m1_polygons_colored.number_of_halfedges() + cs_face_count * 3);
 
         // reference to the list connected components (see declaration for details)
         std::map<std::size_t, std::vector<std::pair<hmesh_t, connected_component_info_t>>>& separated_stitching_CCs = color_to_separated_connected_ccsponents[color_id]; // insert
@@ -9274,6 +9199,9 @@ void dispatch(output_t& output, const input_t& input)
             // we process halfedges of the current polygon so that they reference the
             // correct vertex descriptors (src and tgt) in order to fill holes.
             //
+
+            std::vector<hd_t> m1_poly; // stitched/"m1" version of the current polygon (reused by each polygon)
+
             do {
 
                 // the first processed/stitched of halfedge the current polygon (our starting point)
@@ -9303,14 +9231,13 @@ void dispatch(output_t& output, const input_t& input)
                 const hd_t& m0_cur_patch_cur_poly_1st_he = SAFE_ACCESS(m0_cur_patch_cur_poly, m0_cur_patch_cur_poly_1st_he_idx);
 
                 // the processed/stitched version of the current polygon
-                m1_polygons_colored.emplace_back(traced_polygon_t());
-                traced_polygon_t& m1_poly = m1_polygons_colored.back(); // stitched/"m1" version of polygon
-                m1_poly.reserve(m0_cur_patch_cur_poly.size());
+                // NOTE: this is added to "m1_polygons_colored" once all of its halfedges have been transformed
+                m1_poly.clear();
                 m1_poly.push_back(m1_cur_patch_cur_poly_1st_he);
 
                 // save mapping
                 MCUT_ASSERT(m0_to_m1_face_colored.count(m0_cur_patch_cur_poly_idx) == 0);
-                const int m1_cur_patch_cur_poly_idx = (int)(m1_polygons_colored.size() - 1);
+                const int m1_cur_patch_cur_poly_idx = (int)m1_polygons_colored.size();
                 m0_to_m1_face_colored[m0_cur_patch_cur_poly_idx] = m1_cur_patch_cur_poly_idx;
                 MCUT_ASSERT(m1_to_m0_face_colored.count(m1_cur_patch_cur_poly_idx) == 0);
                 m1_to_m0_face_colored[m1_cur_patch_cur_poly_idx] = m0_cur_patch_cur_poly_idx;
@@ -9497,10 +9424,8 @@ void dispatch(output_t& output, const input_t& input)
                             MCUT_ASSERT(m0_next_cs_polygon_he_index < (int)m0_cur_patch_cur_poly.size());
 
                             const hd_t m0_cs_next_patch_polygon_he = SAFE_ACCESS(m0_cur_patch_cur_poly, m0_next_cs_polygon_he_index); // next untransformed
-                            const vd_t m0_cs_next_patch_polygon_he_src = m0.source(m0_cs_next_patch_polygon_he);
-                            const vd_t m0_cs_next_patch_polygon_he_tgt = m0.target(m0_cs_next_patch_polygon_he);
 
-                            MCUT_ASSERT(m0_is_intersection_point(m0_cs_next_patch_polygon_he_src, ps_vtx_cnt) && m0_is_intersection_point(m0_cs_next_patch_polygon_he_tgt, ps_vtx_cnt)); // .. because the current halfedge is "incoming"
+                            MCUT_ASSERT(m0_is_intersection_point(m0.source(m0_cs_next_patch_polygon_he), ps_vtx_cnt) && m0_is_intersection_point(m0.target(m0_cs_next_patch_polygon_he), ps_vtx_cnt)); // .. because the current halfedge is "incoming"
 
                             // get the "m0" polygons which are traced with the "next" halfedge
                             // const std::vector<int>& m0_poly_he_coincident_polys = SAFE_ACCESS(m0_h_to_ply, m0_cs_next_patch_polygon_he);
@@ -9582,10 +9507,8 @@ void dispatch(output_t& output, const input_t& input)
                             MCUT_ASSERT(m0_next_cs_polygon_he_index < (int)m0_cur_patch_cur_poly.size());
 
                             const hd_t m0_cs_next_patch_polygon_he = m0_cur_patch_cur_poly[m0_next_cs_polygon_he_index]; // next untransformed
-                            const vd_t m0_cs_next_patch_polygon_he_src = m0.source(m0_cs_next_patch_polygon_he);
-                            const vd_t m0_cs_next_patch_polygon_he_tgt = m0.target(m0_cs_next_patch_polygon_he);
 
-                            MCUT_ASSERT(m0_is_intersection_point(m0_cs_next_patch_polygon_he_src, ps_vtx_cnt) && m0_is_intersection_point(m0_cs_next_patch_polygon_he_tgt, ps_vtx_cnt));
+                            MCUT_ASSERT(m0_is_intersection_point(m0.source(m0_cs_next_patch_polygon_he), ps_vtx_cnt) && m0_is_intersection_point(m0.target(m0_cs_next_patch_polygon_he), ps_vtx_cnt));
                             MCUT_ASSERT(SAFE_ACCESS(m0_h_to_ply, m0_cs_next_patch_polygon_he).size() > 0 /*m0_h_to_ply.find(m0_cs_next_patch_polygon_he) != m0_h_to_ply.cend()*/);
 
 #ifndef NDEBUG
@@ -9738,7 +9661,6 @@ void dispatch(output_t& output, const input_t& input)
                                                 // What we are going to try to do now is check if the opposite of "m0_incoming_halfedge" has been transformed (w.r.t the current patch),
                                                 // and if so, we get it transformed instanced from which we deduce the correct value of "m1_cs_cur_patch_polygon_he_tgt"
 
-                                                const halfedge_descriptor_t m0_incoming_halfedge_opp = m0.opposite(m0_incoming_halfedge);
                                                 m0_to_m1_he_instances_find_iter = m0_to_m1_he_instances.find(m0_incoming_halfedge);
                                                 hd_t m1_incoming_halfedge_opp = hmesh_t::null_halfedge();
 
@@ -9860,6 +9782,8 @@ void dispatch(output_t& output, const input_t& input)
                 // at this stage, all halfedges of the current polygon have been transformed
                 //
 
+                m1_polygons_colored.push_back(m1_poly);
+
                 // ... remove the stitching-initialiation data of current polygon.
                 patch_poly_stitching_queue.pop_front();
 
@@ -10133,10 +10057,12 @@ void dispatch(output_t& output, const input_t& input)
                     extract_connected_components(
 #if defined(MCUT_MULTI_THREADED)
                         *input.scheduler,
+                        input.serial_execution_threshold,
 #endif
                         separated_stitching_CCs,
                         m1_colored,
                         0,
+                        (int)m1_polygons_colored.size(),
                         m1_polygons_colored,
                         sm_polygons_below_cs,
                         sm_polygons_above_cs,
@@ -10215,7 +10141,7 @@ void dispatch(output_t& output, const input_t& input)
 
             const hmesh_t& m1_colored = SAFE_ACCESS(color_to_m1, color_label);
             MCUT_ASSERT(color_to_m1_polygons.count(color_label) == 1);
-            const std::vector<traced_polygon_t>& m1_polygons_colored = SAFE_ACCESS(color_to_m1_polygons, color_label);
+            const traced_polygons_t& m1_polygons_colored = SAFE_ACCESS(color_to_m1_polygons, color_label);
             MCUT_ASSERT(color_to_m1_to_m0_sm_ovtx.count(color_label) == 1);
             const std::vector<vd_t>& m1_to_m0_sm_ovtx_colored = SAFE_ACCESS(color_to_m1_to_m0_sm_ovtx, color_label);
 
@@ -10228,10 +10154,12 @@ void dispatch(output_t& output, const input_t& input)
             extract_connected_components(
 #if defined(MCUT_MULTI_THREADED)
                 *input.scheduler,
+                input.serial_execution_threshold,
 #endif
                 separated_sealed_CCs,
                 m1_colored,
                 0,
+                (int)m1_polygons_colored.size(),
                 m1_polygons_colored,
                 sm_polygons_below_cs,
                 sm_polygons_above_cs,
@@ -10318,3 +10246,440 @@ void dispatch(output_t& output, const input_t& input)
 
     return;
 } // dispatch
+
+// map a vertex or face descriptor of the polygon soup of the region of interest (see: dispatch_region_of_interest)
+// to that of the polygon soup of the whole source mesh
+template <typename D>
+D region_to_ps_descriptor(const D& d, const std::vector<D>& region_to_sm, const uint32_t sm_count)
+{
+    if (!d.is_valid()) {
+        return d; // e.g. an intersection point
+    }
+
+    const uint32_t region_count = (uint32_t)region_to_sm.size();
+
+    return ((uint32_t)d < region_count) ? SAFE_ACCESS(region_to_sm, d) : D((uint32_t)d - region_count + sm_count);
+}
+
+//
+// The region of interest comprises the source-mesh faces that may intersect the cut mesh ("core" faces) and the faces
+// that share a vertex with them ("border" faces), which are not cut. The remaining faces form blocks (of faces connected
+// by edges) and each one of them must be adjacent to only one connected part of the border. A block is then part of
+// the same output mesh as its border part, to which it is copied after the region has been dispatched.
+//
+bool dispatch_region_of_interest(output_t& output, const input_t& input)
+{
+#if !defined(USE_OIBVH)
+    // the kernel would need a BVH of the region (for the bounding boxes of its faces)
+    (void)output;
+    (void)input;
+    return false;
+#else
+    const hmesh_t& sm = *input.src_mesh;
+    const uint32_t sm_vtx_cnt = (uint32_t)sm.number_of_vertices();
+    const uint32_t sm_face_count = (uint32_t)sm.number_of_faces();
+    const candidate_face_pairs_t& ps_face_to_potentially_intersecting_others = *input.ps_face_to_potentially_intersecting_others;
+    const std::vector<fd_t>& ps_ifaces = ps_face_to_potentially_intersecting_others.faces();
+
+    // NOTE: the faces are sorted, so the source-mesh faces come first
+    const std::vector<fd_t>::const_iterator core_faces_end = std::lower_bound(ps_ifaces.cbegin(), ps_ifaces.cend(), fd_t(sm_face_count));
+
+    if (core_faces_end == ps_ifaces.cbegin()) {
+        return false; // no intersection
+    }
+
+    TIMESTACK_PUSH("Find region of interest");
+
+    enum face_class_t : uint8_t {
+        OUTSIDE_REGION,
+        REGION_BORDER,
+        REGION_CORE
+    };
+
+    std::vector<uint8_t> face_class(sm_face_count, OUTSIDE_REGION);
+    uint32_t region_face_count = 0;
+
+    for (std::vector<fd_t>::const_iterator i = ps_ifaces.cbegin(); i != core_faces_end; ++i) {
+        face_class[*i] = REGION_CORE;
+        region_face_count++;
+    }
+
+    for (std::vector<fd_t>::const_iterator i = ps_ifaces.cbegin(); i != core_faces_end; ++i) {
+        const std::vector<hd_t>& halfedges_around_face = sm.get_halfedges_around_face(*i);
+
+        for (std::vector<hd_t>::const_iterator h = halfedges_around_face.cbegin(); h != halfedges_around_face.cend(); ++h) {
+            const std::vector<hd_t>& incoming_halfedges = sm.get_halfedges_around_vertex(sm.target(*h));
+
+            for (std::vector<hd_t>::const_iterator j = incoming_halfedges.cbegin(); j != incoming_halfedges.cend(); ++j) {
+                const fd_t f = sm.face(*j);
+
+                if (f != hmesh_t::null_face() && face_class[f] == OUTSIDE_REGION) {
+                    face_class[f] = REGION_BORDER;
+                    region_face_count++;
+                }
+            }
+        }
+    }
+
+    if (region_face_count * 2 > sm_face_count) {
+        TIMESTACK_POP();
+        return false; // not worth it
+    }
+
+    // the connected part of the border of each border face, and the block of each face outside the region
+    std::vector<int> face_to_group(sm_face_count, -1);
+    std::vector<fd_t> stack;
+    int num_border_parts = 0;
+
+    for (uint32_t i = 0; i < sm_face_count; ++i) {
+        if (face_class[i] != REGION_BORDER || face_to_group[i] != -1) {
+            continue;
+        }
+
+        face_to_group[i] = num_border_parts;
+        stack.push_back(fd_t(i));
+
+        while (!stack.empty()) {
+            const std::vector<hd_t>& halfedges_around_face = sm.get_halfedges_around_face(stack.back());
+            stack.pop_back();
+
+            for (std::vector<hd_t>::const_iterator h = halfedges_around_face.cbegin(); h != halfedges_around_face.cend(); ++h) {
+                const fd_t f = sm.face(sm.opposite(*h));
+
+                if (f != hmesh_t::null_face() && face_class[f] == REGION_BORDER && face_to_group[f] == -1) {
+                    face_to_group[f] = num_border_parts;
+                    stack.push_back(f);
+                }
+            }
+        }
+
+        num_border_parts++;
+    }
+
+    // the faces of the blocks that are adjacent to each border part
+    std::vector<std::vector<fd_t>> border_part_to_outside_faces(num_border_parts);
+    std::vector<fd_t> block_faces;
+
+    for (uint32_t i = 0; i < sm_face_count; ++i) {
+        if (face_class[i] != OUTSIDE_REGION || face_to_group[i] != -1) {
+            continue;
+        }
+
+        int block_border_part = -1;
+        block_faces.clear();
+        face_to_group[i] = 0; // i.e. visited
+        stack.push_back(fd_t(i));
+
+        while (!stack.empty()) {
+            const fd_t block_face = stack.back();
+            stack.pop_back();
+            block_faces.push_back(block_face);
+
+            const std::vector<hd_t>& halfedges_around_face = sm.get_halfedges_around_face(block_face);
+
+            for (std::vector<hd_t>::const_iterator h = halfedges_around_face.cbegin(); h != halfedges_around_face.cend(); ++h) {
+                const fd_t f = sm.face(sm.opposite(*h));
+
+                if (f == hmesh_t::null_face()) {
+                    continue;
+                }
+
+                if (face_class[f] == OUTSIDE_REGION) {
+                    if (face_to_group[f] == -1) {
+                        face_to_group[f] = 0;
+                        stack.push_back(f);
+                    }
+                    continue;
+                }
+
+                MCUT_ASSERT(face_class[f] == REGION_BORDER); // ... since a core face shares no vertex with the block
+
+                if (block_border_part == -1) {
+                    block_border_part = face_to_group[f];
+                } else if (block_border_part != face_to_group[f]) {
+                    // the cut may or may not separate the border parts (i.e. the fragment of the block is unknown)
+                    TIMESTACK_POP();
+                    return false;
+                }
+            }
+        }
+
+        if (block_border_part == -1) {
+            // e.g. a connected component of the source mesh that is nowhere near the cut mesh
+            TIMESTACK_POP();
+            return false;
+        }
+
+        std::vector<fd_t>& outside_faces = border_part_to_outside_faces[block_border_part];
+        outside_faces.insert(outside_faces.end(), block_faces.cbegin(), block_faces.cend());
+    }
+
+    for (int i = 0; i < num_border_parts; ++i) {
+        std::sort(border_part_to_outside_faces[i].begin(), border_part_to_outside_faces[i].end()); // i.e. original order
+    }
+
+    if (input.keep_srcmesh_seam) {
+        // the kernel assumes that the source mesh is connected when it extracts the seam
+        std::vector<bool> region_face_visited(sm_face_count, false);
+        const fd_t first_region_face = ps_ifaces.front();
+        uint32_t num_visited_region_faces = 1;
+
+        region_face_visited[first_region_face] = true;
+        stack.push_back(first_region_face);
+
+        while (!stack.empty()) {
+            const std::vector<hd_t>& halfedges_around_face = sm.get_halfedges_around_face(stack.back());
+            stack.pop_back();
+
+            for (std::vector<hd_t>::const_iterator h = halfedges_around_face.cbegin(); h != halfedges_around_face.cend(); ++h) {
+                const fd_t f = sm.face(sm.opposite(*h));
+
+                if (f != hmesh_t::null_face() && face_class[f] != OUTSIDE_REGION && !region_face_visited[f]) {
+                    region_face_visited[f] = true;
+                    num_visited_region_faces++;
+                    stack.push_back(f);
+                }
+            }
+        }
+
+        if (num_visited_region_faces != region_face_count) {
+            TIMESTACK_POP();
+            return false;
+        }
+    }
+
+    TIMESTACK_POP();
+
+    TIMESTACK_PUSH("Create region of interest");
+
+    std::vector<bool> is_region_vertex(sm_vtx_cnt, false);
+
+    for (uint32_t i = 0; i < sm_face_count; ++i) {
+        if (face_class[i] == OUTSIDE_REGION) {
+            continue;
+        }
+
+        const std::vector<hd_t>& halfedges_around_face = sm.get_halfedges_around_face(fd_t(i));
+
+        for (std::vector<hd_t>::const_iterator h = halfedges_around_face.cbegin(); h != halfedges_around_face.cend(); ++h) {
+            is_region_vertex[sm.target(*h)] = true;
+        }
+    }
+
+    // NOTE: vertices and faces keep their relative order
+    hmesh_t region;
+    std::vector<vd_t> sm_to_region_vtx(sm_vtx_cnt);
+    std::vector<vd_t> region_to_sm_vtx;
+    std::vector<fd_t> sm_to_region_face(sm_face_count);
+    std::vector<fd_t> region_to_sm_face;
+
+    for (uint32_t i = 0; i < sm_vtx_cnt; ++i) {
+        if (is_region_vertex[i]) {
+            sm_to_region_vtx[i] = region.add_vertex(sm.vertex(vd_t(i)));
+            region_to_sm_vtx.push_back(vd_t(i));
+        }
+    }
+
+    region_to_sm_face.reserve(region_face_count);
+    std::vector<vd_t> face_vertices;
+
+    for (uint32_t i = 0; i < sm_face_count; ++i) {
+        if (face_class[i] == OUTSIDE_REGION) {
+            continue;
+        }
+
+        const std::vector<hd_t>& halfedges_around_face = sm.get_halfedges_around_face(fd_t(i));
+        face_vertices.clear();
+
+        // NOTE: the sources, so that the face has the same (first) halfedge as in "sm"
+        for (std::vector<hd_t>::const_iterator h = halfedges_around_face.cbegin(); h != halfedges_around_face.cend(); ++h) {
+            face_vertices.push_back(sm_to_region_vtx[sm.source(*h)]);
+        }
+
+        sm_to_region_face[i] = region.add_face(face_vertices);
+        MCUT_ASSERT(sm_to_region_face[i] != hmesh_t::null_face());
+        region_to_sm_face.push_back(fd_t(i));
+    }
+
+    std::vector<bounding_box_t<vec3>> region_face_aabb_array(region_face_count);
+
+    for (uint32_t i = 0; i < region_face_count; ++i) {
+        region_face_aabb_array[i] = SAFE_ACCESS((*input.source_hmesh_face_aabb_array_ptr), region_to_sm_face[i]);
+    }
+
+    // the (source-mesh face, cut-mesh face) pairs, where the faces are those of the region's polygon soup
+    std::vector<std::pair<fd_t, fd_t>> region_face_pairs;
+    region_face_pairs.reserve((size_t)ps_face_to_potentially_intersecting_others.number_of_pairs());
+
+    for (std::vector<fd_t>::const_iterator i = ps_ifaces.cbegin(); i != core_faces_end; ++i) {
+        for (std::vector<fd_t>::const_iterator j = ps_face_to_potentially_intersecting_others.others_begin(*i); j != ps_face_to_potentially_intersecting_others.others_end(*i); ++j) {
+            MCUT_ASSERT((uint32_t)*j >= sm_face_count);
+            region_face_pairs.push_back(std::make_pair(sm_to_region_face[*i], fd_t((uint32_t)*j - sm_face_count + region_face_count)));
+        }
+    }
+
+#if defined(MCUT_MULTI_THREADED)
+    const block_executor_t for_each_block(*input.scheduler, input.serial_execution_threshold);
+#else
+    const block_executor_t for_each_block;
+#endif
+
+    candidate_face_pairs_t region_ps_face_to_potentially_intersecting_others;
+    region_ps_face_to_potentially_intersecting_others.build(
+        for_each_block,
+        ps_face_to_potentially_intersecting_others.number_of_faces() - sm_face_count + region_face_count,
+        region_face_pairs);
+
+    TIMESTACK_POP();
+
+    input_t region_input = input;
+    region_input.src_mesh = &region;
+    region_input.ps_face_to_potentially_intersecting_others = &region_ps_face_to_potentially_intersecting_others;
+    region_input.source_hmesh_face_aabb_array_ptr = &region_face_aabb_array;
+    region_input.region_of_interest = false;
+    region_input.src_mesh_is_region_of_interest = true;
+    region_input.src_mesh_parent_is_closed = input.mesh_closedness_is_known ? input.src_mesh_is_closed : mesh_is_closed(sm);
+    // ... which tell us where to reattach the faces outside the region
+    region_input.populate_vertex_maps = true;
+    region_input.populate_face_maps = true;
+
+    dispatch(output, region_input);
+
+#if defined(MCUT_MULTI_THREADED)
+    const status_t status = output.status.load();
+#else
+    const status_t status = output.status;
+#endif
+
+    if (status == status_t::DETECTED_FLOATING_POLYGON) {
+        std::map<fd_t, std::vector<floating_polygon_info_t>> detected_floating_polygons;
+
+        for (std::map<fd_t, std::vector<floating_polygon_info_t>>::iterator i = output.detected_floating_polygons.begin(); i != output.detected_floating_polygons.end(); ++i) {
+            detected_floating_polygons[region_to_ps_descriptor(i->first, region_to_sm_face, sm_face_count)] = std::move(i->second);
+        }
+
+        output.detected_floating_polygons.swap(detected_floating_polygons);
+    }
+
+    if (status != status_t::SUCCESS) {
+        return true;
+    }
+
+    TIMESTACK_PUSH("Reattach faces outside region of interest");
+
+    // map the descriptors of an output mesh to those of the whole source mesh, and add the outside faces that are
+    // adjacent to its border faces
+    auto finalize_output_mesh = [&](output_mesh_info_t& omi) -> bool {
+        std::vector<vd_t>& vertex_map = omi.data_maps.vertex_map;
+        std::vector<fd_t>& face_map = omi.data_maps.face_map;
+        std::vector<bool> border_part_in_mesh(num_border_parts, false);
+
+        for (uint32_t i = 0; i < (uint32_t)face_map.size(); ++i) {
+            const fd_t f = region_to_ps_descriptor(face_map[i], region_to_sm_face, sm_face_count);
+
+            if ((uint32_t)f < sm_face_count && face_class[f] == REGION_BORDER) {
+                border_part_in_mesh[face_to_group[f]] = true;
+            }
+
+            face_map[i] = f;
+        }
+
+        std::unordered_map<vd_t, vd_t> sm_to_mesh_vtx;
+
+        for (uint32_t i = 0; i < (uint32_t)vertex_map.size(); ++i) {
+            const vd_t v = region_to_ps_descriptor(vertex_map[i], region_to_sm_vtx, sm_vtx_cnt);
+
+            if (v != hmesh_t::null_vertex() && (uint32_t)v < sm_vtx_cnt) {
+                sm_to_mesh_vtx.insert(std::make_pair(v, vd_t(i)));
+            }
+
+            vertex_map[i] = v;
+        }
+
+        for (int i = 0; i < num_border_parts; ++i) {
+            if (!border_part_in_mesh[i]) {
+                continue;
+            }
+
+            const std::vector<fd_t>& outside_faces = border_part_to_outside_faces[i];
+
+            for (std::vector<fd_t>::const_iterator f = outside_faces.cbegin(); f != outside_faces.cend(); ++f) {
+                const std::vector<hd_t>& halfedges_around_face = sm.get_halfedges_around_face(*f);
+                face_vertices.clear();
+
+                for (std::vector<hd_t>::const_iterator h = halfedges_around_face.cbegin(); h != halfedges_around_face.cend(); ++h) {
+                    const vd_t sm_vertex = sm.source(*h);
+                    std::unordered_map<vd_t, vd_t>::const_iterator fiter = sm_to_mesh_vtx.find(sm_vertex);
+
+                    if (fiter == sm_to_mesh_vtx.cend()) {
+                        const vd_t v = omi.mesh.add_vertex(sm.vertex(sm_vertex));
+                        vertex_map.push_back(sm_vertex);
+                        fiter = sm_to_mesh_vtx.insert(std::make_pair(sm_vertex, v)).first;
+                    }
+
+                    face_vertices.push_back(fiter->second);
+                }
+
+                if (omi.mesh.add_face(face_vertices) == hmesh_t::null_face()) {
+                    return false;
+                }
+
+                face_map.push_back(*f);
+            }
+        }
+
+        if (!input.populate_vertex_maps) {
+            std::vector<vd_t>().swap(vertex_map);
+        }
+
+        if (!input.populate_face_maps) {
+            std::vector<fd_t>().swap(face_map);
+        }
+
+        return true;
+    };
+
+    bool reattached = finalize_output_mesh(output.seamed_src_mesh) && finalize_output_mesh(output.seamed_cut_mesh);
+
+    for (std::map<sm_frag_location_t, std::map<cm_patch_location_t, std::vector<output_mesh_info_t>>>::iterator i = output.connected_components.begin(); i != output.connected_components.end(); ++i) {
+        for (std::map<cm_patch_location_t, std::vector<output_mesh_info_t>>::iterator j = i->second.begin(); j != i->second.end(); ++j) {
+            for (std::vector<output_mesh_info_t>::iterator k = j->second.begin(); reattached && k != j->second.end(); ++k) {
+                reattached = finalize_output_mesh(*k);
+            }
+        }
+    }
+
+    for (std::map<sm_frag_location_t, std::vector<output_mesh_info_t>>::iterator i = output.unsealed_cc.begin(); i != output.unsealed_cc.end(); ++i) {
+        for (std::vector<output_mesh_info_t>::iterator k = i->second.begin(); reattached && k != i->second.end(); ++k) {
+            reattached = finalize_output_mesh(*k);
+        }
+    }
+
+    for (std::map<cm_patch_winding_order_t, std::vector<output_mesh_info_t>>::iterator i = output.inside_patches.begin(); i != output.inside_patches.end(); ++i) {
+        for (std::vector<output_mesh_info_t>::iterator k = i->second.begin(); reattached && k != i->second.end(); ++k) {
+            reattached = finalize_output_mesh(*k);
+        }
+    }
+
+    for (std::map<cm_patch_winding_order_t, std::vector<output_mesh_info_t>>::iterator i = output.outside_patches.begin(); i != output.outside_patches.end(); ++i) {
+        for (std::vector<output_mesh_info_t>::iterator k = i->second.begin(); reattached && k != i->second.end(); ++k) {
+            reattached = finalize_output_mesh(*k);
+        }
+    }
+
+    TIMESTACK_POP();
+
+    if (!reattached) {
+        // i.e. the faces of a block would make an output mesh non-manifold
+        output.connected_components.clear();
+        output.unsealed_cc.clear();
+        output.inside_patches.clear();
+        output.outside_patches.clear();
+        output.seamed_src_mesh = output_mesh_info_t();
+        output.seamed_cut_mesh = output_mesh_info_t();
+        return false;
+    }
+
+    return true;
+#endif // #if !defined(USE_OIBVH)
+}
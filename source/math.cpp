@@ -25,6 +25,17 @@
 #include <cstdlib>
 #include <tuple> // std::make_tuple std::get<>
 
+#if defined(__AVX__)
+#include <immintrin.h>
+#define MCUT_ORIENT3D_AVX 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define MCUT_ORIENT3D_SSE2 1
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define MCUT_ORIENT3D_NEON 1
+#endif
+
 
     double square_root(const double& number)
     {
@@ -110,6 +121,149 @@
         return ::orient3d(pa_, pb_, pc_, pd_); // shewchuk predicate
     }
 
+namespace {
+    // the error bound of the floating-point stage of "orient3d" relative to its permanent (see: "o3derrboundA" in
+    // shewchuk.c)
+    const double orient3d_error_bound_a = 7.7715611723761027e-16;
+
+    // SIMD lanes that are used to evaluate the floating-point stage of "orient3d" for several point quadruples at once
+#if defined(MCUT_ORIENT3D_AVX)
+    typedef __m256d orient3d_lanes_t;
+    const int orient3d_lane_count = 4;
+
+    inline orient3d_lanes_t lanes_load(const double* p) { return _mm256_loadu_pd(p); }
+    inline orient3d_lanes_t lanes_set(const double& x) { return _mm256_set1_pd(x); }
+    inline void lanes_store(double* p, const orient3d_lanes_t& a) { _mm256_storeu_pd(p, a); }
+    inline orient3d_lanes_t lanes_add(const orient3d_lanes_t& a, const orient3d_lanes_t& b) { return _mm256_add_pd(a, b); }
+    inline orient3d_lanes_t lanes_sub(const orient3d_lanes_t& a, const orient3d_lanes_t& b) { return _mm256_sub_pd(a, b); }
+    inline orient3d_lanes_t lanes_mul(const orient3d_lanes_t& a, const orient3d_lanes_t& b) { return _mm256_mul_pd(a, b); }
+    inline orient3d_lanes_t lanes_abs(const orient3d_lanes_t& a) { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a); }
+    inline uint32_t lanes_greater_mask(const orient3d_lanes_t& a, const orient3d_lanes_t& b) { return (uint32_t)_mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_GT_OQ)); }
+#elif defined(MCUT_ORIENT3D_SSE2)
+    typedef __m128d orient3d_lanes_t;
+    const int orient3d_lane_count = 2;
+
+    inline orient3d_lanes_t lanes_load(const double* p) { return _mm_loadu_pd(p); }
+    inline orient3d_lanes_t lanes_set(const double& x) { return _mm_set1_pd(x); }
+    inline void lanes_store(double* p, const orient3d_lanes_t& a) { _mm_storeu_pd(p, a); }
+    inline orient3d_lanes_t lanes_add(const orient3d_lanes_t& a, const orient3d_lanes_t& b) { return _mm_add_pd(a, b); }
+    inline orient3d_lanes_t lanes_sub(const orient3d_lanes_t& a, const orient3d_lanes_t& b) { return _mm_sub_pd(a, b); }
+    inline orient3d_lanes_t lanes_mul(const orient3d_lanes_t& a, const orient3d_lanes_t& b) { return _mm_mul_pd(a, b); }
+    inline orient3d_lanes_t lanes_abs(const orient3d_lanes_t& a) { return _mm_andnot_pd(_mm_set1_pd(-0.0), a); }
+    inline uint32_t lanes_greater_mask(const orient3d_lanes_t& a, const orient3d_lanes_t& b) { return (uint32_t)_mm_movemask_pd(_mm_cmpgt_pd(a, b)); }
+#elif defined(MCUT_ORIENT3D_NEON)
+    typedef float64x2_t orient3d_lanes_t;
+    const int orient3d_lane_count = 2;
+
+    inline orient3d_lanes_t lanes_load(const double* p) { return vld1q_f64(p); }
+    inline orient3d_lanes_t lanes_set(const double& x) { return vdupq_n_f64(x); }
+    inline void lanes_store(double* p, const orient3d_lanes_t& a) { vst1q_f64(p, a); }
+    inline orient3d_lanes_t lanes_add(const orient3d_lanes_t& a, const orient3d_lanes_t& b) { return vaddq_f64(a, b); }
+    inline orient3d_lanes_t lanes_sub(const orient3d_lanes_t& a, const orient3d_lanes_t& b) { return vsubq_f64(a, b); }
+    inline orient3d_lanes_t lanes_mul(const orient3d_lanes_t& a, const orient3d_lanes_t& b) { return vmulq_f64(a, b); }
+    inline orient3d_lanes_t lanes_abs(const orient3d_lanes_t& a) { return vabsq_f64(a); }
+    inline uint32_t lanes_greater_mask(const orient3d_lanes_t& a, const orient3d_lanes_t& b)
+    {
+        const uint64x2_t greater = vcgtq_f64(a, b);
+        return (uint32_t)((vgetq_lane_u64(greater, 0) & 1) | (vgetq_lane_u64(greater, 1) & 2));
+    }
+#else
+    typedef double orient3d_lanes_t;
+    const int orient3d_lane_count = 1;
+
+    inline orient3d_lanes_t lanes_load(const double* p) { return *p; }
+    inline orient3d_lanes_t lanes_set(const double& x) { return x; }
+    inline void lanes_store(double* p, const orient3d_lanes_t& a) { *p = a; }
+    inline orient3d_lanes_t lanes_add(const orient3d_lanes_t& a, const orient3d_lanes_t& b) { return a + b; }
+    inline orient3d_lanes_t lanes_sub(const orient3d_lanes_t& a, const orient3d_lanes_t& b) { return a - b; }
+    inline orient3d_lanes_t lanes_mul(const orient3d_lanes_t& a, const orient3d_lanes_t& b) { return a * b; }
+    inline orient3d_lanes_t lanes_abs(const orient3d_lanes_t& a) { return std::fabs(a); }
+    inline uint32_t lanes_greater_mask(const orient3d_lanes_t& a, const orient3d_lanes_t& b) { return a > b ? 1 : 0; }
+#endif
+
+    // The floating-point stage of "orient3d" for four point quadruples, where "coords[point][axis][i]" is a coordinate
+    // of quadruple "i". Returns a bitmask of the quadruples whose determinant "det[i]" has a certain sign (bit "i" for
+    // quadruple "i").
+    uint32_t orient3d_filter_x4(double det[4], const double coords[4][3][4])
+    {
+        uint32_t certain_mask = 0;
+
+        for (int i = 0; i < 4; i += orient3d_lane_count) {
+            const orient3d_lanes_t pdx = lanes_load(&coords[3][0][i]);
+            const orient3d_lanes_t pdy = lanes_load(&coords[3][1][i]);
+            const orient3d_lanes_t pdz = lanes_load(&coords[3][2][i]);
+
+            const orient3d_lanes_t adx = lanes_sub(lanes_load(&coords[0][0][i]), pdx);
+            const orient3d_lanes_t bdx = lanes_sub(lanes_load(&coords[1][0][i]), pdx);
+            const orient3d_lanes_t cdx = lanes_sub(lanes_load(&coords[2][0][i]), pdx);
+            const orient3d_lanes_t ady = lanes_sub(lanes_load(&coords[0][1][i]), pdy);
+            const orient3d_lanes_t bdy = lanes_sub(lanes_load(&coords[1][1][i]), pdy);
+            const orient3d_lanes_t cdy = lanes_sub(lanes_load(&coords[2][1][i]), pdy);
+            const orient3d_lanes_t adz = lanes_sub(lanes_load(&coords[0][2][i]), pdz);
+            const orient3d_lanes_t bdz = lanes_sub(lanes_load(&coords[1][2][i]), pdz);
+            const orient3d_lanes_t cdz = lanes_sub(lanes_load(&coords[2][2][i]), pdz);
+
+            const orient3d_lanes_t bdxcdy = lanes_mul(bdx, cdy);
+            const orient3d_lanes_t cdxbdy = lanes_mul(cdx, bdy);
+            const orient3d_lanes_t cdxady = lanes_mul(cdx, ady);
+            const orient3d_lanes_t adxcdy = lanes_mul(adx, cdy);
+            const orient3d_lanes_t adxbdy = lanes_mul(adx, bdy);
+            const orient3d_lanes_t bdxady = lanes_mul(bdx, ady);
+
+            const orient3d_lanes_t lanes_det = lanes_add(
+                lanes_add(
+                    lanes_mul(adz, lanes_sub(bdxcdy, cdxbdy)),
+                    lanes_mul(bdz, lanes_sub(cdxady, adxcdy))),
+                lanes_mul(cdz, lanes_sub(adxbdy, bdxady)));
+
+            const orient3d_lanes_t permanent = lanes_add(
+                lanes_add(
+                    lanes_mul(lanes_add(lanes_abs(bdxcdy), lanes_abs(cdxbdy)), lanes_abs(adz)),
+                    lanes_mul(lanes_add(lanes_abs(cdxady), lanes_abs(adxcdy)), lanes_abs(bdz))),
+                lanes_mul(lanes_add(lanes_abs(adxbdy), lanes_abs(bdxady)), lanes_abs(cdz)));
+
+            const orient3d_lanes_t errbound = lanes_mul(lanes_set(orient3d_error_bound_a), permanent);
+
+            certain_mask |= lanes_greater_mask(lanes_abs(lanes_det), errbound) << i;
+            lanes_store(&det[i], lanes_det);
+        }
+
+        return certain_mask;
+    }
+} // namespace
+
+    void orient3d(double* results, const vec3* const* quadruples, const uint32_t count)
+    {
+        double coords[4][3][4];
+        double det[4];
+
+        for (uint32_t first = 0; first < count; first += 4) {
+            const uint32_t group_size = std::min(count - first, (uint32_t)4);
+
+            for (uint32_t i = 0; i < 4; ++i) {
+                // NOTE: the last group is padded with its last quadruple
+                const vec3* const* quadruple = quadruples + (4 * (first + std::min(i, group_size - 1)));
+
+                for (int point = 0; point < 4; ++point) {
+                    for (int axis = 0; axis < 3; ++axis) {
+                        coords[point][axis][i] = static_cast<double>((*quadruple[point])[axis]);
+                    }
+                }
+            }
+
+            const uint32_t certain_mask = orient3d_filter_x4(det, coords);
+
+            for (uint32_t i = 0; i < group_size; ++i) {
+                if (certain_mask & (1u << i)) {
+                    results[first + i] = det[i];
+                } else { // the error bound is exceeded
+                    const vec3* const* quadruple = quadruples + (4 * (first + i));
+                    results[first + i] = orient3d(*quadruple[0], *quadruple[1], *quadruple[2], *quadruple[3]);
+                }
+            }
+        }
+    }
+
 #if 0
     void polygon_normal(vec3& normal, const vec3* vertices, const int num_vertices)
     {
@@ -275,9 +429,14 @@
             }
         }
 
-        double qRes = orient3d(polygon_vertices[i], polygon_vertices[j], polygon_vertices[k], q);
-        double rRes = orient3d(polygon_vertices[i], polygon_vertices[j], polygon_vertices[k], r);
+        const double qRes = orient3d(polygon_vertices[i], polygon_vertices[j], polygon_vertices[k], q);
+        const double rRes = orient3d(polygon_vertices[i], polygon_vertices[j], polygon_vertices[k], r);
+
+        return compute_segment_plane_intersection_type(qRes, rRes);
+    }
 
+    char compute_segment_plane_intersection_type(const double& qRes, const double& rRes)
+    {
         if (qRes == double(0.0) && rRes == double(0.0)) {
             return 'p';
         } else if (qRes == double(0.0)) {
@@ -291,6 +450,121 @@
         }
     }
 
+namespace {
+    // The exact sign of "(a0 - a1) * (b0 - b1) - (c0 - c1) * (d0 - d1)", which is evaluated with the expansion
+    // arithmetic of shewchuk.c (each difference is exactly a two-component expansion)
+    int difference_of_products_sign(double a0, double a1, double b0, double b1, double c0, double c1, double d0, double d1)
+    {
+        double a[2], b[2], c[2], d[2];
+        const int a_len = grow_expansion_zeroelim(1, &a0, -a1, a);
+        const int b_len = grow_expansion_zeroelim(1, &b0, -b1, b);
+        const int c_len = grow_expansion_zeroelim(1, &c0, -c1, c);
+        const int d_len = grow_expansion_zeroelim(1, &d0, -d1, d);
+
+        // "(a0 - a1) * (b0 - b1)" and "-(c0 - c1) * (d0 - d1)" (at most eight components each)
+        double ab[8], cd[8], term[4], sum[8];
+        int ab_len = scale_expansion_zeroelim(a_len, a, b[0], ab);
+        for (int i = 1; i < b_len; ++i) {
+            const int term_len = scale_expansion_zeroelim(a_len, a, b[i], term);
+            ab_len = fast_expansion_sum_zeroelim(ab_len, ab, term_len, term, sum);
+            std::copy(sum, sum + ab_len, ab);
+        }
+        int cd_len = scale_expansion_zeroelim(c_len, c, -d[0], cd);
+        for (int i = 1; i < d_len; ++i) {
+            const int term_len = scale_expansion_zeroelim(c_len, c, -d[i], term);
+            cd_len = fast_expansion_sum_zeroelim(cd_len, cd, term_len, term, sum);
+            std::copy(sum, sum + cd_len, cd);
+        }
+
+        double det[16];
+        const int det_len = fast_expansion_sum_zeroelim(ab_len, ab, cd_len, cd, det);
+        // the largest component of a (nonoverlapping) expansion determines its sign
+        const double& most_significant = det[det_len - 1];
+        return most_significant > 0.0 ? 1 : (most_significant < 0.0 ? -1 : 0);
+    }
+
+    int sign_of(const double& value)
+    {
+        return value > 0.0 ? 1 : (value < 0.0 ? -1 : 0);
+    }
+} // namespace
+
+    int orient3d_symbolic_translation_of_d(const vec3& pa, const vec3& pb, const vec3& pc)
+    {
+        // orient3d(pa, pb, pc, pd + t) = orient3d(pa, pb, pc, pd) - dot(t, cross(pb - pa, pc - pa)), and the components
+        // of the cross product are the (exact) orientations of the points projected onto the yz, zx and xy planes
+        const int axes[3][2] = { { 1, 2 }, { 2, 0 }, { 0, 1 } };
+
+        for (int i = 0; i < 3; ++i) { // the first nonzero term of "dot(t, ...)" dominates the others
+            const vec2 pa_(pa[axes[i][0]], pa[axes[i][1]]);
+            const vec2 pb_(pb[axes[i][0]], pb[axes[i][1]]);
+            const vec2 pc_(pc[axes[i][0]], pc[axes[i][1]]);
+            const int s = sign_of(orient2d(pa_, pb_, pc_));
+
+            if (s != 0) {
+                return -s;
+            }
+        }
+
+        return 0;
+    }
+
+    int orient3d_symbolic_translation_of_ab(const vec3& pa, const vec3& pb, const vec3& pc, const vec3& pd)
+    {
+        // orient3d(pa + t, pb + t, pc, pd) = orient3d(pa, pb, pc, pd) + dot(t, cross(pb - pa, pc - pd))
+        const int axes[3][2] = { { 1, 2 }, { 2, 0 }, { 0, 1 } };
+
+        for (int i = 0; i < 3; ++i) {
+            const int j = axes[i][0];
+            const int k = axes[i][1];
+            const int s = difference_of_products_sign(pb[j], pa[j], pc[k], pd[k], pb[k], pa[k], pc[j], pd[j]);
+
+            if (s != 0) {
+                return s;
+            }
+        }
+
+        return 0;
+    }
+
+    char compute_segment_polygon_crossing_type(const vec3& q, const vec3& r, const std::vector<vec3>& polygon_vertices,
+        const bool translate_segment)
+    {
+        // the sign of "orient3d(q, r, a, b)" once the segment (or the polygon) is translated by (e, e^2, e^3). Looking
+        // along the segment, this is the orientation of "a", "b" and the point where the segment crosses the plane.
+        auto orient = [&](const vec3& a, const vec3& b) {
+            const int s = sign_of(orient3d(q, r, a, b));
+            if (s != 0) {
+                return s;
+            }
+            const int t = orient3d_symbolic_translation_of_ab(q, r, a, b);
+            return translate_segment ? t : -t;
+        };
+
+        // winding number of the polygon around the crossing point (see: "compute_point_in_polygon_test"), where the
+        // ray is cast from the crossing point through the first vertex of the polygon
+        const vec3& origin = polygon_vertices.front();
+        const int polygon_vertex_count = (int)polygon_vertices.size();
+        int winding_number = 0;
+        int side_a = 0; // side of the ray's line that the first vertex is on
+
+        for (int i = 0; i < polygon_vertex_count; ++i) {
+            const vec3& a = polygon_vertices[i];
+            const vec3& b = polygon_vertices[(i + 1) % polygon_vertex_count];
+            const int side_b = (i + 1 == polygon_vertex_count) ? 0 : orient(origin, b);
+
+            if (side_a <= 0 && side_b > 0 && orient(a, b) > 0) { // upward crossing with the crossing point on the left
+                ++winding_number;
+            } else if (side_a > 0 && side_b <= 0 && orient(a, b) < 0) { // downward crossing with the crossing point on the right
+                --winding_number;
+            }
+
+            side_a = side_b;
+        }
+
+        return winding_number != 0 ? 'i' : 'o';
+    }
+
     char compute_segment_line_plane_intersection_type(const vec3& q, const vec3& r,
         const std::vector<vec3>& polygon_vertices,
 
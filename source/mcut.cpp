@@ -26,8 +26,11 @@
 
 #include "mcut/internal/frontend.h"
 
+#include <algorithm>
+#include <cstring>
 #include <exception>
 #include <stdexcept>
+#include <thread>
 
 #if defined(MCUT_BUILD_WINDOWS)
 #pragma warning(disable : 26812)
@@ -73,7 +76,8 @@ MCAPI_ATTR McResult MCAPI_CALL mcCreateContext(McContext* pOutContext, McFlags c
         return_value = McResult::MC_INVALID_VALUE;
     } else {
         try {
-            create_context_impl(pOutContext, contextFlags);
+            // one helper thread per hardware thread
+            create_context_impl(pOutContext, contextFlags, std::max(std::thread::hardware_concurrency(), 1u));
         }
         CATCH_POSSIBLE_EXCEPTIONS(per_thread_api_log_str);
     }
@@ -85,6 +89,33 @@ MCAPI_ATTR McResult MCAPI_CALL mcCreateContext(McContext* pOutContext, McFlags c
     return return_value;
 }
 
+MCAPI_ATTR McResult MCAPI_CALL mcCreateContextWithHelpers(McContext* pOutContext, McFlags contextFlags, uint32_t helperThreadCount)
+{
+    McResult return_value = McResult::MC_NO_ERROR;
+    per_thread_api_log_str.clear();
+
+    if (pOutContext == nullptr) {
+        per_thread_api_log_str = "context ptr undef (NULL)";
+    } else {
+        try {
+            create_context_impl(pOutContext, contextFlags, helperThreadCount);
+        }
+        CATCH_POSSIBLE_EXCEPTIONS(per_thread_api_log_str);
+    }
+
+    if (!per_thread_api_log_str.empty()) {
+
+        std::fprintf(stderr, "%s(...) -> %s\n", __FUNCTION__, per_thread_api_log_str.c_str());
+
+        if (return_value == McResult::MC_NO_ERROR) // i.e. problem with basic local parameter checks
+        {
+            return_value = McResult::MC_INVALID_VALUE;
+        }
+    }
+
+    return return_value;
+}
+
 MCAPI_ATTR McResult MCAPI_CALL mcDebugMessageCallback(McContext pContext, pfn_mcDebugOutput_CALLBACK cb, const void* userParam)
 {
     McResult return_value = McResult::MC_NO_ERROR;
@@ -165,11 +196,17 @@ MCAPI_ATTR McResult MCAPI_CALL mcGetInfo(const McContext context, McFlags info,
         per_thread_api_log_str = "context ptr (param0) undef (NULL)";
     } else if (bytes != 0 && pMem == nullptr) {
         per_thread_api_log_str = "invalid specification (param2 & param3)";
-    } else if (false == (info == MC_CONTEXT_FLAGS)) // check all possible values
+    } else if (false == (info == MC_CONTEXT_FLAGS || info == MC_CONTEXT_SERIAL_EXECUTION_THRESHOLD || info == MC_CONTEXT_HELPER_THREAD_COUNT || info == MC_CONTEXT_DISPATCH_STATS || info == MC_CONTEXT_DISPATCH_STAGE_TIMES || info == MC_CONTEXT_TRACE)) // check all possible values
     {
         per_thread_api_log_str = "invalid info flag val (param1)";
     } else if ((info == MC_CONTEXT_FLAGS) && (pMem != nullptr && bytes != sizeof(McFlags))) {
         per_thread_api_log_str = "invalid byte size (param2)"; // leads to e.g. "out of bounds" memory access during memcpy
+    } else if ((info == MC_CONTEXT_SERIAL_EXECUTION_THRESHOLD || info == MC_CONTEXT_HELPER_THREAD_COUNT) && (pMem != nullptr && bytes != sizeof(uint32_t))) {
+        per_thread_api_log_str = "invalid byte size (param2)";
+    } else if ((info == MC_CONTEXT_DISPATCH_STATS) && (pMem != nullptr && bytes != sizeof(McDispatchStats))) {
+        per_thread_api_log_str = "invalid byte size (param2)";
+    } else if ((info == MC_CONTEXT_TRACE) && (pMem != nullptr && bytes == 0)) {
+        per_thread_api_log_str = "invalid byte size (param2)"; // i.e. no space for the null terminator
     } else {
         try {
             get_info_impl(context, info, bytes, pMem, pNumBytes);
@@ -188,6 +225,40 @@ MCAPI_ATTR McResult MCAPI_CALL mcGetInfo(const McContext context, McFlags info,
     return return_value;
 }
 
+MCAPI_ATTR McResult MCAPI_CALL mcSetContextProperty(const McContext context, McFlags property, uint64_t bytes, const void* pMem)
+{
+    McResult return_value = McResult::MC_NO_ERROR;
+    per_thread_api_log_str.clear();
+
+    if (context == nullptr) {
+        per_thread_api_log_str = "context ptr (param0) undef (NULL)";
+    } else if (pMem == nullptr) {
+        per_thread_api_log_str = "memory ptr (param3) undef (NULL)";
+    } else if (false == (property == MC_CONTEXT_SERIAL_EXECUTION_THRESHOLD || property == MC_CONTEXT_TRACE_FILE)) // check all possible (writable) values
+    {
+        per_thread_api_log_str = "invalid property flag val (param1)";
+    } else if ((property == MC_CONTEXT_SERIAL_EXECUTION_THRESHOLD) && bytes != sizeof(uint32_t)) {
+        per_thread_api_log_str = "invalid byte size (param2)";
+    } else if ((property == MC_CONTEXT_TRACE_FILE) && (bytes < 2 || strnlen(reinterpret_cast<const char*>(pMem), (size_t)bytes) != bytes - 1)) {
+        per_thread_api_log_str = "invalid byte size (param2)"; // i.e. not a (non-empty) null-terminated string of that size
+    } else {
+        try {
+            set_context_property_impl(context, property, bytes, pMem);
+        }
+        CATCH_POSSIBLE_EXCEPTIONS(per_thread_api_log_str);
+    }
+
+    if (!per_thread_api_log_str.empty()) {
+        std::fprintf(stderr, "%s(...) -> %s\n", __FUNCTION__, per_thread_api_log_str.c_str());
+        if (return_value == McResult::MC_NO_ERROR) // i.e. problem with basic local parameter checks
+        {
+            return_value = McResult::MC_INVALID_VALUE;
+        }
+    }
+
+    return return_value;
+}
+
 MCAPI_ATTR McResult MCAPI_CALL mcDispatch(
     const McContext context,
     McFlags dispatchFlags,
@@ -274,6 +345,423 @@ MCAPI_ATTR McResult MCAPI_CALL mcDispatch(
     return return_value;
 }
 
+MCAPI_ATTR McResult MCAPI_CALL mcCreateMesh(
+    const McContext context,
+    McMesh* pMesh,
+    McFlags flags,
+    const void* pVertices,
+    const uint32_t* pFaceIndices,
+    const uint32_t* pFaceSizes,
+    uint32_t numVertices,
+    uint32_t numFaces)
+{
+    TIMESTACK_RESET(); // reset tracking vars
+
+    TIMESTACK_PUSH(__FUNCTION__);
+
+    McResult return_value = McResult::MC_NO_ERROR;
+    per_thread_api_log_str.clear();
+
+    if (context == nullptr) {
+        per_thread_api_log_str = "context ptr (param0) undef (NULL)";
+    } else if (pMesh == nullptr) {
+        per_thread_api_log_str = "mesh ptr (param1) undef (NULL)";
+    } else if ((flags & MC_DISPATCH_VERTEX_ARRAY_FLOAT) == 0 && (flags & MC_DISPATCH_VERTEX_ARRAY_DOUBLE) == 0) {
+        per_thread_api_log_str = "vertex aray type unspecified";
+    } else if (pVertices == nullptr) {
+        per_thread_api_log_str = "vertex-position array ptr undef (NULL)";
+    } else if (numVertices < 3) {
+        per_thread_api_log_str = "invalid vertex count";
+    } else if (pFaceIndices == nullptr) {
+        per_thread_api_log_str = "face-index array ptr undef (NULL)";
+    } else if (numFaces < 1) {
+        per_thread_api_log_str = "invalid face count";
+    } else {
+        try {
+            create_mesh_impl(
+                context,
+                pMesh,
+                flags,
+                pVertices,
+                pFaceIndices,
+                pFaceSizes,
+                numVertices,
+                numFaces);
+        }
+        CATCH_POSSIBLE_EXCEPTIONS(per_thread_api_log_str);
+    }
+
+    if (!per_thread_api_log_str.empty()) {
+
+        std::fprintf(stderr, "%s(...) -> %s\n", __FUNCTION__, per_thread_api_log_str.c_str());
+
+        if (return_value == McResult::MC_NO_ERROR) // i.e. problem with basic local parameter checks
+        {
+            return_value = McResult::MC_INVALID_VALUE;
+        }
+    }
+
+    TIMESTACK_POP();
+
+    return return_value;
+}
+
+MCAPI_ATTR McResult MCAPI_CALL mcEnqueueDispatch(
+    const McContext context,
+    McFlags dispatchFlags,
+    const void* pSrcMeshVertices,
+    const uint32_t* pSrcMeshFaceIndices,
+    const uint32_t* pSrcMeshFaceSizes,
+    uint32_t numSrcMeshVertices,
+    uint32_t numSrcMeshFaces,
+    const void* pCutMeshVertices,
+    const uint32_t* pCutMeshFaceIndices,
+    const uint32_t* pCutMeshFaceSizes,
+    uint32_t numCutMeshVertices,
+    uint32_t numCutMeshFaces,
+    pfn_McEvent_CALLBACK pfnNotify,
+    void* pUserData,
+    McEvent* pEvent)
+{
+    McResult return_value = McResult::MC_NO_ERROR;
+    per_thread_api_log_str.clear();
+
+    if (context == nullptr) {
+        per_thread_api_log_str = "context ptr (param0) undef (NULL)";
+    } else if (dispatchFlags == 0) {
+        per_thread_api_log_str = "dispatch flags unspecified";
+    } else if ((dispatchFlags & MC_DISPATCH_REQUIRE_THROUGH_CUTS) && //
+        (dispatchFlags & MC_DISPATCH_FILTER_FRAGMENT_LOCATION_UNDEFINED)) {
+        per_thread_api_log_str = "use of mutually-exclusive flags: MC_DISPATCH_REQUIRE_THROUGH_CUTS & MC_DISPATCH_FILTER_FRAGMENT_LOCATION_UNDEFINED";
+    } else if ((dispatchFlags & MC_DISPATCH_VERTEX_ARRAY_FLOAT) == 0 && (dispatchFlags & MC_DISPATCH_VERTEX_ARRAY_DOUBLE) == 0) {
+        per_thread_api_log_str = "dispatch vertex aray type unspecified";
+    } else if (pSrcMeshVertices == nullptr) {
+        per_thread_api_log_str = "source-mesh vertex-position array ptr undef (NULL)";
+    } else if (numSrcMeshVertices < 3) {
+        per_thread_api_log_str = "invalid source-mesh vertex count";
+    } else if (pSrcMeshFaceIndices == nullptr) {
+        per_thread_api_log_str = "source-mesh face-index array ptr undef (NULL)";
+    } else if (numSrcMeshFaces < 1) {
+        per_thread_api_log_str = "invalid source-mesh vertex count";
+    } else if (pCutMeshVertices == nullptr) {
+        per_thread_api_log_str = "cut-mesh vertex-position array ptr undef (NULL)";
+    } else if (numCutMeshVertices < 3) {
+        per_thread_api_log_str = "invalid cut-mesh vertex count";
+    } else if (pCutMeshFaceIndices == nullptr) {
+        per_thread_api_log_str = "cut-mesh face-index array ptr undef (NULL)";
+    } else if (numCutMeshFaces < 1) {
+        per_thread_api_log_str = "invalid cut-mesh vertex count";
+    } else if (pEvent == nullptr) {
+        per_thread_api_log_str = "event ptr (param14) undef (NULL)";
+    } else {
+        try {
+            enqueue_dispatch_impl(
+                context,
+                dispatchFlags,
+                pSrcMeshVertices,
+                pSrcMeshFaceIndices,
+                pSrcMeshFaceSizes,
+                numSrcMeshVertices,
+                numSrcMeshFaces,
+                pCutMeshVertices,
+                pCutMeshFaceIndices,
+                pCutMeshFaceSizes,
+                numCutMeshVertices,
+                numCutMeshFaces,
+                pfnNotify,
+                pUserData,
+                pEvent);
+        }
+        CATCH_POSSIBLE_EXCEPTIONS(per_thread_api_log_str);
+    }
+
+    if (!per_thread_api_log_str.empty()) {
+
+        std::fprintf(stderr, "%s(...) -> %s\n", __FUNCTION__, per_thread_api_log_str.c_str());
+
+        if (return_value == McResult::MC_NO_ERROR) // i.e. problem with basic local parameter checks
+        {
+            return_value = McResult::MC_INVALID_VALUE;
+        }
+    }
+
+    return return_value;
+}
+
+MCAPI_ATTR McResult MCAPI_CALL mcWaitForEvents(
+    const McContext context,
+    uint32_t numEvents,
+    const McEvent* pEventList)
+{
+    McResult return_value = McResult::MC_NO_ERROR;
+    per_thread_api_log_str.clear();
+
+    if (context == nullptr) {
+        per_thread_api_log_str = "context ptr (param0) undef (NULL)";
+    } else if (numEvents == 0) {
+        per_thread_api_log_str = "invalid event count (param1)";
+    } else if (pEventList == nullptr) {
+        per_thread_api_log_str = "event list ptr (param2) undef (NULL)";
+    } else {
+        try {
+            wait_for_events_impl(context, numEvents, pEventList);
+        }
+        CATCH_POSSIBLE_EXCEPTIONS(per_thread_api_log_str);
+    }
+
+    if (!per_thread_api_log_str.empty()) {
+
+        std::fprintf(stderr, "%s(...) -> %s\n", __FUNCTION__, per_thread_api_log_str.c_str());
+
+        if (return_value == McResult::MC_NO_ERROR) // i.e. problem with basic local parameter checks
+        {
+            return_value = McResult::MC_INVALID_VALUE;
+        }
+    }
+
+    return return_value;
+}
+
+MCAPI_ATTR McResult MCAPI_CALL mcGetEventInfo(
+    const McContext context,
+    McEvent event,
+    McFlags info,
+    uint64_t bytes,
+    void* pMem,
+    uint64_t* pNumBytes)
+{
+    McResult return_value = McResult::MC_NO_ERROR;
+    per_thread_api_log_str.clear();
+
+    if (context == nullptr) {
+        per_thread_api_log_str = "context ptr (param0) undef (NULL)";
+    } else if (event == nullptr) {
+        per_thread_api_log_str = "event ptr (param1) undef (NULL)";
+    } else if (bytes != 0 && pMem == nullptr) {
+        per_thread_api_log_str = "invalid specification (param3 & param4)";
+    } else if (pMem == nullptr && pNumBytes == nullptr) {
+        per_thread_api_log_str = "output parameters undef (param4 & param5)";
+    } else {
+        try {
+            get_event_info_impl(context, event, info, bytes, pMem, pNumBytes);
+        }
+        CATCH_POSSIBLE_EXCEPTIONS(per_thread_api_log_str);
+    }
+
+    if (!per_thread_api_log_str.empty()) {
+
+        std::fprintf(stderr, "%s(...) -> %s\n", __FUNCTION__, per_thread_api_log_str.c_str());
+
+        if (return_value == McResult::MC_NO_ERROR) // i.e. problem with basic local parameter checks
+        {
+            return_value = McResult::MC_INVALID_VALUE;
+        }
+    }
+
+    return return_value;
+}
+
+MCAPI_ATTR McResult MCAPI_CALL mcReleaseEvents(
+    const McContext context,
+    uint32_t numEvents,
+    const McEvent* pEvents)
+{
+    McResult return_value = McResult::MC_NO_ERROR;
+    per_thread_api_log_str.clear();
+
+    if (context == nullptr) {
+        per_thread_api_log_str = "context ptr (param0) undef (NULL)";
+    } else if (numEvents == 0) {
+        per_thread_api_log_str = "invalid event count (param1)";
+    } else if (pEvents == nullptr) {
+        per_thread_api_log_str = "event list ptr (param2) undef (NULL)";
+    } else {
+        try {
+            release_events_impl(context, numEvents, pEvents);
+        }
+        CATCH_POSSIBLE_EXCEPTIONS(per_thread_api_log_str);
+    }
+
+    if (!per_thread_api_log_str.empty()) {
+
+        std::fprintf(stderr, "%s(...) -> %s\n", __FUNCTION__, per_thread_api_log_str.c_str());
+
+        if (return_value == McResult::MC_NO_ERROR) // i.e. problem with basic local parameter checks
+        {
+            return_value = McResult::MC_INVALID_VALUE;
+        }
+    }
+
+    return return_value;
+}
+
+MCAPI_ATTR McResult MCAPI_CALL mcDispatchMeshes(
+    const McContext context,
+    McFlags dispatchFlags,
+    McMesh srcMesh,
+    const void* pCutMeshVertices,
+    const uint32_t* pCutMeshFaceIndices,
+    const uint32_t* pCutMeshFaceSizes,
+    uint32_t numCutMeshVertices,
+    uint32_t numCutMeshFaces)
+{
+    TIMESTACK_RESET(); // reset tracking vars
+
+    TIMESTACK_PUSH(__FUNCTION__);
+
+    McResult return_value = McResult::MC_NO_ERROR;
+    per_thread_api_log_str.clear();
+
+    if (context == nullptr) {
+        per_thread_api_log_str = "context ptr (param0) undef (NULL)";
+    } else if (dispatchFlags == 0) {
+        per_thread_api_log_str = "dispatch flags unspecified";
+    } else if ((dispatchFlags & MC_DISPATCH_REQUIRE_THROUGH_CUTS) && //
+        (dispatchFlags & MC_DISPATCH_FILTER_FRAGMENT_LOCATION_UNDEFINED)) {
+        per_thread_api_log_str = "use of mutually-exclusive flags: MC_DISPATCH_REQUIRE_THROUGH_CUTS & MC_DISPATCH_FILTER_FRAGMENT_LOCATION_UNDEFINED";
+    } else if ((dispatchFlags & MC_DISPATCH_VERTEX_ARRAY_FLOAT) == 0 && (dispatchFlags & MC_DISPATCH_VERTEX_ARRAY_DOUBLE) == 0) {
+        per_thread_api_log_str = "dispatch vertex aray type unspecified";
+    } else if (srcMesh == nullptr) {
+        per_thread_api_log_str = "source-mesh ptr (param2) undef (NULL)";
+    } else if (pCutMeshVertices == nullptr) {
+        per_thread_api_log_str = "cut-mesh vertex-position array ptr undef (NULL)";
+    } else if (numCutMeshVertices < 3) {
+        per_thread_api_log_str = "invalid cut-mesh vertex count";
+    } else if (pCutMeshFaceIndices == nullptr) {
+        per_thread_api_log_str = "cut-mesh face-index array ptr undef (NULL)";
+    } else if (numCutMeshFaces < 1) {
+        per_thread_api_log_str = "invalid cut-mesh vertex count";
+    } else {
+        try {
+            dispatch_meshes_impl(
+                context,
+                dispatchFlags,
+                srcMesh,
+                pCutMeshVertices,
+                pCutMeshFaceIndices,
+                pCutMeshFaceSizes,
+                numCutMeshVertices,
+                numCutMeshFaces);
+        }
+        CATCH_POSSIBLE_EXCEPTIONS(per_thread_api_log_str);
+    }
+
+    if (!per_thread_api_log_str.empty()) {
+
+        std::fprintf(stderr, "%s(...) -> %s\n", __FUNCTION__, per_thread_api_log_str.c_str());
+
+        if (return_value == McResult::MC_NO_ERROR) // i.e. problem with basic local parameter checks
+        {
+            return_value = McResult::MC_INVALID_VALUE;
+        }
+    }
+
+    TIMESTACK_POP();
+
+    return return_value;
+}
+
+MCAPI_ATTR McResult MCAPI_CALL mcDispatchBatch(
+    const McContext context,
+    McFlags dispatchFlags,
+    McMesh srcMesh,
+    uint32_t numCutMeshes,
+    const void* const* ppCutMeshVertices,
+    const uint32_t* const* ppCutMeshFaceIndices,
+    const uint32_t* const* ppCutMeshFaceSizes,
+    const uint32_t* pNumCutMeshVertices,
+    const uint32_t* pNumCutMeshFaces,
+    McResult* pResults)
+{
+    TIMESTACK_RESET(); // reset tracking vars
+
+    TIMESTACK_PUSH(__FUNCTION__);
+
+    McResult return_value = McResult::MC_NO_ERROR;
+    per_thread_api_log_str.clear();
+
+    if (context == nullptr) {
+        per_thread_api_log_str = "context ptr (param0) undef (NULL)";
+    } else if (dispatchFlags == 0) {
+        per_thread_api_log_str = "dispatch flags unspecified";
+    } else if ((dispatchFlags & MC_DISPATCH_REQUIRE_THROUGH_CUTS) && //
+        (dispatchFlags & MC_DISPATCH_FILTER_FRAGMENT_LOCATION_UNDEFINED)) {
+        per_thread_api_log_str = "use of mutually-exclusive flags: MC_DISPATCH_REQUIRE_THROUGH_CUTS & MC_DISPATCH_FILTER_FRAGMENT_LOCATION_UNDEFINED";
+    } else if ((dispatchFlags & MC_DISPATCH_VERTEX_ARRAY_FLOAT) == 0 && (dispatchFlags & MC_DISPATCH_VERTEX_ARRAY_DOUBLE) == 0) {
+        per_thread_api_log_str = "dispatch vertex aray type unspecified";
+    } else if (srcMesh == nullptr) {
+        per_thread_api_log_str = "source-mesh ptr (param2) undef (NULL)";
+    } else if (numCutMeshes == 0) {
+        per_thread_api_log_str = "invalid cut-mesh count";
+    } else if (ppCutMeshVertices == nullptr) {
+        per_thread_api_log_str = "cut-mesh vertex-position array ptr undef (NULL)";
+    } else if (ppCutMeshFaceIndices == nullptr) {
+        per_thread_api_log_str = "cut-mesh face-index array ptr undef (NULL)";
+    } else if (pNumCutMeshVertices == nullptr) {
+        per_thread_api_log_str = "cut-mesh vertex-count array ptr undef (NULL)";
+    } else if (pNumCutMeshFaces == nullptr) {
+        per_thread_api_log_str = "cut-mesh face-count array ptr undef (NULL)";
+    } else {
+        try {
+            dispatch_batch_impl(
+                context,
+                dispatchFlags,
+                srcMesh,
+                numCutMeshes,
+                ppCutMeshVertices,
+                ppCutMeshFaceIndices,
+                ppCutMeshFaceSizes,
+                pNumCutMeshVertices,
+                pNumCutMeshFaces,
+                pResults);
+        }
+        CATCH_POSSIBLE_EXCEPTIONS(per_thread_api_log_str);
+    }
+
+    if (!per_thread_api_log_str.empty()) {
+
+        std::fprintf(stderr, "%s(...) -> %s\n", __FUNCTION__, per_thread_api_log_str.c_str());
+
+        if (return_value == McResult::MC_NO_ERROR) // i.e. problem with basic local parameter checks
+        {
+            return_value = McResult::MC_INVALID_VALUE;
+        }
+    }
+
+    TIMESTACK_POP();
+
+    return return_value;
+}
+
+MCAPI_ATTR McResult MCAPI_CALL mcReleaseMesh(const McContext context, McMesh mesh)
+{
+    McResult return_value = McResult::MC_NO_ERROR;
+    per_thread_api_log_str.clear();
+
+    if (context == nullptr) {
+        per_thread_api_log_str = "context ptr (param0) undef (NULL)";
+    } else if (mesh == nullptr) {
+        per_thread_api_log_str = "mesh ptr (param1) undef (NULL)";
+    } else {
+        try {
+            release_mesh_impl(context, mesh);
+        }
+        CATCH_POSSIBLE_EXCEPTIONS(per_thread_api_log_str);
+    }
+
+    if (!per_thread_api_log_str.empty()) {
+
+        std::fprintf(stderr, "%s(...) -> %s\n", __FUNCTION__, per_thread_api_log_str.c_str());
+
+        if (return_value == McResult::MC_NO_ERROR) // i.e. problem with basic local parameter checks
+        {
+            return_value = McResult::MC_INVALID_VALUE;
+        }
+    }
+
+    return return_value;
+}
+
 MCAPI_ATTR McResult MCAPI_CALL mcGetConnectedComponents(
     const McContext context,
     const McConnectedComponentType connectedComponentType,
@@ -310,6 +798,43 @@ MCAPI_ATTR McResult MCAPI_CALL mcGetConnectedComponents(
     return return_value;
 }
 
+MCAPI_ATTR McResult MCAPI_CALL mcGetBatchConnectedComponents(
+    const McContext context,
+    const uint32_t cutMeshIndex,
+    const McConnectedComponentType connectedComponentType,
+    const uint32_t numEntries,
+    McConnectedComponent* pConnComps,
+    uint32_t* numConnComps)
+{
+    McResult return_value = McResult::MC_NO_ERROR;
+    per_thread_api_log_str.clear();
+
+    if (context == nullptr) {
+        per_thread_api_log_str = "context ptr (param0) undef (NULL)";
+    } else if (connectedComponentType == 0) {
+        per_thread_api_log_str = "invalid type-parameter (param2) (0)";
+    } else if (numConnComps == nullptr && pConnComps == nullptr) {
+        per_thread_api_log_str = "output parameters undef (param4 & param5)";
+    } else {
+        try {
+            get_batch_connected_components_impl(context, cutMeshIndex, connectedComponentType, numEntries, pConnComps, numConnComps);
+        }
+        CATCH_POSSIBLE_EXCEPTIONS(per_thread_api_log_str);
+    }
+
+    if (!per_thread_api_log_str.empty()) {
+
+        std::fprintf(stderr, "%s(...) -> %s\n", __FUNCTION__, per_thread_api_log_str.c_str());
+
+        if (return_value == McResult::MC_NO_ERROR) // i.e. problem with basic local parameter checks
+        {
+            return_value = McResult::MC_INVALID_VALUE;
+        }
+    }
+
+    return return_value;
+}
+
 McResult MCAPI_CALL mcGetConnectedComponentData(
     const McContext context,
     const McConnectedComponent connCompId,
@@ -15,30 +15,19 @@
 const double GENERAL_POSITION_ENFORCMENT_CONSTANT = 1e-4;
 const int MAX_PERTUBATION_ATTEMPTS = 1 << 3;
 
-// this function converts an index array mesh (e.g. as recieved by the dispatch
-// function) into a halfedge mesh representation for the kernel backend.
-bool client_input_arrays_to_hmesh(
-    std::unique_ptr<context_t>& context_uptr,
-    hmesh_t& halfedgeMesh,
-    double& bboxDiagonal,
+// reads the vertices of an index array mesh (e.g. as recieved by the dispatch function), to
+// which "perturbation" is added (if any), and returns the length of their bounding box diagonal
+double client_input_arrays_to_vertices(
+    const McFlags flags,
+    std::vector<vec3>& vertices,
     const void* pVertices,
-    const uint32_t* pFaceIndices,
-    const uint32_t* pFaceSizes,
     const uint32_t numVertices,
-    const uint32_t numFaces,
-    const vec3* perturbation = NULL)
+    const vec3* perturbation)
 {
-    TIMESTACK_PUSH(__FUNCTION__);
-
-    context_uptr->log(MC_DEBUG_SOURCE_API, MC_DEBUG_TYPE_OTHER, 0, MC_DEBUG_SEVERITY_NOTIFICATION, "construct halfedge mesh");
-
-    // minor optimization
-    halfedgeMesh.reserve_for_additional_elements(numVertices);
-
-    TIMESTACK_PUSH("add vertices");
+    vertices.resize(numVertices);
 
     // did the user provide vertex arrays of 32-bit floats...?
-    if (context_uptr->dispatchFlags & MC_DISPATCH_VERTEX_ARRAY_FLOAT) {
+    if (flags & MC_DISPATCH_VERTEX_ARRAY_FLOAT) {
         const float* vptr = reinterpret_cast<const float*>(pVertices);
 
         // for each input mesh-vertex
@@ -47,17 +36,14 @@ bool client_input_arrays_to_hmesh(
             const float& y = vptr[(i * 3) + 1];
             const float& z = vptr[(i * 3) + 2];
 
-            // insert our vertex into halfedge mesh
-            vd_t vd = halfedgeMesh.add_vertex(
+            vertices[i] = vec3(
                 double(x) + (perturbation != NULL ? (*perturbation).x() : double(0.)),
                 double(y) + (perturbation != NULL ? (*perturbation).y() : double(0.)),
                 double(z) + (perturbation != NULL ? (*perturbation).z() : double(0.)));
-
-            MCUT_ASSERT(vd != hmesh_t::null_vertex() && (uint32_t)vd < numVertices);
         }
     }
     // did the user provide vertex arrays of 64-bit double...?
-    else if (context_uptr->dispatchFlags & MC_DISPATCH_VERTEX_ARRAY_DOUBLE) {
+    else if (flags & MC_DISPATCH_VERTEX_ARRAY_DOUBLE) {
         const double* vptr = reinterpret_cast<const double*>(pVertices);
 
         // for each input mesh-vertex
@@ -66,207 +52,190 @@ bool client_input_arrays_to_hmesh(
             const double& y = vptr[(i * 3) + 1];
             const double& z = vptr[(i * 3) + 2];
 
-            // insert our vertex into halfedge mesh
-            vd_t vd = halfedgeMesh.add_vertex(
+            vertices[i] = vec3(
                 double(x) + (perturbation != NULL ? (*perturbation).x() : double(0.)),
                 double(y) + (perturbation != NULL ? (*perturbation).y() : double(0.)),
                 double(z) + (perturbation != NULL ? (*perturbation).z() : double(0.)));
-
-            MCUT_ASSERT(vd != hmesh_t::null_vertex() && (uint32_t)vd < numVertices);
         }
     }
 
-    TIMESTACK_POP();
-
     // compute the mesh bounding box while we are at it (for numerical perturbation)
     vec3 bboxMin(1e10);
     vec3 bboxMax(-1e10);
 
-    TIMESTACK_PUSH("create bbox");
-    for (vertex_array_iterator_t i = halfedgeMesh.vertices_begin(); i != halfedgeMesh.vertices_end(); ++i) {
-        const vec3& coords = halfedgeMesh.vertex(*i);
-        bboxMin = compwise_min(bboxMin, coords);
-        bboxMax = compwise_max(bboxMax, coords);
+    for (std::vector<vec3>::const_iterator i = vertices.cbegin(); i != vertices.cend(); ++i) {
+        bboxMin = compwise_min(bboxMin, *i);
+        bboxMax = compwise_max(bboxMax, *i);
     }
-    bboxDiagonal = length(bboxMax - bboxMin);
-    TIMESTACK_POP();
 
-    TIMESTACK_PUSH("create faces");
+    return length(bboxMax - bboxMin);
+}
 
+// checks the faces of an index array mesh, and computes the offset of the first vertex index
+// of each face (i.e. as expected by hmesh_t::build_from_arrays)
+bool client_input_arrays_to_face_offsets(
+    std::unique_ptr<context_t>& context_uptr,
+    std::vector<uint32_t>& face_offsets,
+    const uint32_t* pFaceIndices,
+    const uint32_t* pFaceSizes,
+    const uint32_t numVertices,
+    const uint32_t numFaces)
+{
     const bool assume_triangle_mesh = (pFaceSizes == nullptr);
 
-#if defined(MCUT_MULTI_THREADED)
-    std::vector<uint32_t> partial_sums(numFaces, 0); // prefix sum result
-    std::partial_sum(pFaceSizes, pFaceSizes + numFaces, partial_sums.data());
+    // offset of the first vertex index of each face (i.e. exclusive prefix sum of the face sizes)
+    face_offsets.assign(numFaces + 1, 0);
 
-    {
-        typedef std::vector<uint32_t>::const_iterator InputStorageIteratorType;
-        typedef std::pair<InputStorageIteratorType, InputStorageIteratorType> OutputStorageType; // range of faces
-        std::atomic_int atm_result;
-        atm_result.store((int)McResult::MC_NO_ERROR); // 0 = ok;/ 1 = invalid face size; 2 invalid vertex index
+    for (uint32_t i = 0; i < numFaces; ++i) {
+        face_offsets[i + 1] = face_offsets[i] + (assume_triangle_mesh ? 3 : pFaceSizes[i]);
+    }
 
-        std::vector<std::vector<vd_t>> faces(numFaces);
+    // returns a description of the problem with the given face, or an empty string if it is valid
+    auto get_face_error = [&](uint32_t faceID) -> std::string {
+        const uint32_t face_vertex_count = face_offsets[faceID + 1] - face_offsets[faceID];
 
-        auto fn_create_faces = [&](
-                                   InputStorageIteratorType block_start_,
-                                   InputStorageIteratorType block_end_) -> OutputStorageType {
-            for (InputStorageIteratorType i = block_start_; i != block_end_; ++i) {
-                uint32_t faceID = (uint32_t)std::distance(partial_sums.cbegin(), i);
-                std::vector<vd_t>& faceVertices = faces[faceID];
-                int face_vertex_count = assume_triangle_mesh ? 3 : ((uint32_t*)pFaceSizes)[faceID];
-
-                if (face_vertex_count < 3) {
-                    int zero = (int)McResult::MC_NO_ERROR;
-                    bool exchanged = atm_result.compare_exchange_strong(zero, 1);
-                    if (exchanged) // first thread to detect error
-                    {
-                        context_uptr->log( //
-                            MC_DEBUG_SOURCE_API, //
-                            MC_DEBUG_TYPE_ERROR, //
-                            0, //
-                            MC_DEBUG_SEVERITY_HIGH, //
-                            "invalid face-size for face - " + std::to_string(faceID) + " (size = " + std::to_string(face_vertex_count) + ")");
-                    }
-                    break;
-                }
+        if (face_vertex_count < 3) {
+            return "invalid face-size for face - " + std::to_string(faceID) + " (size = " + std::to_string(face_vertex_count) + ")";
+        }
 
-                faceVertices.resize(face_vertex_count);
-                int faceBaseOffset = (*i) - face_vertex_count;
+        const uint32_t* faceVertices = pFaceIndices + face_offsets[faceID];
 
-                for (int j = 0; j < face_vertex_count; ++j) {
-                    uint32_t idx = ((uint32_t*)pFaceIndices)[faceBaseOffset + j];
+        for (uint32_t j = 0; j < face_vertex_count; ++j) {
+            const uint32_t idx = faceVertices[j];
 
-                    MCUT_ASSERT(idx < numVertices);
+            if (idx >= numVertices) {
+                return "invalid vertex index " + std::to_string(idx) + " in face - " + std::to_string(faceID);
+            }
 
-                    const vertex_descriptor_t descr(idx);
-                    const bool isDuplicate = std::find(faceVertices.cbegin(), faceVertices.cend(), descr) != faceVertices.cend();
+            const bool isDuplicate = std::find(faceVertices, faceVertices + j, idx) != faceVertices + j;
 
-                    if (isDuplicate) {
-                        int zero = (int)McResult::MC_NO_ERROR;
-                        bool exchanged = atm_result.compare_exchange_strong(zero, 2);
+            if (isDuplicate) {
+                return "found duplicate vertex in face - " + std::to_string(faceID);
+            }
+        }
 
-                        if (exchanged) // first thread to detect error
-                        {
-                            context_uptr->log(
-                                MC_DEBUG_SOURCE_API,
-                                MC_DEBUG_TYPE_ERROR,
-                                0,
-                                MC_DEBUG_SEVERITY_HIGH,
-                                "found duplicate vertex in face - " + std::to_string(faceID));
-                        }
-                        break;
-                    }
+        return std::string();
+    };
 
-                    faceVertices[j] = (descr);
+#if defined(MCUT_MULTI_THREADED)
+    {
+        typedef std::vector<uint32_t>::const_iterator InputStorageIteratorType;
+        typedef int OutputStorageType; // unused
+        std::atomic_bool atm_found_error(false);
+
+        auto fn_check_faces = [&](
+                                  InputStorageIteratorType block_start_,
+                                  InputStorageIteratorType block_end_) -> OutputStorageType {
+            for (InputStorageIteratorType i = block_start_; i != block_end_; ++i) {
+                const uint32_t faceID = (uint32_t)std::distance(face_offsets.cbegin(), i);
+                const std::string error = get_face_error(faceID);
+
+                if (!error.empty()) {
+                    if (!atm_found_error.exchange(true)) // first thread to detect error
+                    {
+                        context_uptr->log(MC_DEBUG_SOURCE_API, MC_DEBUG_TYPE_ERROR, 0, MC_DEBUG_SEVERITY_HIGH, error);
+                    }
+                    break;
                 }
             }
-            return std::make_pair(block_start_, block_end_);
+            return 0;
         };
 
         std::vector<std::future<OutputStorageType>> futures;
         OutputStorageType partial_res;
 
         parallel_fork_and_join(
-            context_uptr->scheduler,
-            partial_sums.cbegin(),
-            partial_sums.cend(),
+            *context_uptr->scheduler,
+            context_uptr->serial_execution_threshold.load(),
+            face_offsets.cbegin(),
+            face_offsets.cbegin() + numFaces,
             (1 << 8),
-            fn_create_faces,
+            fn_check_faces,
             partial_res, // output computed by master thread
             futures);
 
-        auto add_faces = [&](InputStorageIteratorType block_start_,
-                             InputStorageIteratorType block_end_) -> bool {
-            for (InputStorageIteratorType face_iter = block_start_;
-                 face_iter != block_end_; ++face_iter) {
-                uint32_t faceID = (uint32_t)std::distance(partial_sums.cbegin(), face_iter);
-                const std::vector<vd_t>& faceVertices = SAFE_ACCESS(faces, faceID);
-                fd_t fd = halfedgeMesh.add_face(faceVertices);
-
-                if (fd == hmesh_t::null_face()) {
-
-                    context_uptr->log( //
-                        MC_DEBUG_SOURCE_API, //
-                        MC_DEBUG_TYPE_ERROR, //
-                        0, //
-                        MC_DEBUG_SEVERITY_HIGH, //
-                        "invalid vertices on face - " + std::to_string(faceID));
-                    return false;
-                }
-            }
-            return true;
-        };
-
-        bool okay = true;
         for (int i = 0; i < (int)futures.size(); ++i) {
-            std::future<OutputStorageType>& f = futures[i];
-            MCUT_ASSERT(f.valid()); // The behavior is undefined if valid()== false before the call to wait_for
-            OutputStorageType future_res = f.get();
-
-            const int val = atm_result.load();
-            okay = okay && val == 0;
-            if (!okay) {
-                continue; // just go on (to next iteration) in order to at-least wait for all tasks to finish before we return to user
-            }
-
-            bool result = add_faces(future_res.first, future_res.second);
-            okay = okay && result == true;
+            futures[i].get(); // i.e. propagate exceptions
         }
 
-        if (!okay) {
+        if (atm_found_error.load()) {
             return false;
         }
+    }
+#else // #if defined(MCUT_MULTI_THREADED)
+    for (uint32_t i = 0; i < numFaces; ++i) {
+        const std::string error = get_face_error(i);
 
-        // add lastly in order to maintain order
-        bool result = add_faces(partial_res.first, partial_res.second);
-        if (!result) {
+        if (!error.empty()) {
+            context_uptr->log(MC_DEBUG_SOURCE_API, MC_DEBUG_TYPE_ERROR, 0, MC_DEBUG_SEVERITY_HIGH, error);
             return false;
         }
     }
-#else // #if defined(MCUT_MULTI_THREADED)
-    int faceSizeOffset = 0;
-    std::vector<vd_t> faceVertices;
+#endif
 
-    for (uint32_t i = 0; i < numFaces; ++i) {
-        faceVertices.clear();
-        int face_vertex_count =  assume_triangle_mesh ? 3 : ((uint32_t*)pFaceSizes)[i];
+    return true;
+}
 
-        if (face_vertex_count < 3) {
+// this function converts an index array mesh (e.g. as recieved by the dispatch
+// function) into a halfedge mesh representation for the kernel backend.
+bool client_input_arrays_to_hmesh(
+    std::unique_ptr<context_t>& context_uptr,
+    const McFlags flags,
+    hmesh_t& halfedgeMesh,
+    double& bboxDiagonal,
+    const void* pVertices,
+    const uint32_t* pFaceIndices,
+    const uint32_t* pFaceSizes,
+    const uint32_t numVertices,
+    const uint32_t numFaces,
+    const vec3* perturbation = NULL)
+{
+    TIMESTACK_PUSH(__FUNCTION__);
 
-            context_uptr->log(MC_DEBUG_SOURCE_API, MC_DEBUG_TYPE_ERROR, 0, MC_DEBUG_SEVERITY_HIGH, "invalid face-size for face - " + std::to_string(i) + " (size = " + std::to_string(face_vertex_count) + ")");
+    context_uptr->log(MC_DEBUG_SOURCE_API, MC_DEBUG_TYPE_OTHER, 0, MC_DEBUG_SEVERITY_NOTIFICATION, "construct halfedge mesh");
 
-            return false;
-        }
+    TIMESTACK_PUSH("add vertices");
 
-        for (int j = 0; j < face_vertex_count; ++j) {
+    std::vector<vec3> vertices;
+    bboxDiagonal = client_input_arrays_to_vertices(flags, vertices, pVertices, numVertices, perturbation);
 
-            uint32_t idx = ((uint32_t*)pFaceIndices)[faceSizeOffset + j];
-            const vertex_descriptor_t descr(idx); // = fIter->second; //vmap[*fIter.first];
-            const bool isDuplicate = std::find(faceVertices.cbegin(), faceVertices.cend(), descr) != faceVertices.cend();
+    // minor optimization
+    halfedgeMesh.reserve_for_additional_elements(numVertices);
 
-            if (isDuplicate) {
+    for (std::vector<vec3>::const_iterator i = vertices.cbegin(); i != vertices.cend(); ++i) {
+        vd_t vd = halfedgeMesh.add_vertex(*i);
 
-                context_uptr->log(MC_DEBUG_SOURCE_API, MC_DEBUG_TYPE_ERROR, 0, MC_DEBUG_SEVERITY_HIGH, "found duplicate vertex in face - " + std::to_string(i));
+        MCUT_ASSERT(vd != hmesh_t::null_vertex() && (uint32_t)vd < numVertices);
+        (void)vd;
+    }
 
-                return false;
-            }
+    TIMESTACK_POP();
 
-            faceVertices.push_back(descr);
-        }
+    TIMESTACK_PUSH("create faces");
 
-        fd_t fd = halfedgeMesh.add_face(faceVertices);
+    std::vector<uint32_t> face_offsets;
 
-        if (fd == hmesh_t::null_face()) {
-            // Hint: this can happen when the mesh does not have a consistent
-            // winding order i.e. some faces are CCW and others are CW
-            context_uptr->log(MC_DEBUG_SOURCE_API, MC_DEBUG_TYPE_ERROR, 0, MC_DEBUG_SEVERITY_HIGH, "non-manifold edge on face " + std::to_string(i));
+    if (false == client_input_arrays_to_face_offsets(context_uptr, face_offsets, pFaceIndices, pFaceSizes, numVertices, numFaces)) {
+        return false;
+    }
 
-            return false;
-        }
+    // all faces are added at once (instead of one at a time with add_face)
+    const uint32_t numFacesAdded = halfedgeMesh.build_from_arrays(
+#if defined(MCUT_MULTI_THREADED)
+        *context_uptr->scheduler,
+        context_uptr->serial_execution_threshold.load(),
+#endif
+        pFaceIndices,
+        face_offsets);
 
-        faceSizeOffset += face_vertex_count;
+    if (numFacesAdded != numFaces) {
+        // Hint: this can happen when the mesh does not have a consistent
+        // winding order i.e. some faces are CCW and others are CW
+        context_uptr->log(MC_DEBUG_SOURCE_API, MC_DEBUG_TYPE_ERROR, 0, MC_DEBUG_SEVERITY_HIGH, "non-manifold edge on face " + std::to_string(numFacesAdded));
+
+        return false;
     }
-#endif
+
     TIMESTACK_POP();
 
     TIMESTACK_POP();
@@ -274,6 +243,55 @@ bool client_input_arrays_to_hmesh(
     return true;
 }
 
+// this function converts an index array mesh (e.g. as recieved by the mesh creation function)
+// into the read-only compact representation that is kept by a mesh object (McMesh). Unlike
+// client_input_arrays_to_hmesh, no halfedge mesh is built on the way.
+bool client_input_arrays_to_compact_hmesh(
+    std::unique_ptr<context_t>& context_uptr,
+    const McFlags flags,
+    compact_hmesh_t& compactMesh,
+    double& bboxDiagonal,
+    const void* pVertices,
+    const uint32_t* pFaceIndices,
+    const uint32_t* pFaceSizes,
+    const uint32_t numVertices,
+    const uint32_t numFaces)
+{
+    TIMESTACK_PUSH(__FUNCTION__);
+
+    context_uptr->log(MC_DEBUG_SOURCE_API, MC_DEBUG_TYPE_OTHER, 0, MC_DEBUG_SEVERITY_NOTIFICATION, "construct compact halfedge mesh");
+
+    std::vector<vec3> vertices;
+    bboxDiagonal = client_input_arrays_to_vertices(flags, vertices, pVertices, numVertices, NULL);
+
+    std::vector<uint32_t> face_offsets;
+
+    if (false == client_input_arrays_to_face_offsets(context_uptr, face_offsets, pFaceIndices, pFaceSizes, numVertices, numFaces)) {
+        return false;
+    }
+
+    const uint32_t numFacesAdded = compactMesh.build_from_arrays(
+#if defined(MCUT_MULTI_THREADED)
+        *context_uptr->scheduler,
+        context_uptr->serial_execution_threshold.load(),
+#endif
+        vertices,
+        pFaceIndices,
+        face_offsets);
+
+    if (numFacesAdded != numFaces) {
+        // Hint: this can happen when the mesh does not have a consistent
+        // winding order i.e. some faces are CCW and others are CW
+        context_uptr->log(MC_DEBUG_SOURCE_API, MC_DEBUG_TYPE_ERROR, 0, MC_DEBUG_SEVERITY_HIGH, "non-manifold edge on face " + std::to_string(numFacesAdded));
+
+        return false;
+    }
+
+    TIMESTACK_POP();
+
+    return true;
+}
+
 #if 0
 // this function converts a halfedge mesh representation (from the kernel
 // backend) to an index array mesh (for the user).
@@ -371,7 +389,8 @@ void hmesh_to_array_mesh(
         int _1;
 
         parallel_fork_and_join(
-            context_uptr->scheduler,
+            *context_uptr->scheduler,
+            context_uptr->serial_execution_threshold.load(),
             halfedgeMeshInfo.mesh.vertices_begin(),
             halfedgeMeshInfo.mesh.vertices_end(),
             (1 << 8),
@@ -576,7 +595,8 @@ void hmesh_to_array_mesh(
         // std::advance(fff, (std::size_t)1);
 
         parallel_fork_and_join(
-            context_uptr->scheduler,
+            *context_uptr->scheduler,
+            context_uptr->serial_execution_threshold.load(),
             halfedgeMeshInfo.mesh.faces_begin(),
             halfedgeMeshInfo.mesh.faces_end(),
             (1 << 7),
@@ -704,7 +724,8 @@ void hmesh_to_array_mesh(
         int _1;
 
         parallel_fork_and_join(
-            context_uptr->scheduler,
+            *context_uptr->scheduler,
+            context_uptr->serial_execution_threshold.load(),
             halfedgeMeshInfo.mesh.faces_begin(),
             halfedgeMeshInfo.mesh.faces_end(),
             (1 << 8),
@@ -796,7 +817,8 @@ void hmesh_to_array_mesh(
         int _1;
 
         parallel_fork_and_join(
-            context_uptr->scheduler,
+            *context_uptr->scheduler,
+            context_uptr->serial_execution_threshold.load(),
             halfedgeMeshInfo.mesh.edges_begin(),
             halfedgeMeshInfo.mesh.edges_end(),
             (1 << 8),
@@ -854,9 +876,10 @@ void hmesh_to_array_mesh(
 }
 #endif
 
-bool is_coplanar(const hmesh_t& m, const fd_t& f, int& fv_count)
+bool is_coplanar(const compact_hmesh_t& m, const fd_t& f, int& fv_count)
 {
-    const std::vector<vd_t> vertices = m.get_vertices_around_face(f);
+    static thread_local std::vector<vd_t> vertices;
+    m.get_vertices_around_face(vertices, f);
     fv_count = (int)vertices.size();
     if (fv_count > 3) // non-triangle
     {
@@ -885,9 +908,45 @@ bool is_coplanar(const hmesh_t& m, const fd_t& f, int& fv_count)
     return true;
 }
 
+// number of vertex-connected components (same as find_connected_components, but without per-face and per-vertex outputs)
+int count_connected_components(const compact_hmesh_t& m)
+{
+    std::vector<bool> visited(m.number_of_internal_vertices(), false);
+    std::vector<vd_t> stack;
+    int n = 0;
+
+    for (int i = 0; i < m.number_of_internal_vertices(); ++i) {
+        const vd_t u(i);
+
+        if (visited[u] || m.is_removed(u)) {
+            continue;
+        }
+
+        n++;
+        visited[u] = true;
+        stack.push_back(u);
+
+        while (!stack.empty()) {
+            const vd_t v = stack.back();
+            stack.pop_back();
+
+            for (const hd_t* h = m.halfedges_around_vertex_begin(v); h != m.halfedges_around_vertex_end(v); ++h) {
+                const vd_t w = m.source(*h);
+
+                if (!visited[w]) {
+                    visited[w] = true;
+                    stack.push_back(w);
+                }
+            }
+        }
+    }
+
+    return n;
+}
+
 // check that the halfedge-mesh version of a user-provided mesh is valid (i.e.
 // it is a non-manifold mesh containing a single connected component etc.)
-bool check_input_mesh(std::unique_ptr<context_t>& context_uptr, const hmesh_t& m)
+bool check_input_mesh(std::unique_ptr<context_t>& context_uptr, const compact_hmesh_t& m)
 {
     if (m.number_of_vertices() < 3) {
         context_uptr->log(
@@ -909,10 +968,7 @@ bool check_input_mesh(std::unique_ptr<context_t>& context_uptr, const hmesh_t& m
         return false;
     }
 
-    std::vector<int> fccmap;
-    std::vector<int> cc_to_vertex_count;
-    std::vector<int> cc_to_face_count;
-    int n = find_connected_components(fccmap, m, cc_to_vertex_count, cc_to_face_count);
+    const int n = count_connected_components(m);
 
     if (n != 1) {
         context_uptr->log(
@@ -925,16 +981,22 @@ bool check_input_mesh(std::unique_ptr<context_t>& context_uptr, const hmesh_t& m
     }
 
     // check that the vertices of each face are co-planar
-    for (face_array_iterator_t f = m.faces_begin(); f != m.faces_end(); ++f) {
+    for (int i = 0; i < m.number_of_internal_faces(); ++i) {
+        const fd_t f(i);
+
+        if (m.is_removed(f)) {
+            continue;
+        }
+
         int fv_count = 0;
-        const bool face_is_coplanar = is_coplanar(m, *f, fv_count);
+        const bool face_is_coplanar = is_coplanar(m, f, fv_count);
         if (!face_is_coplanar) {
             context_uptr->log(
                 MC_DEBUG_SOURCE_API,
                 MC_DEBUG_TYPE_OTHER,
                 0,
                 MC_DEBUG_SEVERITY_NOTIFICATION,
-                "Vertices (" + std::to_string(fv_count) + ") on face " + std::to_string(*f) + " not coplanar");
+                "Vertices (" + std::to_string(fv_count) + ") on face " + std::to_string(f) + " not coplanar");
             // No need to return false, simply warn. It is difficult to
             // know whether the non-coplanarity is severe enough to cause
             // confusion when computing intersection points between two
@@ -1006,9 +1068,19 @@ McFragmentLocation convert(const sm_frag_location_t& v)
     return result;
 }
 
+// The faces of an input mesh that were changed by polygon partitioning i.e. the partitioned faces (which keep their
+// descriptor as the first child face) and their neighbours, whose vertices now include those on the partitioning edge.
+struct partitioned_faces_t {
+    std::vector<fd_t> retraced_faces;
+    // the faces that were added (i.e. the second child faces) and the face that each one was partitioned from
+    std::vector<std::pair<fd_t /*new face*/, fd_t /*parent*/>> new_faces;
+};
+
 void resolve_floating_polygons(
     bool& source_hmesh_modified,
     bool& cut_hmesh_modified,
+    partitioned_faces_t& source_hmesh_partitioned_faces,
+    partitioned_faces_t& cut_hmesh_partitioned_faces,
     const std::map<fd_t /*input mesh face with fp*/, std::vector<floating_polygon_info_t> /*list of floating polys*/>& detected_floating_polygons,
     const int source_hmesh_face_count_prev,
     hmesh_t& source_hmesh,
@@ -1044,6 +1116,7 @@ void resolve_floating_polygons(
         // This perturbation can happen when an input mesh face is partitioned with e.g. edge where that
         // is sufficient to resolve all floating polygons detected on that input mesh face.
         std::unordered_map<vd_t, vec3>& new_poly_partition_vertices = (parent_face_from_source_hmesh ? source_hmesh_new_poly_partition_vertices : cut_hmesh_new_poly_partition_vertices);
+        partitioned_faces_t& partitioned_faces = (parent_face_from_source_hmesh ? source_hmesh_partitioned_faces : cut_hmesh_partitioned_faces);
 
         // Now compute the actual input mesh face index (accounting for offset)
         // i.e. index/descriptor into the mesh referenced by "parent_face_hmesh_ptr"
@@ -1663,7 +1736,6 @@ void resolve_floating_polygons(
                 for (std::vector<hd_t>::const_iterator j = oldHalfedges.cbegin(); j != oldHalfedges.cend(); ++j) {
 
                     const hd_t oldHalfedge = *j;
-                    hd_t newHalfedge = hmesh_t::null_halfedge();
                     const ed_t oldHalfedgeEdge = parent_face_hmesh_ptr->edge(oldHalfedge);
 
                     // is the halfedge part of an edge that is to be partitioned...?
@@ -1696,6 +1768,7 @@ void resolve_floating_polygons(
 
                 const fd_t fdescr = parent_face_hmesh_ptr->add_face(faceVertices);
                 MCUT_ASSERT(fdescr == i->first);
+                partitioned_faces.retraced_faces.push_back(fdescr);
 
 #if 0
                         std::unordered_map<fd_t, fd_t>::const_iterator fiter = child_to_client_birth_face.find(fdescr);
@@ -1787,6 +1860,9 @@ void resolve_floating_polygons(
                 if (origFaceChildPolygons.size() == 1) {
                     // the first child face will re-use the descriptor of "origin_face".
                     MCUT_ASSERT(fdescr == origin_face);
+                    partitioned_faces.retraced_faces.push_back(fdescr);
+                } else {
+                    partitioned_faces.new_faces.push_back(std::make_pair(fdescr, origin_face));
                 }
 
                 child_to_client_birth_face[fdescr] = client_hmesh_birth_face;
@@ -1803,34 +1879,213 @@ void resolve_floating_polygons(
     } // for (std::vector<floating_polygon_info_t>::const_iterator detected_floating_polygons_iter = kernel_output.detected_floating_polygons.cbegin(); ...
 }
 
+#if defined(USE_OIBVH)
+// Update the bounding boxes of the faces of "mesh" that were changed by polygon partitioning (which may then be found
+// in "changed_faces"), and map each partitioned face (before partitioning) to the faces that descend from it.
+void update_partitioned_face_aabbs(
+    std::vector<bounding_box_t<vec3>>& face_aabb_array,
+    std::vector<fd_t>& changed_faces,
+    std::unordered_map<fd_t, std::vector<fd_t>>& face_to_descendants,
+    const hmesh_t& mesh,
+    const uint32_t face_count_prev,
+    const partitioned_faces_t& partitioned_faces,
+    const double& eps)
+{
+    // NOTE: a face may be partitioned more than once (i.e. its descendants too), and the new faces are in the order
+    // that they were added
+    std::unordered_map<fd_t, fd_t> new_face_to_ancestor;
+
+    for (std::vector<std::pair<fd_t, fd_t>>::const_iterator it = partitioned_faces.new_faces.cbegin(); it != partitioned_faces.new_faces.cend(); ++it) {
+        const fd_t ancestor = ((uint32_t)it->second < face_count_prev) ? it->second : SAFE_ACCESS(new_face_to_ancestor, it->second);
+        new_face_to_ancestor[it->first] = ancestor;
+
+        std::vector<fd_t>& descendants = face_to_descendants[ancestor];
+
+        if (descendants.empty()) {
+            descendants.push_back(ancestor); // ... which is now the first child face
+        }
+
+        descendants.push_back(it->first);
+        changed_faces.push_back(it->first);
+    }
+
+    changed_faces.insert(changed_faces.end(), partitioned_faces.retraced_faces.cbegin(), partitioned_faces.retraced_faces.cend());
+    std::sort(changed_faces.begin(), changed_faces.end());
+    changed_faces.erase(std::unique(changed_faces.begin(), changed_faces.end()), changed_faces.end());
+
+    MCUT_ASSERT(mesh.number_of_faces() == mesh.number_of_internal_faces()); // i.e. the descriptors of removed faces are re-used
+    face_aabb_array.resize(mesh.number_of_faces());
+
+    std::vector<vd_t> vertices_around_face;
+
+    for (std::vector<fd_t>::const_iterator f = changed_faces.cbegin(); f != changed_faces.cend(); ++f) {
+        bounding_box_t<vec3> bbox;
+        mesh.get_vertices_around_face(vertices_around_face, *f);
+
+        for (std::vector<vd_t>::const_iterator v = vertices_around_face.cbegin(); v != vertices_around_face.cend(); ++v) {
+            bbox.expand(mesh.vertex(*v));
+        }
+
+        if (eps > double(0.0)) {
+            bbox.enlarge(eps); // ... as when building the BVH
+        }
+
+        face_aabb_array[*f] = bbox;
+    }
+}
+
+// Update the candidate face pairs after polygon partitioning, instead of rebuilding the BVHs and traversing them again.
+// The faces that descend from a face (i.e. itself and those that were partitioned from it) lie on it, so they may only
+// intersect the faces that it may intersect and their descendants. Only the pairs with a changed face are tested (with
+// the updated bounding boxes) and the others are kept.
+void update_candidate_face_pairs(
+    const block_executor_t& for_each_block,
+    candidate_face_pairs_t& ps_face_to_potentially_intersecting_others,
+    const hmesh_t& source_hmesh,
+    const uint32_t source_hmesh_face_count_prev,
+    const partitioned_faces_t& source_hmesh_partitioned_faces,
+    std::vector<bounding_box_t<vec3>>& source_hmesh_face_aabb_array,
+    const hmesh_t& cut_hmesh,
+    const uint32_t cut_hmesh_face_count_prev,
+    const partitioned_faces_t& cut_hmesh_partitioned_faces,
+    std::vector<bounding_box_t<vec3>>& cut_hmesh_face_aabb_array,
+    const double& cut_hmesh_face_aabb_eps)
+{
+    std::vector<fd_t> source_hmesh_changed_faces;
+    std::unordered_map<fd_t, std::vector<fd_t>> source_hmesh_face_to_descendants;
+    update_partitioned_face_aabbs(source_hmesh_face_aabb_array, source_hmesh_changed_faces, source_hmesh_face_to_descendants, source_hmesh, source_hmesh_face_count_prev, source_hmesh_partitioned_faces, double(0.0));
+
+    std::vector<fd_t> cut_hmesh_changed_faces;
+    std::unordered_map<fd_t, std::vector<fd_t>> cut_hmesh_face_to_descendants;
+    update_partitioned_face_aabbs(cut_hmesh_face_aabb_array, cut_hmesh_changed_faces, cut_hmesh_face_to_descendants, cut_hmesh, cut_hmesh_face_count_prev, cut_hmesh_partitioned_faces, cut_hmesh_face_aabb_eps);
+
+    const uint32_t source_hmesh_face_count = (uint32_t)source_hmesh.number_of_faces();
+    const std::vector<fd_t>& ps_ifaces = ps_face_to_potentially_intersecting_others.faces();
+    // NOTE: the faces are sorted, so the source-mesh faces come first
+    const std::vector<fd_t>::const_iterator source_hmesh_ifaces_end = std::lower_bound(ps_ifaces.cbegin(), ps_ifaces.cend(), fd_t(source_hmesh_face_count_prev));
+
+    // the (source-mesh face, offsetted cut-mesh face) pairs
+    std::vector<std::pair<fd_t, fd_t>> face_pairs;
+    face_pairs.reserve((size_t)ps_face_to_potentially_intersecting_others.number_of_pairs());
+
+    for (std::vector<fd_t>::const_iterator i = ps_ifaces.cbegin(); i != source_hmesh_ifaces_end; ++i) {
+        const std::unordered_map<fd_t, std::vector<fd_t>>::const_iterator sm_descendants_iter = source_hmesh_face_to_descendants.find(*i);
+        const fd_t* sm_faces_begin = (sm_descendants_iter != source_hmesh_face_to_descendants.cend()) ? sm_descendants_iter->second.data() : &(*i);
+        const fd_t* sm_faces_end = (sm_descendants_iter != source_hmesh_face_to_descendants.cend()) ? sm_faces_begin + sm_descendants_iter->second.size() : sm_faces_begin + 1;
+
+        for (std::vector<fd_t>::const_iterator j = ps_face_to_potentially_intersecting_others.others_begin(*i); j != ps_face_to_potentially_intersecting_others.others_end(*i); ++j) {
+            const fd_t cm_face((uint32_t)*j - source_hmesh_face_count_prev);
+            const std::unordered_map<fd_t, std::vector<fd_t>>::const_iterator cm_descendants_iter = cut_hmesh_face_to_descendants.find(cm_face);
+            const fd_t* cm_faces_begin = (cm_descendants_iter != cut_hmesh_face_to_descendants.cend()) ? cm_descendants_iter->second.data() : &cm_face;
+            const fd_t* cm_faces_end = (cm_descendants_iter != cut_hmesh_face_to_descendants.cend()) ? cm_faces_begin + cm_descendants_iter->second.size() : cm_faces_begin + 1;
+
+            for (const fd_t* sm_face = sm_faces_begin; sm_face != sm_faces_end; ++sm_face) {
+                const bool sm_face_changed = std::binary_search(source_hmesh_changed_faces.cbegin(), source_hmesh_changed_faces.cend(), *sm_face);
+
+                for (const fd_t* cm_face_iter = cm_faces_begin; cm_face_iter != cm_faces_end; ++cm_face_iter) {
+                    const bool pair_changed = sm_face_changed || std::binary_search(cut_hmesh_changed_faces.cbegin(), cut_hmesh_changed_faces.cend(), *cm_face_iter);
+
+                    if (!pair_changed || intersect_bounding_boxes(SAFE_ACCESS(source_hmesh_face_aabb_array, *sm_face), SAFE_ACCESS(cut_hmesh_face_aabb_array, *cm_face_iter))) {
+                        face_pairs.push_back(std::make_pair(*sm_face, fd_t((uint32_t)*cm_face_iter + source_hmesh_face_count)));
+                    }
+                }
+            }
+        }
+    }
+
+    ps_face_to_potentially_intersecting_others.build(for_each_block, source_hmesh_face_count + (uint32_t)cut_hmesh.number_of_faces(), face_pairs);
+}
+#endif
+
+extern "C" void preproc_mesh(
+    std::unique_ptr<context_t>& context_uptr,
+    mesh_t& mesh,
+    McFlags flags,
+    const void* pVertices,
+    const uint32_t* pFaceIndices,
+    const uint32_t* pFaceSizes,
+    uint32_t numVertices,
+    uint32_t numFaces) noexcept(false)
+{
+    if (false == client_input_arrays_to_compact_hmesh(context_uptr, flags, mesh.compact_hmesh, mesh.hmesh_aabb_diag, pVertices, pFaceIndices, pFaceSizes, numVertices, numFaces)) {
+        throw std::invalid_argument("invalid source-mesh arrays");
+    }
+
+    if (false == check_input_mesh(context_uptr, mesh.compact_hmesh)) {
+        throw std::invalid_argument("invalid source-mesh connectivity");
+    }
+
+    mesh.client_vertex_count = numVertices;
+    mesh.client_face_count = numFaces;
+
+#if defined(USE_OIBVH)
+    // Construct BVH
+    // :::::::::::::
+
+    context_uptr->log(MC_DEBUG_SOURCE_API, MC_DEBUG_TYPE_OTHER, 0, MC_DEBUG_SEVERITY_NOTIFICATION, "Build source-mesh BVH");
+
+    if (flags & MC_DISPATCH_WIDE_BVH) {
+#if defined(MCUT_MULTI_THREADED)
+        const block_executor_t for_each_block(*context_uptr->scheduler, context_uptr->serial_execution_threshold.load());
+#else
+        const block_executor_t for_each_block;
+#endif
+        mesh.wide_bvh.build(for_each_block, mesh.compact_hmesh, mesh.face_aabb_array);
+    } else {
+        build_oibvh(
+#if defined(MCUT_MULTI_THREADED)
+            *context_uptr->scheduler,
+            context_uptr->serial_execution_threshold.load(),
+#endif
+            mesh.compact_hmesh,
+            mesh.bvh_aabb_array,
+            mesh.bvh_leafdata_array,
+            mesh.face_aabb_array);
+    }
+#endif // NOTE: otherwise the BVH is built from the kernel's hmesh_t (see: preproc)
+}
+
 extern "C" void preproc(
     std::unique_ptr<context_t>& context_uptr,
-    const void* pSrcMeshVertices,
-    const uint32_t* pSrcMeshFaceIndices,
-    const uint32_t* pSrcMeshFaceSizes,
-    uint32_t numSrcMeshVertices,
-    uint32_t numSrcMeshFaces,
+    std::map<McConnectedComponent, std::unique_ptr<connected_component_t, void (*)(connected_component_t*)>>& connected_components,
+    McFlags dispatchFlags,
+    mesh_t& source_mesh,
+    bool source_mesh_is_shared,
     const void* pCutMeshVertices,
     const uint32_t* pCutMeshFaceIndices,
     const uint32_t* pCutMeshFaceSizes,
     uint32_t numCutMeshVertices,
     uint32_t numCutMeshFaces) noexcept(false)
 {
+    // halfedge representation of the source mesh, which is built from the read-only copy kept by the mesh
+    // object, and may then be modified by polygon partitioning (see below)
     hmesh_t source_hmesh;
-    double source_hmesh_aabb_diag(0.0);
+    source_hmesh.build_from_compact(
+#if defined(MCUT_MULTI_THREADED)
+        *context_uptr->scheduler,
+        context_uptr->serial_execution_threshold.load(),
+#endif
+        source_mesh.compact_hmesh);
 
-    if (false == client_input_arrays_to_hmesh(context_uptr, source_hmesh, source_hmesh_aabb_diag, pSrcMeshVertices, pSrcMeshFaceIndices, pSrcMeshFaceSizes, numSrcMeshVertices, numSrcMeshFaces)) {
-        throw std::invalid_argument("invalid source-mesh arrays");
-    }
+#if defined(USE_OIBVH)
+    // NOTE: the face bounding boxes of a shared source mesh (i.e. from an McMesh) are left untouched. Polygon
+    // partitioning (see below) will instead update a copy of them, which is only made if the source mesh
+    // actually has a floating polygon.
+    std::vector<bounding_box_t<vec3>> source_hmesh_face_aabb_array_copy;
+    std::vector<bounding_box_t<vec3>>* source_hmesh_face_aabb_array_ptr = &source_mesh.face_aabb_array;
+#else
+    BoundingVolumeHierarchy source_hmesh_BVH;
+    source_hmesh_BVH.buildTree(source_hmesh);
+#endif
 
-    if (false == check_input_mesh(context_uptr, source_hmesh)) {
-        throw std::invalid_argument("invalid source-mesh connectivity");
-    }
+    const uint32_t numSrcMeshVertices = source_mesh.client_vertex_count;
+    const uint32_t numSrcMeshFaces = source_mesh.client_face_count;
 
     input_t kernel_input; // kernel/backend inpout
 
 #if defined(MCUT_MULTI_THREADED)
-    kernel_input.scheduler = &context_uptr->scheduler;
+    kernel_input.scheduler = context_uptr->scheduler.get();
+    kernel_input.serial_execution_threshold = context_uptr->serial_execution_threshold.load();
 #endif
 
     kernel_input.src_mesh = &source_hmesh;
@@ -1839,9 +2094,9 @@ extern "C" void preproc(
     kernel_input.require_looped_cutpaths = false;
 
     kernel_input.verbose = static_cast<bool>((context_uptr->flags & MC_DEBUG) && (context_uptr->debugType & MC_DEBUG_SOURCE_KERNEL));
-    kernel_input.require_looped_cutpaths = static_cast<bool>(context_uptr->dispatchFlags & MC_DISPATCH_REQUIRE_THROUGH_CUTS);
-    kernel_input.populate_vertex_maps = static_cast<bool>(context_uptr->dispatchFlags & MC_DISPATCH_INCLUDE_VERTEX_MAP);
-    kernel_input.populate_face_maps = static_cast<bool>(context_uptr->dispatchFlags & MC_DISPATCH_INCLUDE_FACE_MAP);
+    kernel_input.require_looped_cutpaths = static_cast<bool>(dispatchFlags & MC_DISPATCH_REQUIRE_THROUGH_CUTS);
+    kernel_input.populate_vertex_maps = static_cast<bool>(dispatchFlags & MC_DISPATCH_INCLUDE_VERTEX_MAP);
+    kernel_input.populate_face_maps = static_cast<bool>(dispatchFlags & MC_DISPATCH_INCLUDE_FACE_MAP);
 
     uint32_t dispatch_filter_flag_bitset_all = ( //
         MC_DISPATCH_FILTER_FRAGMENT_LOCATION_ABOVE | //
@@ -1855,19 +2110,19 @@ extern "C" void preproc(
         MC_DISPATCH_FILTER_SEAM_SRCMESH | //
         MC_DISPATCH_FILTER_SEAM_CUTMESH);
 
-    const bool dispatchFilteringEnabled = static_cast<bool>(context_uptr->dispatchFlags & dispatch_filter_flag_bitset_all); // any
+    const bool dispatchFilteringEnabled = static_cast<bool>(dispatchFlags & dispatch_filter_flag_bitset_all); // any
 
     if (dispatchFilteringEnabled) { // user only wants [some] output connected components
-        kernel_input.keep_fragments_below_cutmesh = static_cast<bool>(context_uptr->dispatchFlags & MC_DISPATCH_FILTER_FRAGMENT_LOCATION_BELOW);
-        kernel_input.keep_fragments_above_cutmesh = static_cast<bool>(context_uptr->dispatchFlags & MC_DISPATCH_FILTER_FRAGMENT_LOCATION_ABOVE);
-        kernel_input.keep_fragments_sealed_outside = static_cast<bool>(context_uptr->dispatchFlags & MC_DISPATCH_FILTER_FRAGMENT_SEALING_OUTSIDE);
-        kernel_input.keep_fragments_sealed_inside = static_cast<bool>(context_uptr->dispatchFlags & MC_DISPATCH_FILTER_FRAGMENT_SEALING_INSIDE);
-        kernel_input.keep_unsealed_fragments = static_cast<bool>(context_uptr->dispatchFlags & MC_DISPATCH_FILTER_FRAGMENT_SEALING_NONE);
-        kernel_input.keep_fragments_partially_cut = static_cast<bool>(context_uptr->dispatchFlags & MC_DISPATCH_FILTER_FRAGMENT_LOCATION_UNDEFINED);
-        kernel_input.keep_inside_patches = static_cast<bool>(context_uptr->dispatchFlags & MC_DISPATCH_FILTER_PATCH_INSIDE);
-        kernel_input.keep_outside_patches = static_cast<bool>(context_uptr->dispatchFlags & MC_DISPATCH_FILTER_PATCH_OUTSIDE);
-        kernel_input.keep_srcmesh_seam = static_cast<bool>(context_uptr->dispatchFlags & MC_DISPATCH_FILTER_SEAM_SRCMESH);
-        kernel_input.keep_cutmesh_seam = static_cast<bool>(context_uptr->dispatchFlags & MC_DISPATCH_FILTER_SEAM_CUTMESH);
+        kernel_input.keep_fragments_below_cutmesh = static_cast<bool>(dispatchFlags & MC_DISPATCH_FILTER_FRAGMENT_LOCATION_BELOW);
+        kernel_input.keep_fragments_above_cutmesh = static_cast<bool>(dispatchFlags & MC_DISPATCH_FILTER_FRAGMENT_LOCATION_ABOVE);
+        kernel_input.keep_fragments_sealed_outside = static_cast<bool>(dispatchFlags & MC_DISPATCH_FILTER_FRAGMENT_SEALING_OUTSIDE);
+        kernel_input.keep_fragments_sealed_inside = static_cast<bool>(dispatchFlags & MC_DISPATCH_FILTER_FRAGMENT_SEALING_INSIDE);
+        kernel_input.keep_unsealed_fragments = static_cast<bool>(dispatchFlags & MC_DISPATCH_FILTER_FRAGMENT_SEALING_NONE);
+        kernel_input.keep_fragments_partially_cut = static_cast<bool>(dispatchFlags & MC_DISPATCH_FILTER_FRAGMENT_LOCATION_UNDEFINED);
+        kernel_input.keep_inside_patches = static_cast<bool>(dispatchFlags & MC_DISPATCH_FILTER_PATCH_INSIDE);
+        kernel_input.keep_outside_patches = static_cast<bool>(dispatchFlags & MC_DISPATCH_FILTER_PATCH_OUTSIDE);
+        kernel_input.keep_srcmesh_seam = static_cast<bool>(dispatchFlags & MC_DISPATCH_FILTER_SEAM_SRCMESH);
+        kernel_input.keep_cutmesh_seam = static_cast<bool>(dispatchFlags & MC_DISPATCH_FILTER_SEAM_CUTMESH);
     } else { // compute all possible types of connected components
         kernel_input.keep_fragments_below_cutmesh = true;
         kernel_input.keep_fragments_above_cutmesh = true;
@@ -1883,22 +2138,10 @@ extern "C" void preproc(
         kernel_input.keep_cutmesh_seam = true;
     }
 
-    kernel_input.enforce_general_position = (0 != (context_uptr->dispatchFlags & MC_DISPATCH_ENFORCE_GENERAL_POSITION));
+    kernel_input.enforce_general_position = (0 != (dispatchFlags & MC_DISPATCH_ENFORCE_GENERAL_POSITION));
+    kernel_input.enforce_general_position_symbolically = (0 != (dispatchFlags & MC_DISPATCH_ENFORCE_GENERAL_POSITION_SYMBOLICALLY));
+    kernel_input.region_of_interest = (0 != (dispatchFlags & MC_DISPATCH_REGION_OF_INTEREST));
 
-    // Construct BVHs
-    // ::::::::::::::
-
-    context_uptr->log(MC_DEBUG_SOURCE_API, MC_DEBUG_TYPE_OTHER, 0, MC_DEBUG_SEVERITY_NOTIFICATION, "Build source-mesh BVH");
-
-#if defined(USE_OIBVH)
-    std::vector<bounding_box_t<vec3>> source_hmesh_BVH_aabb_array;
-    std::vector<fd_t> source_hmesh_BVH_leafdata_array;
-    std::vector<bounding_box_t<vec3>> source_hmesh_face_aabb_array;
-    build_oibvh(source_hmesh, source_hmesh_BVH_aabb_array, source_hmesh_BVH_leafdata_array, source_hmesh_face_aabb_array);
-#else
-    BoundingVolumeHierarchy source_hmesh_BVH;
-    source_hmesh_BVH.buildTree(source_hmesh);
-#endif
     context_uptr->log(MC_DEBUG_SOURCE_API, MC_DEBUG_TYPE_OTHER, 0, MC_DEBUG_SEVERITY_NOTIFICATION, "Build cut-mesh BVH");
 
     /*
@@ -1942,10 +2185,11 @@ extern "C" void preproc(
     output_t kernel_output;
 
     hmesh_t cut_hmesh; // halfedge representation of the cut-mesh
+    compact_hmesh_t cut_compact_hmesh; // read-only copy of "cut_hmesh" (see: check_input_mesh)
     double cut_hmesh_aabb_diag(0.0);
 
 #if defined(USE_OIBVH)
-    std::vector<bounding_box_t<vec3>> cut_hmesh_BVH_aabb_array;
+    oibvh_node_aabbs_t cut_hmesh_BVH_aabb_array;
     std::vector<fd_t> cut_hmesh_BVH_leafdata_array;
     std::vector<bounding_box_t<vec3>> cut_hmesh_face_face_aabb_array;
 #else
@@ -1954,7 +2198,7 @@ extern "C" void preproc(
 
     bool source_or_cut_hmesh_BVH_rebuilt = true; // i.e. used to determine whether we should retraverse BVHs
 
-    std::map<fd_t, std::vector<fd_t>> ps_face_to_potentially_intersecting_others; // result of BVH traversal
+    candidate_face_pairs_t ps_face_to_potentially_intersecting_others; // result of BVH traversal
 
 #if defined(MCUT_MULTI_THREADED)
     kernel_output.status.store(status_t::SUCCESS);
@@ -2030,6 +2274,10 @@ extern "C" void preproc(
             }
 
             cut_mesh_perturbation_count++;
+
+            if (g_dispatch_stats != nullptr) {
+                g_dispatch_stats->perturbation_count++;
+            }
         } // if (general_position_assumption_was_violated) {
 
         if ((cut_mesh_perturbation_count == 0 /*no perturbs required*/ || general_position_assumption_was_violated) && floating_polygon_was_detected == false) {
@@ -2044,19 +2292,29 @@ extern "C" void preproc(
             // "pCutMeshFaces" are simply the user provided faces
             // We must also use the newly added vertices (coords) due to polygon partitioning as "unperturbed" values
             // This will require some intricate mapping
-            if (false == client_input_arrays_to_hmesh(context_uptr, cut_hmesh, cut_hmesh_aabb_diag, pCutMeshVertices, pCutMeshFaceIndices, pCutMeshFaceSizes, numCutMeshVertices, numCutMeshFaces, ((cut_mesh_perturbation_count == 0) ? NULL : &perturbation))) {
+            if (false == client_input_arrays_to_hmesh(context_uptr, dispatchFlags, cut_hmesh, cut_hmesh_aabb_diag, pCutMeshVertices, pCutMeshFaceIndices, pCutMeshFaceSizes, numCutMeshVertices, numCutMeshFaces, ((cut_mesh_perturbation_count == 0) ? NULL : &perturbation))) {
                 throw std::invalid_argument("invalid cut-mesh arrays");
             }
 
             numerical_perturbation_constant = cut_hmesh_aabb_diag * GENERAL_POSITION_ENFORCMENT_CONSTANT;
 
             kernel_input.cut_mesh = &cut_hmesh;
+            cut_compact_hmesh.build(cut_hmesh);
 
             if (cut_mesh_perturbation_count == 0) { // i.e. first time we are invoking kernel intersect function
 #if defined(USE_OIBVH)
                 cut_hmesh_BVH_aabb_array.clear();
                 cut_hmesh_BVH_leafdata_array.clear();
-                build_oibvh(cut_hmesh, cut_hmesh_BVH_aabb_array, cut_hmesh_BVH_leafdata_array, cut_hmesh_face_face_aabb_array, numerical_perturbation_constant);
+                build_oibvh(
+#if defined(MCUT_MULTI_THREADED)
+                    *context_uptr->scheduler,
+                    context_uptr->serial_execution_threshold.load(),
+#endif
+                    cut_compact_hmesh,
+                    cut_hmesh_BVH_aabb_array,
+                    cut_hmesh_BVH_leafdata_array,
+                    cut_hmesh_face_face_aabb_array,
+                    numerical_perturbation_constant);
 #else
                 cut_hmesh_BVH.buildTree(cut_hmesh, numerical_perturbation_constant);
 #endif
@@ -2067,6 +2325,10 @@ extern "C" void preproc(
         TIMESTACK_PUSH("partition floating polygons");
         if (floating_polygon_was_detected) {
 
+            if (g_dispatch_stats != nullptr) {
+                g_dispatch_stats->floating_polygon_restart_count++;
+            }
+
             MCUT_ASSERT(general_position_assumption_was_violated == false); // cannot occur at same time (GP violation is detected before FPs)!
 
             // indicates whether a polygon was partitioned on the source mesh
@@ -2074,9 +2336,28 @@ extern "C" void preproc(
             // indicates whether a polygon was partitioned on the cut mesh
             bool cut_hmesh_modified = false;
 
+#if defined(USE_OIBVH)
+            if (source_mesh_is_shared && source_hmesh_face_aabb_array_ptr == &source_mesh.face_aabb_array) {
+                // is any floating polygon on the source mesh?
+                for (std::map<fd_t, std::vector<floating_polygon_info_t>>::const_iterator i = kernel_output.detected_floating_polygons.cbegin(); i != kernel_output.detected_floating_polygons.cend(); ++i) {
+                    if ((uint32_t)i->first < source_hmesh_face_count_prev) {
+                        source_hmesh_face_aabb_array_copy = source_mesh.face_aabb_array;
+                        source_hmesh_face_aabb_array_ptr = &source_hmesh_face_aabb_array_copy;
+                        break;
+                    }
+                }
+            }
+#endif
+
+            const uint32_t cut_hmesh_face_count_prev = (uint32_t)cut_hmesh.number_of_faces();
+            partitioned_faces_t source_hmesh_partitioned_faces;
+            partitioned_faces_t cut_hmesh_partitioned_faces;
+
             resolve_floating_polygons(
                 source_hmesh_modified,
                 cut_hmesh_modified,
+                source_hmesh_partitioned_faces,
+                cut_hmesh_partitioned_faces,
                 kernel_output.detected_floating_polygons,
                 source_hmesh_face_count_prev,
                 source_hmesh,
@@ -2086,41 +2367,57 @@ extern "C" void preproc(
                 source_hmesh_new_poly_partition_vertices.get()[0],
                 cut_hmesh_new_poly_partition_vertices);
 
+            MCUT_ASSERT(source_hmesh_modified || cut_hmesh_modified);
+
+            // partitioning does not change the closedness of the meshes
+            kernel_input.mesh_closedness_is_known = true;
+            kernel_input.src_mesh_is_closed = kernel_output.src_mesh_is_closed;
+            kernel_input.cut_mesh_is_closed = kernel_output.cut_mesh_is_closed;
+
+#if defined(USE_OIBVH)
+            // ::::::::::::::::::::::::::::::::::::::::::::
+            // update the candidate pairs of the partitioned faces (and of their neighbours)
+
+            // NOTE: the compact copies and the BVHs of the partitioned meshes are now out of date, but they are not used
+            // again during this dispatch (i.e. the meshes are only checked for defects once, and the BVHs are traversed
+            // once)
+#if defined(MCUT_MULTI_THREADED)
+            const block_executor_t for_each_block(*context_uptr->scheduler, context_uptr->serial_execution_threshold.load());
+#else
+            const block_executor_t for_each_block;
+#endif
+            update_candidate_face_pairs(
+                for_each_block,
+                ps_face_to_potentially_intersecting_others,
+                source_hmesh,
+                source_hmesh_face_count_prev,
+                source_hmesh_partitioned_faces,
+                *source_hmesh_face_aabb_array_ptr,
+                cut_hmesh,
+                cut_hmesh_face_count_prev,
+                cut_hmesh_partitioned_faces,
+                cut_hmesh_face_face_aabb_array,
+                numerical_perturbation_constant);
+
+            MCUT_ASSERT(!ps_face_to_potentially_intersecting_others.empty()); // ... since there is a floating polygon
+
+            if (g_dispatch_stats != nullptr) {
+                g_dispatch_stats->bvh_candidate_pair_count = ps_face_to_potentially_intersecting_others.number_of_pairs();
+            }
+#else
             // ::::::::::::::::::::::::::::::::::::::::::::
             // rebuild the BVH of "parent_face_hmesh_ptr" again
 
             if (source_hmesh_modified) {
-#if defined(USE_OIBVH)
-                source_hmesh_BVH_aabb_array.clear();
-                source_hmesh_BVH_leafdata_array.clear();
-                build_oibvh(
-                    source_hmesh,
-                    source_hmesh_BVH_aabb_array,
-                    source_hmesh_BVH_leafdata_array,
-                    source_hmesh_face_aabb_array);
-#else
                 source_hmesh_BVH.buildTree(source_hmesh);
-#endif
             }
 
             if (cut_hmesh_modified) {
-#if defined(USE_OIBVH)
-                cut_hmesh_BVH_aabb_array.clear();
-                cut_hmesh_BVH_leafdata_array.clear();
-                build_oibvh(
-                    cut_hmesh,
-                    cut_hmesh_BVH_aabb_array,
-                    cut_hmesh_BVH_leafdata_array,
-                    cut_hmesh_face_face_aabb_array,
-                    numerical_perturbation_constant);
-#else
                 cut_hmesh_BVH.buildTree(cut_hmesh, numerical_perturbation_constant);
-#endif
             }
 
-            source_or_cut_hmesh_BVH_rebuilt = source_hmesh_modified || cut_hmesh_modified;
-
-            MCUT_ASSERT(source_or_cut_hmesh_BVH_rebuilt == true);
+            source_or_cut_hmesh_BVH_rebuilt = true;
+#endif
 
             kernel_output.detected_floating_polygons.clear();
         } // if (floating_polygon_was_detected) {
@@ -2129,18 +2426,15 @@ extern "C" void preproc(
         // Check for mesh defects
         // ::::::::::::::::::::::
 
-        // NOTE: we check for defects here since both input meshes may be modified by the polygon partitioning process above.
-        // Partitiining is involked after atleast one dispatch call.
-        context_uptr->log(MC_DEBUG_SOURCE_API, MC_DEBUG_TYPE_OTHER, 0, MC_DEBUG_SEVERITY_NOTIFICATION, "Check source-mesh for defects");
-
-        if (false == check_input_mesh(context_uptr, source_hmesh)) {
-            throw std::invalid_argument("invalid source-mesh connectivity");
-        }
+        // NOTE: the polygon partitioning process above does not introduce defects (i.e. a partitioned face is split in
+        // two faces along an edge between two of its edges), so a mesh is only checked when it is (re)created. The
+        // source mesh was checked when it was created (see: preproc_mesh), and so only the cut mesh is checked here.
+        if (!floating_polygon_was_detected) {
+            context_uptr->log(MC_DEBUG_SOURCE_API, MC_DEBUG_TYPE_OTHER, 0, MC_DEBUG_SEVERITY_NOTIFICATION, "Check cut-mesh for defects");
 
-        context_uptr->log(MC_DEBUG_SOURCE_API, MC_DEBUG_TYPE_OTHER, 0, MC_DEBUG_SEVERITY_NOTIFICATION, "Check cut-mesh for defects");
-
-        if (false == check_input_mesh(context_uptr, cut_hmesh)) {
-            throw std::invalid_argument("invalid cut-mesh connectivity");
+            if (false == check_input_mesh(context_uptr, cut_compact_hmesh)) {
+                throw std::invalid_argument("invalid cut-mesh connectivity");
+            }
         }
 
         if (source_or_cut_hmesh_BVH_rebuilt) {
@@ -2151,11 +2445,32 @@ extern "C" void preproc(
 
             ps_face_to_potentially_intersecting_others.clear();
 #if defined(USE_OIBVH)
-            intersectOIBVHs(ps_face_to_potentially_intersecting_others, source_hmesh_BVH_aabb_array, source_hmesh_BVH_leafdata_array, cut_hmesh_BVH_aabb_array, cut_hmesh_BVH_leafdata_array);
+            if (!source_mesh.wide_bvh.empty()) {
+                intersectWideBVHAndOIBVH(
+#if defined(MCUT_MULTI_THREADED)
+                    *context_uptr->scheduler,
+                    context_uptr->serial_execution_threshold.load(),
+#endif
+                    ps_face_to_potentially_intersecting_others,
+                    source_mesh.wide_bvh,
+                    cut_hmesh_BVH_aabb_array,
+                    cut_hmesh_BVH_leafdata_array);
+            } else {
+                intersectOIBVHs(
+#if defined(MCUT_MULTI_THREADED)
+                    *context_uptr->scheduler,
+                    context_uptr->serial_execution_threshold.load(),
+#endif
+                    ps_face_to_potentially_intersecting_others,
+                    source_mesh.bvh_aabb_array,
+                    source_mesh.bvh_leafdata_array,
+                    cut_hmesh_BVH_aabb_array,
+                    cut_hmesh_BVH_leafdata_array);
+            }
 #else
             BoundingVolumeHierarchy::intersectBVHTrees(
 #if defined(MCUT_MULTI_THREADED)
-                context_uptr->scheduler,
+                *context_uptr->scheduler,
 #endif
                 ps_face_to_potentially_intersecting_others,
                 source_hmesh_BVH,
@@ -2170,7 +2485,11 @@ extern "C" void preproc(
                 MC_DEBUG_TYPE_OTHER,
                 0,
                 MC_DEBUG_SEVERITY_NOTIFICATION,
-                "Polygon-pairs found = " + std::to_string(ps_face_to_potentially_intersecting_others.size()));
+                "Polygon-pairs found = " + std::to_string(ps_face_to_potentially_intersecting_others.number_of_pairs()));
+
+            if (g_dispatch_stats != nullptr) {
+                g_dispatch_stats->bvh_candidate_pair_count = ps_face_to_potentially_intersecting_others.number_of_pairs();
+            }
 
             if (ps_face_to_potentially_intersecting_others.empty()) {
                 if (general_position_assumption_was_violated && cut_mesh_perturbation_count > 0) {
@@ -2192,7 +2511,7 @@ extern "C" void preproc(
         kernel_input.ps_face_to_potentially_intersecting_others = &ps_face_to_potentially_intersecting_others;
 
 #if defined(USE_OIBVH)
-        kernel_input.source_hmesh_face_aabb_array_ptr = &source_hmesh_face_aabb_array;
+        kernel_input.source_hmesh_face_aabb_array_ptr = source_hmesh_face_aabb_array_ptr;
         kernel_input.cut_hmesh_face_aabb_array_ptr = &cut_hmesh_face_face_aabb_array;
 #else
         kernel_input.source_hmesh_BVH = &source_hmesh_BVH;
@@ -2205,7 +2524,15 @@ extern "C" void preproc(
 
         try {
             context_uptr->log(MC_DEBUG_SOURCE_KERNEL, MC_DEBUG_TYPE_OTHER, 0, MC_DEBUG_SEVERITY_NOTIFICATION, "dispatch kernel");
+            const uint32_t stats_depth = (g_dispatch_stats != nullptr) ? (uint32_t)g_dispatch_stats->running_stages.size() : 0;
+            const uint32_t trace_depth = (g_trace != nullptr) ? g_trace->get_depth() : 0;
             dispatch(kernel_output, kernel_input);
+            if (g_dispatch_stats != nullptr) {
+                g_dispatch_stats->pop_stages(stats_depth); // the kernel returns early (i.e. mid-stage) if it must be restarted
+            }
+            if (g_trace != nullptr) {
+                g_trace->end_all(trace_depth);
+            }
         } catch (const std::exception& e) {
             fprintf(stderr, "fatal kernel exception caught : %s\n", e.what());
             throw e;
@@ -2279,8 +2606,8 @@ extern "C" void preproc(
 
                 std::unique_ptr<connected_component_t, void (*)(connected_component_t*)> frag = std::unique_ptr<fragment_cc_t, void (*)(connected_component_t*)>(new fragment_cc_t, fn_delete_cc<fragment_cc_t>);
                 McConnectedComponent clientHandle = reinterpret_cast<McConnectedComponent>(frag.get());
-                context_uptr->connected_components.emplace(clientHandle, std::move(frag));
-                fragment_cc_t* asFragPtr = dynamic_cast<fragment_cc_t*>(context_uptr->connected_components.at(clientHandle).get());
+                connected_components.emplace(clientHandle, std::move(frag));
+                fragment_cc_t* asFragPtr = dynamic_cast<fragment_cc_t*>(connected_components.at(clientHandle).get());
                 asFragPtr->type = MC_CONNECTED_COMPONENT_TYPE_FRAGMENT;
                 asFragPtr->fragmentLocation = convert(i->first);
                 asFragPtr->patchLocation = convert(j->first);
@@ -2333,8 +2660,8 @@ extern "C" void preproc(
 
             std::unique_ptr<connected_component_t, void (*)(connected_component_t*)> unsealedFrag = std::unique_ptr<fragment_cc_t, void (*)(connected_component_t*)>(new fragment_cc_t, fn_delete_cc<fragment_cc_t>);
             McConnectedComponent clientHandle = reinterpret_cast<McConnectedComponent>(unsealedFrag.get());
-            context_uptr->connected_components.emplace(clientHandle, std::move(unsealedFrag));
-            fragment_cc_t* asFragPtr = dynamic_cast<fragment_cc_t*>(context_uptr->connected_components.at(clientHandle).get());
+            connected_components.emplace(clientHandle, std::move(unsealedFrag));
+            fragment_cc_t* asFragPtr = dynamic_cast<fragment_cc_t*>(connected_components.at(clientHandle).get());
             asFragPtr->type = MC_CONNECTED_COMPONENT_TYPE_FRAGMENT;
             asFragPtr->fragmentLocation = convert(i->first);
             asFragPtr->patchLocation = McPatchLocation::MC_PATCH_LOCATION_UNDEFINED;
@@ -2384,8 +2711,8 @@ extern "C" void preproc(
 
         std::unique_ptr<connected_component_t, void (*)(connected_component_t*)> patchConnComp = std::unique_ptr<patch_cc_t, void (*)(connected_component_t*)>(new patch_cc_t, fn_delete_cc<patch_cc_t>);
         McConnectedComponent clientHandle = reinterpret_cast<McConnectedComponent>(patchConnComp.get());
-        context_uptr->connected_components.emplace(clientHandle, std::move(patchConnComp));
-        patch_cc_t* asPatchPtr = dynamic_cast<patch_cc_t*>(context_uptr->connected_components.at(clientHandle).get());
+        connected_components.emplace(clientHandle, std::move(patchConnComp));
+        patch_cc_t* asPatchPtr = dynamic_cast<patch_cc_t*>(connected_components.at(clientHandle).get());
         asPatchPtr->type = MC_CONNECTED_COMPONENT_TYPE_PATCH;
         asPatchPtr->patchLocation = MC_PATCH_LOCATION_INSIDE;
 
@@ -2428,8 +2755,8 @@ extern "C" void preproc(
 
         std::unique_ptr<connected_component_t, void (*)(connected_component_t*)> patchConnComp = std::unique_ptr<patch_cc_t, void (*)(connected_component_t*)>(new patch_cc_t, fn_delete_cc<patch_cc_t>);
         McConnectedComponent clientHandle = reinterpret_cast<McConnectedComponent>(patchConnComp.get());
-        context_uptr->connected_components.emplace(clientHandle, std::move(patchConnComp));
-        patch_cc_t* asPatchPtr = dynamic_cast<patch_cc_t*>(context_uptr->connected_components.at(clientHandle).get());
+        connected_components.emplace(clientHandle, std::move(patchConnComp));
+        patch_cc_t* asPatchPtr = dynamic_cast<patch_cc_t*>(connected_components.at(clientHandle).get());
         asPatchPtr->type = MC_CONNECTED_COMPONENT_TYPE_PATCH;
         asPatchPtr->patchLocation = MC_PATCH_LOCATION_OUTSIDE;
         asPatchPtr->kernel_hmesh_data = std::move(*it);
@@ -2469,8 +2796,8 @@ extern "C" void preproc(
         TIMESTACK_PUSH("store source-mesh seam");
         std::unique_ptr<connected_component_t, void (*)(connected_component_t*)> srcMeshSeam = std::unique_ptr<seam_cc_t, void (*)(connected_component_t*)>(new seam_cc_t, fn_delete_cc<seam_cc_t>);
         McConnectedComponent clientHandle = reinterpret_cast<McConnectedComponent>(srcMeshSeam.get());
-        context_uptr->connected_components.emplace(clientHandle, std::move(srcMeshSeam));
-        seam_cc_t* asSrcMeshSeamPtr = dynamic_cast<seam_cc_t*>(context_uptr->connected_components.at(clientHandle).get());
+        connected_components.emplace(clientHandle, std::move(srcMeshSeam));
+        seam_cc_t* asSrcMeshSeamPtr = dynamic_cast<seam_cc_t*>(connected_components.at(clientHandle).get());
         asSrcMeshSeamPtr->type = MC_CONNECTED_COMPONENT_TYPE_SEAM;
         asSrcMeshSeamPtr->origin = MC_SEAM_ORIGIN_SRCMESH;
 
@@ -2504,8 +2831,8 @@ extern "C" void preproc(
 
         std::unique_ptr<connected_component_t, void (*)(connected_component_t*)> cutMeshSeam = std::unique_ptr<seam_cc_t, void (*)(connected_component_t*)>(new seam_cc_t, fn_delete_cc<seam_cc_t>);
         McConnectedComponent clientHandle = reinterpret_cast<McConnectedComponent>(cutMeshSeam.get());
-        context_uptr->connected_components.emplace(clientHandle, std::move(cutMeshSeam));
-        seam_cc_t* asCutMeshSeamPtr = dynamic_cast<seam_cc_t*>(context_uptr->connected_components.at(clientHandle).get());
+        connected_components.emplace(clientHandle, std::move(cutMeshSeam));
+        seam_cc_t* asCutMeshSeamPtr = dynamic_cast<seam_cc_t*>(connected_components.at(clientHandle).get());
         asCutMeshSeamPtr->type = MC_CONNECTED_COMPONENT_TYPE_SEAM;
         asCutMeshSeamPtr->origin = MC_SEAM_ORIGIN_CUTMESH;
 
@@ -2540,8 +2867,8 @@ extern "C" void preproc(
         TIMESTACK_PUSH("store original cut-mesh");
         std::unique_ptr<connected_component_t, void (*)(connected_component_t*)> internalCutMesh = std::unique_ptr<input_cc_t, void (*)(connected_component_t*)>(new input_cc_t, fn_delete_cc<input_cc_t>);
         McConnectedComponent clientHandle = reinterpret_cast<McConnectedComponent>(internalCutMesh.get());
-        context_uptr->connected_components.emplace(clientHandle, std::move(internalCutMesh));
-        input_cc_t* asCutMeshInputPtr = dynamic_cast<input_cc_t*>(context_uptr->connected_components.at(clientHandle).get());
+        connected_components.emplace(clientHandle, std::move(internalCutMesh));
+        input_cc_t* asCutMeshInputPtr = dynamic_cast<input_cc_t*>(connected_components.at(clientHandle).get());
         asCutMeshInputPtr->type = MC_CONNECTED_COMPONENT_TYPE_INPUT;
         asCutMeshInputPtr->origin = MC_INPUT_ORIGIN_CUTMESH;
 
@@ -2600,8 +2927,8 @@ extern "C" void preproc(
         TIMESTACK_PUSH("store original src-mesh");
         std::unique_ptr<connected_component_t, void (*)(connected_component_t*)> internalSrcMesh = std::unique_ptr<input_cc_t, void (*)(connected_component_t*)>(new input_cc_t, fn_delete_cc<input_cc_t>);
         McConnectedComponent clientHandle = reinterpret_cast<McConnectedComponent>(internalSrcMesh.get());
-        context_uptr->connected_components.emplace(clientHandle, std::move(internalSrcMesh));
-        input_cc_t* asSrcMeshInputPtr = dynamic_cast<input_cc_t*>(context_uptr->connected_components.at(clientHandle).get());
+        connected_components.emplace(clientHandle, std::move(internalSrcMesh));
+        input_cc_t* asSrcMeshInputPtr = dynamic_cast<input_cc_t*>(connected_components.at(clientHandle).get());
         asSrcMeshInputPtr->type = MC_CONNECTED_COMPONENT_TYPE_INPUT;
         asSrcMeshInputPtr->origin = MC_INPUT_ORIGIN_SRCMESH;
 
@@ -0,0 +1,210 @@
+#include "mcut/internal/trace.h"
+
+#include <sstream>
+
+thread_local trace_t* g_trace = nullptr;
+
+trace_buffer_t::trace_buffer_t(uint32_t thread_index_, std::thread::id thread_id_)
+    : num_events(0)
+    , num_dropped_events(0)
+    , thread_index(thread_index_)
+    , thread_id(thread_id_)
+    , depth(0)
+{
+    for (uint32_t i = 0; i < max_chunks; ++i) {
+        chunks[i].store(nullptr);
+    }
+}
+
+trace_buffer_t::~trace_buffer_t()
+{
+    for (uint32_t i = 0; i < max_chunks; ++i) {
+        delete[] chunks[i].load();
+    }
+}
+
+void trace_buffer_t::record(const trace_event_t& event)
+{
+    const uint32_t index = num_events.load(std::memory_order_relaxed); // i.e. only this thread writes
+    const uint32_t chunk_index = index / chunk_size;
+
+    if (chunk_index == max_chunks) {
+        num_dropped_events.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    trace_event_t* chunk = chunks[chunk_index].load(std::memory_order_relaxed);
+
+    if (chunk == nullptr) {
+        chunk = new trace_event_t[chunk_size];
+        chunks[chunk_index].store(chunk, std::memory_order_release);
+    }
+
+    chunk[index % chunk_size] = event;
+
+    num_events.store(index + 1, std::memory_order_release); // publish
+}
+
+uint32_t trace_buffer_t::get_num_events() const
+{
+    return num_events.load(std::memory_order_acquire);
+}
+
+const trace_event_t& trace_buffer_t::get_event(uint32_t index) const
+{
+    return chunks[index / chunk_size].load(std::memory_order_acquire)[index % chunk_size];
+}
+
+uint32_t trace_buffer_t::get_num_dropped_events() const
+{
+    return num_dropped_events.load(std::memory_order_relaxed);
+}
+
+namespace {
+std::atomic<uint64_t> g_trace_counter(0);
+}
+
+trace_t::trace_t()
+    : m_id(g_trace_counter++)
+    , m_epoch(std::chrono::steady_clock::now())
+{
+}
+
+uint64_t trace_t::now() const
+{
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_epoch).count();
+}
+
+trace_buffer_t& trace_t::get_thread_buffer()
+{
+    // the buffer of the calling thread in the trace that it most recently recorded to. NOTE: only one trace is cached
+    // since (pool) threads may record to the traces of many contexts over their lifetime
+    static thread_local std::pair<uint64_t, trace_buffer_t*> thread_buffer(UINT64_MAX, nullptr);
+
+    if (thread_buffer.first == m_id) {
+        return *thread_buffer.second;
+    }
+
+    const std::thread::id thread_id = std::this_thread::get_id();
+
+    std::lock_guard<std::mutex> lock(m_buffers_mutex);
+
+    std::vector<std::unique_ptr<trace_buffer_t>>::const_iterator buffer_iter = m_buffers.cbegin();
+
+    while (buffer_iter != m_buffers.cend() && (*buffer_iter)->thread_id != thread_id) {
+        ++buffer_iter;
+    }
+
+    if (buffer_iter == m_buffers.cend()) { // first event of this thread
+        m_buffers.emplace_back(new trace_buffer_t((uint32_t)m_buffers.size(), thread_id));
+        buffer_iter = m_buffers.cend() - 1;
+    }
+
+    thread_buffer = std::make_pair(m_id, buffer_iter->get());
+
+    return *thread_buffer.second;
+}
+
+void trace_t::begin(const char* name, const char* detail)
+{
+    trace_buffer_t& buffer = get_thread_buffer();
+    const trace_event_t event = { name, detail, 'B', now(), 0 };
+    buffer.record(event);
+    buffer.depth++;
+}
+
+void trace_t::end()
+{
+    trace_buffer_t& buffer = get_thread_buffer();
+
+    if (buffer.depth == 0) {
+        return; // i.e. event began before tracing
+    }
+
+    const trace_event_t event = { nullptr, nullptr, 'E', now(), 0 };
+    buffer.record(event);
+    buffer.depth--;
+}
+
+void trace_t::end_all(uint32_t depth)
+{
+    while (get_depth() > depth) {
+        end();
+    }
+}
+
+uint32_t trace_t::get_depth()
+{
+    return get_thread_buffer().depth;
+}
+
+void trace_t::complete(const char* name, const char* detail, uint64_t start)
+{
+    const uint64_t end = now();
+    const trace_event_t event = { name, detail, 'X', start, end - start };
+    get_thread_buffer().record(event);
+}
+
+static void write_json_string(std::stringstream& ss, const char* str)
+{
+    ss << '"';
+
+    for (const char* c = str; *c != '\0'; ++c) {
+        if (*c == '"' || *c == '\\') {
+            ss << '\\';
+        }
+        ss << *c;
+    }
+
+    ss << '"';
+}
+
+std::string trace_t::to_json() const
+{
+    std::stringstream ss;
+    ss.precision(3);
+    ss << std::fixed;
+
+    ss << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+    bool first = true;
+
+    std::lock_guard<std::mutex> lock(m_buffers_mutex);
+
+    for (std::vector<std::unique_ptr<trace_buffer_t>>::const_iterator b = m_buffers.cbegin(); b != m_buffers.cend(); ++b) {
+        const trace_buffer_t& buffer = *(b->get());
+
+        ss << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << buffer.thread_index
+           << ",\"args\":{\"name\":\"thread " << buffer.thread_index << "\",\"dropped_events\":" << buffer.get_num_dropped_events() << "}}";
+        first = false;
+
+        const uint32_t num_events = buffer.get_num_events();
+
+        for (uint32_t i = 0; i < num_events; ++i) {
+            const trace_event_t& event = buffer.get_event(i);
+
+            ss << ",\n{\"ph\":\"" << event.phase << "\",\"pid\":0,\"tid\":" << buffer.thread_index << ",\"ts\":" << (double)event.timestamp_ns / 1000.0;
+
+            if (event.name != nullptr) {
+                ss << ",\"name\":";
+                write_json_string(ss, event.name);
+            }
+
+            if (event.phase == 'X') {
+                ss << ",\"dur\":" << (double)event.duration_ns / 1000.0;
+            }
+
+            if (event.detail != nullptr) {
+                ss << ",\"args\":{\"detail\":";
+                write_json_string(ss, event.detail);
+                ss << "}";
+            }
+
+            ss << "}";
+        }
+    }
+
+    ss << "\n]}\n";
+
+    return ss.str();
+}
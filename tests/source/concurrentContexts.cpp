@@ -0,0 +1,149 @@
+/**
+ * Copyright (c) 2021-2022 Floyd M. Chitalu.
+ * All rights reserved.
+ * 
+ * NOTE: This file is licensed under GPL-3.0-or-later (default). 
+ * A commercial license can be purchased from Floyd M. Chitalu. 
+ *  
+ * License details:
+ * 
+ * (A)  GNU General Public License ("GPL"); a copy of which you should have 
+ *      recieved with this file.
+ * 	    - see also: <http://www.gnu.org/licenses/>
+ * (B)  Commercial license.
+ *      - email: floyd.m.chitalu@gmail.com
+ * 
+ * The commercial license options is for users that wish to use MCUT in 
+ * their products for comercial purposes but do not wish to release their 
+ * software products under the GPL license. 
+ * 
+ * Author(s)     : Floyd M. Chitalu
+ */
+
+#include "utest.h"
+#include <atomic>
+#include <mcut/mcut.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "off.h"
+
+#ifdef _WIN32
+#pragma warning(disable : 26812) // Unscoped enums from mcut.h
+#endif // _WIN32
+
+#define NUM_THREADS 4
+#define NUM_DISPATCHES_PER_THREAD 2
+
+struct ConcurrentContexts {
+    float* pSrcMeshVertices = NULL;
+    uint32_t* pSrcMeshFaceIndices = NULL;
+    uint32_t* pSrcMeshFaceSizes = NULL;
+    uint32_t numSrcMeshVertices = 0;
+    uint32_t numSrcMeshFaces = 0;
+
+    float* pCutMeshVertices = NULL;
+    uint32_t* pCutMeshFaceIndices = NULL;
+    uint32_t* pCutMeshFaceSizes = NULL;
+    uint32_t numCutMeshVertices = 0;
+    uint32_t numCutMeshFaces = 0;
+};
+
+UTEST_F_SETUP(ConcurrentContexts)
+{
+    const std::string srcMeshPath = std::string(MESHES_DIR) + "/benchmarks/src-mesh014.off";
+
+    readOFF(srcMeshPath.c_str(), &utest_fixture->pSrcMeshVertices, &utest_fixture->pSrcMeshFaceIndices, &utest_fixture->pSrcMeshFaceSizes, &utest_fixture->numSrcMeshVertices, &utest_fixture->numSrcMeshFaces);
+
+    ASSERT_TRUE(utest_fixture->pSrcMeshVertices != nullptr);
+    ASSERT_GT((int)utest_fixture->numSrcMeshVertices, 2);
+    ASSERT_GT((int)utest_fixture->numSrcMeshFaces, 0);
+
+    const std::string cutMeshPath = std::string(MESHES_DIR) + "/benchmarks/cut-mesh014.off";
+
+    readOFF(cutMeshPath.c_str(), &utest_fixture->pCutMeshVertices, &utest_fixture->pCutMeshFaceIndices, &utest_fixture->pCutMeshFaceSizes, &utest_fixture->numCutMeshVertices, &utest_fixture->numCutMeshFaces);
+
+    ASSERT_TRUE(utest_fixture->pCutMeshVertices != nullptr);
+    ASSERT_GT((int)utest_fixture->numCutMeshVertices, 2);
+    ASSERT_GT((int)utest_fixture->numCutMeshFaces, 0);
+}
+
+UTEST_F_TEARDOWN(ConcurrentContexts)
+{
+    if (utest_fixture->pSrcMeshVertices)
+        free(utest_fixture->pSrcMeshVertices);
+
+    if (utest_fixture->pSrcMeshFaceIndices)
+        free(utest_fixture->pSrcMeshFaceIndices);
+
+    if (utest_fixture->pSrcMeshFaceSizes)
+        free(utest_fixture->pSrcMeshFaceSizes);
+
+    if (utest_fixture->pCutMeshVertices)
+        free(utest_fixture->pCutMeshVertices);
+
+    if (utest_fixture->pCutMeshFaceIndices)
+        free(utest_fixture->pCutMeshFaceIndices);
+
+    if (utest_fixture->pCutMeshFaceSizes)
+        free(utest_fixture->pCutMeshFaceSizes);
+}
+
+// Each thread creates its own context, uses it to cut the same meshes, and then releases it
+UTEST_F(ConcurrentContexts, oneContextPerThread)
+{
+    std::atomic<int> numFailures(0);
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < NUM_THREADS; ++t) {
+        threads.push_back(std::thread([&]() {
+            McContext context = MC_NULL_HANDLE;
+
+            if (mcCreateContext(&context, 0) != MC_NO_ERROR) {
+                numFailures++;
+                return;
+            }
+
+            for (int i = 0; i < NUM_DISPATCHES_PER_THREAD; ++i) {
+                McResult err = mcDispatch(
+                    context,
+                    MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+                    utest_fixture->pSrcMeshVertices,
+                    utest_fixture->pSrcMeshFaceIndices,
+                    utest_fixture->pSrcMeshFaceSizes,
+                    utest_fixture->numSrcMeshVertices,
+                    utest_fixture->numSrcMeshFaces,
+                    utest_fixture->pCutMeshVertices,
+                    utest_fixture->pCutMeshFaceIndices,
+                    utest_fixture->pCutMeshFaceSizes,
+                    utest_fixture->numCutMeshVertices,
+                    utest_fixture->numCutMeshFaces);
+
+                uint32_t numConnectedComponents = 0;
+
+                if (err == MC_NO_ERROR) {
+                    err = mcGetConnectedComponents(context, MC_CONNECTED_COMPONENT_TYPE_ALL, 0, NULL, &numConnectedComponents);
+                }
+
+                if (err != MC_NO_ERROR || numConnectedComponents != 12) { // see: DispatchFilterFlags.noFiltering
+                    numFailures++;
+                }
+
+                if (mcReleaseConnectedComponents(context, 0, NULL) != MC_NO_ERROR) {
+                    numFailures++;
+                }
+            }
+
+            if (mcReleaseContext(context) != MC_NO_ERROR) {
+                numFailures++;
+            }
+        }));
+    }
+
+    for (int t = 0; t < NUM_THREADS; ++t) {
+        threads[t].join();
+    }
+
+    ASSERT_EQ(numFailures.load(), 0);
+}
@@ -22,6 +22,7 @@
 
 #include "utest.h"
 #include <mcut/mcut.h>
+#include <string>
 #include "off.h"
 
 UTEST(CreateContext, noFlags)
@@ -79,3 +80,148 @@ UTEST_F(DebugContextConfig, setDebugCallbackMessageControl)
 {
     EXPECT_EQ(mcDebugMessageControl(utest_fixture->context_, McDebugSource::MC_DEBUG_SOURCE_ALL, McDebugType::MC_DEBUG_TYPE_ALL, McDebugSeverity::MC_DEBUG_SEVERITY_ALL, true), MC_NO_ERROR);
 }
+
+UTEST(CreateContext, withHelpers)
+{
+    McContext context = MC_NULL_HANDLE;
+    EXPECT_EQ(mcCreateContextWithHelpers(&context, 0, 2), MC_NO_ERROR);
+    EXPECT_TRUE(context != nullptr);
+    EXPECT_EQ(mcReleaseContext(context), MC_NO_ERROR);
+}
+
+// cut benchmark mesh pair 014 and return the number of resulting connected components
+static uint32_t dispatchBenchmark014(McContext context)
+{
+    float* pSrcMeshVertices = NULL;
+    uint32_t* pSrcMeshFaceIndices = NULL;
+    uint32_t* pSrcMeshFaceSizes = NULL;
+    uint32_t numSrcMeshVertices = 0;
+    uint32_t numSrcMeshFaces = 0;
+
+    readOFF((std::string(MESHES_DIR) + "/benchmarks/src-mesh014.off").c_str(), &pSrcMeshVertices, &pSrcMeshFaceIndices, &pSrcMeshFaceSizes, &numSrcMeshVertices, &numSrcMeshFaces);
+
+    float* pCutMeshVertices = NULL;
+    uint32_t* pCutMeshFaceIndices = NULL;
+    uint32_t* pCutMeshFaceSizes = NULL;
+    uint32_t numCutMeshVertices = 0;
+    uint32_t numCutMeshFaces = 0;
+
+    readOFF((std::string(MESHES_DIR) + "/benchmarks/cut-mesh014.off").c_str(), &pCutMeshVertices, &pCutMeshFaceIndices, &pCutMeshFaceSizes, &numCutMeshVertices, &numCutMeshFaces);
+
+    uint32_t numConnectedComponents = 0;
+
+    if (mcDispatch(
+            context,
+            MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+            pSrcMeshVertices,
+            pSrcMeshFaceIndices,
+            pSrcMeshFaceSizes,
+            numSrcMeshVertices,
+            numSrcMeshFaces,
+            pCutMeshVertices,
+            pCutMeshFaceIndices,
+            pCutMeshFaceSizes,
+            numCutMeshVertices,
+            numCutMeshFaces)
+        == MC_NO_ERROR) {
+        mcGetConnectedComponents(context, MC_CONNECTED_COMPONENT_TYPE_ALL, 0, NULL, &numConnectedComponents);
+    }
+
+    free(pSrcMeshVertices);
+    free(pSrcMeshFaceIndices);
+    free(pSrcMeshFaceSizes);
+    free(pCutMeshVertices);
+    free(pCutMeshFaceIndices);
+    free(pCutMeshFaceSizes);
+
+    return numConnectedComponents;
+}
+
+UTEST(CreateContext, withZeroHelpers)
+{
+    // single-threaded context
+    McContext context = MC_NULL_HANDLE;
+    ASSERT_EQ(mcCreateContextWithHelpers(&context, 0, 0), MC_NO_ERROR);
+    ASSERT_TRUE(context != nullptr);
+
+    uint32_t numHelperThreads = 1;
+    EXPECT_EQ(mcGetInfo(context, MC_CONTEXT_HELPER_THREAD_COUNT, sizeof(uint32_t), &numHelperThreads, nullptr), MC_NO_ERROR);
+    EXPECT_EQ(numHelperThreads, uint32_t(0));
+
+    EXPECT_EQ(dispatchBenchmark014(context), uint32_t(12)); // see: DispatchFilterFlags.noFiltering
+
+    EXPECT_EQ(mcReleaseContext(context), MC_NO_ERROR);
+}
+
+UTEST(CreateContext, serialExecutionThreshold)
+{
+    McContext context = MC_NULL_HANDLE;
+    ASSERT_EQ(mcCreateContextWithHelpers(&context, 0, 2), MC_NO_ERROR);
+
+    // the result must not depend on which stages are parallelised
+    const uint32_t thresholds[] = { 0, 1, 512, UINT32_MAX };
+
+    for (uint32_t i = 0; i < sizeof(thresholds) / sizeof(thresholds[0]); ++i) {
+        ASSERT_EQ(mcSetContextProperty(context, MC_CONTEXT_SERIAL_EXECUTION_THRESHOLD, sizeof(uint32_t), &thresholds[i]), MC_NO_ERROR);
+        EXPECT_EQ(dispatchBenchmark014(context), uint32_t(12));
+        EXPECT_EQ(mcReleaseConnectedComponents(context, 0, NULL), MC_NO_ERROR);
+    }
+
+    EXPECT_EQ(mcReleaseContext(context), MC_NO_ERROR);
+}
+
+UTEST(CreateContext, sharedThreadPool)
+{
+    McContext contexts[2] = { MC_NULL_HANDLE, MC_NULL_HANDLE };
+    ASSERT_EQ(mcCreateContext(&contexts[0], MC_CONTEXT_SHARED_THREAD_POOL), MC_NO_ERROR);
+    ASSERT_EQ(mcCreateContextWithHelpers(&contexts[1], MC_CONTEXT_SHARED_THREAD_POOL, 0), MC_NO_ERROR); // helper count is ignored
+
+    // releasing one context must not affect the other context that uses the shared pool
+    ASSERT_EQ(mcReleaseContext(contexts[0]), MC_NO_ERROR);
+
+    float* pSrcMeshVertices = NULL;
+    uint32_t* pSrcMeshFaceIndices = NULL;
+    uint32_t* pSrcMeshFaceSizes = NULL;
+    uint32_t numSrcMeshVertices = 0;
+    uint32_t numSrcMeshFaces = 0;
+
+    readOFF((std::string(MESHES_DIR) + "/benchmarks/src-mesh014.off").c_str(), &pSrcMeshVertices, &pSrcMeshFaceIndices, &pSrcMeshFaceSizes, &numSrcMeshVertices, &numSrcMeshFaces);
+    ASSERT_TRUE(pSrcMeshVertices != nullptr);
+
+    float* pCutMeshVertices = NULL;
+    uint32_t* pCutMeshFaceIndices = NULL;
+    uint32_t* pCutMeshFaceSizes = NULL;
+    uint32_t numCutMeshVertices = 0;
+    uint32_t numCutMeshFaces = 0;
+
+    readOFF((std::string(MESHES_DIR) + "/benchmarks/cut-mesh014.off").c_str(), &pCutMeshVertices, &pCutMeshFaceIndices, &pCutMeshFaceSizes, &numCutMeshVertices, &numCutMeshFaces);
+    ASSERT_TRUE(pCutMeshVertices != nullptr);
+
+    EXPECT_EQ(mcDispatch(
+                  contexts[1],
+                  MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+                  pSrcMeshVertices,
+                  pSrcMeshFaceIndices,
+                  pSrcMeshFaceSizes,
+                  numSrcMeshVertices,
+                  numSrcMeshFaces,
+                  pCutMeshVertices,
+                  pCutMeshFaceIndices,
+                  pCutMeshFaceSizes,
+                  numCutMeshVertices,
+                  numCutMeshFaces),
+        MC_NO_ERROR);
+
+    uint32_t numConnectedComponents = 0;
+    EXPECT_EQ(mcGetConnectedComponents(contexts[1], MC_CONNECTED_COMPONENT_TYPE_ALL, 0, NULL, &numConnectedComponents), MC_NO_ERROR);
+    EXPECT_EQ(uint32_t(12), numConnectedComponents); // see: DispatchFilterFlags.noFiltering
+
+    EXPECT_EQ(mcReleaseContext(contexts[1]), MC_NO_ERROR);
+
+    free(pSrcMeshVertices);
+    free(pSrcMeshFaceIndices);
+    free(pSrcMeshFaceSizes);
+    free(pCutMeshVertices);
+    free(pCutMeshFaceIndices);
+    free(pCutMeshFaceSizes);
+}
@@ -0,0 +1,305 @@
+/**
+ * Copyright (c) 2021-2022 Floyd M. Chitalu.
+ * All rights reserved.
+ * 
+ * NOTE: This file is licensed under GPL-3.0-or-later (default). 
+ * A commercial license can be purchased from Floyd M. Chitalu. 
+ *  
+ * License details:
+ * 
+ * (A)  GNU General Public License ("GPL"); a copy of which you should have 
+ *      recieved with this file.
+ * 	    - see also: <http://www.gnu.org/licenses/>
+ * (B)  Commercial license.
+ *      - email: floyd.m.chitalu@gmail.com
+ * 
+ * The commercial license options is for users that wish to use MCUT in 
+ * their products for comercial purposes but do not wish to release their 
+ * software products under the GPL license. 
+ * 
+ * Author(s)     : Floyd M. Chitalu
+ */
+
+#include "utest.h"
+#include <algorithm>
+#include <mcut/mcut.h>
+#include <string>
+#include <vector>
+
+#include "off.h"
+
+#ifdef _WIN32
+#pragma warning(disable : 26812) // Unscoped enums from mcut.h
+#endif // _WIN32
+
+struct CreateMesh {
+    McContext context_ = MC_NULL_HANDLE;
+    McMesh srcMesh_ = MC_NULL_HANDLE;
+
+    float* pSrcMeshVertices = NULL;
+    uint32_t* pSrcMeshFaceIndices = NULL;
+    uint32_t* pSrcMeshFaceSizes = NULL;
+    uint32_t numSrcMeshVertices = 0;
+    uint32_t numSrcMeshFaces = 0;
+
+    float* pCutMeshVertices = NULL;
+    uint32_t* pCutMeshFaceIndices = NULL;
+    uint32_t* pCutMeshFaceSizes = NULL;
+    uint32_t numCutMeshVertices = 0;
+    uint32_t numCutMeshFaces = 0;
+};
+
+UTEST_F_SETUP(CreateMesh)
+{
+    McResult err = mcCreateContext(&utest_fixture->context_, 0);
+    EXPECT_TRUE(utest_fixture->context_ != NULL);
+    EXPECT_EQ(err, MC_NO_ERROR);
+
+    utest_fixture->srcMesh_ = MC_NULL_HANDLE;
+
+    const std::string srcMeshPath = std::string(MESHES_DIR) + "/benchmarks/src-mesh014.off";
+
+    readOFF(srcMeshPath.c_str(), &utest_fixture->pSrcMeshVertices, &utest_fixture->pSrcMeshFaceIndices, &utest_fixture->pSrcMeshFaceSizes, &utest_fixture->numSrcMeshVertices, &utest_fixture->numSrcMeshFaces);
+
+    ASSERT_TRUE(utest_fixture->pSrcMeshVertices != nullptr);
+    ASSERT_TRUE(utest_fixture->pSrcMeshFaceIndices != nullptr);
+    ASSERT_TRUE(utest_fixture->pSrcMeshFaceSizes != nullptr);
+    ASSERT_GT((int)utest_fixture->numSrcMeshVertices, 2);
+    ASSERT_GT((int)utest_fixture->numSrcMeshFaces, 0);
+
+    const std::string cutMeshPath = std::string(MESHES_DIR) + "/benchmarks/cut-mesh014.off";
+
+    readOFF(cutMeshPath.c_str(), &utest_fixture->pCutMeshVertices, &utest_fixture->pCutMeshFaceIndices, &utest_fixture->pCutMeshFaceSizes, &utest_fixture->numCutMeshVertices, &utest_fixture->numCutMeshFaces);
+
+    ASSERT_TRUE(utest_fixture->pCutMeshVertices != nullptr);
+    ASSERT_TRUE(utest_fixture->pCutMeshFaceIndices != nullptr);
+    ASSERT_TRUE(utest_fixture->pCutMeshFaceSizes != nullptr);
+    ASSERT_GT((int)utest_fixture->numCutMeshVertices, 2);
+    ASSERT_GT((int)utest_fixture->numCutMeshFaces, 0);
+}
+
+UTEST_F_TEARDOWN(CreateMesh)
+{
+    if (utest_fixture->srcMesh_ != MC_NULL_HANDLE) {
+        EXPECT_EQ(mcReleaseMesh(utest_fixture->context_, utest_fixture->srcMesh_), MC_NO_ERROR);
+    }
+
+    EXPECT_EQ(mcReleaseContext(utest_fixture->context_), MC_NO_ERROR);
+
+    if (utest_fixture->pSrcMeshVertices)
+        free(utest_fixture->pSrcMeshVertices);
+
+    if (utest_fixture->pSrcMeshFaceIndices)
+        free(utest_fixture->pSrcMeshFaceIndices);
+
+    if (utest_fixture->pSrcMeshFaceSizes)
+        free(utest_fixture->pSrcMeshFaceSizes);
+
+    if (utest_fixture->pCutMeshVertices)
+        free(utest_fixture->pCutMeshVertices);
+
+    if (utest_fixture->pCutMeshFaceIndices)
+        free(utest_fixture->pCutMeshFaceIndices);
+
+    if (utest_fixture->pCutMeshFaceSizes)
+        free(utest_fixture->pCutMeshFaceSizes);
+}
+
+UTEST_F(CreateMesh, createAndRelease)
+{
+    McMesh mesh = MC_NULL_HANDLE;
+
+    ASSERT_EQ(mcCreateMesh(
+                  utest_fixture->context_,
+                  &mesh,
+                  MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+                  utest_fixture->pSrcMeshVertices,
+                  utest_fixture->pSrcMeshFaceIndices,
+                  utest_fixture->pSrcMeshFaceSizes,
+                  utest_fixture->numSrcMeshVertices,
+                  utest_fixture->numSrcMeshFaces),
+        MC_NO_ERROR);
+    ASSERT_TRUE(mesh != MC_NULL_HANDLE);
+
+    ASSERT_EQ(mcReleaseMesh(utest_fixture->context_, mesh), MC_NO_ERROR);
+    // the handle is no longer valid
+    ASSERT_EQ(mcReleaseMesh(utest_fixture->context_, mesh), MC_INVALID_VALUE);
+}
+
+UTEST_F(CreateMesh, vertexArrayTypeUnspecified)
+{
+    ASSERT_EQ(mcCreateMesh(
+                  utest_fixture->context_,
+                  &utest_fixture->srcMesh_,
+                  0,
+                  utest_fixture->pSrcMeshVertices,
+                  utest_fixture->pSrcMeshFaceIndices,
+                  utest_fixture->pSrcMeshFaceSizes,
+                  utest_fixture->numSrcMeshVertices,
+                  utest_fixture->numSrcMeshFaces),
+        MC_INVALID_VALUE);
+    ASSERT_TRUE(utest_fixture->srcMesh_ == MC_NULL_HANDLE);
+}
+
+UTEST_F(CreateMesh, dispatchMeshesRepeatedly)
+{
+    ASSERT_EQ(mcCreateMesh(
+                  utest_fixture->context_,
+                  &utest_fixture->srcMesh_,
+                  MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+                  utest_fixture->pSrcMeshVertices,
+                  utest_fixture->pSrcMeshFaceIndices,
+                  utest_fixture->pSrcMeshFaceSizes,
+                  utest_fixture->numSrcMeshVertices,
+                  utest_fixture->numSrcMeshFaces),
+        MC_NO_ERROR);
+
+    // the same source mesh object is re-used for each dispatch, which must give the
+    // same result as when passing the source-mesh arrays to mcDispatch
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_EQ(mcDispatchMeshes(
+                      utest_fixture->context_,
+                      MC_DISPATCH_VERTEX_ARRAY_FLOAT | MC_DISPATCH_INCLUDE_VERTEX_MAP | MC_DISPATCH_INCLUDE_FACE_MAP,
+                      utest_fixture->srcMesh_,
+                      utest_fixture->pCutMeshVertices,
+                      utest_fixture->pCutMeshFaceIndices,
+                      utest_fixture->pCutMeshFaceSizes,
+                      utest_fixture->numCutMeshVertices,
+                      utest_fixture->numCutMeshFaces),
+            MC_NO_ERROR);
+
+        uint32_t numConnectedComponents = 0;
+        ASSERT_EQ(mcGetConnectedComponents(utest_fixture->context_, MC_CONNECTED_COMPONENT_TYPE_ALL, 0, NULL, &numConnectedComponents), MC_NO_ERROR);
+        ASSERT_EQ(uint32_t(12), numConnectedComponents); // see: DispatchFilterFlags.noFiltering
+
+        std::vector<McConnectedComponent> connComps(numConnectedComponents, MC_NULL_HANDLE);
+        ASSERT_EQ(mcGetConnectedComponents(utest_fixture->context_, MC_CONNECTED_COMPONENT_TYPE_ALL, (uint32_t)connComps.size(), &connComps[0], NULL), MC_NO_ERROR);
+
+        for (uint32_t j = 0; j < numConnectedComponents; ++j) {
+            McConnectedComponent cc = connComps[j];
+            ASSERT_TRUE(cc != MC_NULL_HANDLE);
+
+            uint64_t numBytes = 0;
+            ASSERT_EQ(mcGetConnectedComponentData(utest_fixture->context_, cc, MC_CONNECTED_COMPONENT_DATA_FACE_MAP, 0, NULL, &numBytes), MC_NO_ERROR);
+            ASSERT_GT(numBytes, uint64_t(0));
+
+            std::vector<uint32_t> faceMap(numBytes / sizeof(uint32_t), 0);
+            ASSERT_EQ(mcGetConnectedComponentData(utest_fixture->context_, cc, MC_CONNECTED_COMPONENT_DATA_FACE_MAP, numBytes, &faceMap[0], NULL), MC_NO_ERROR);
+
+            for (uint32_t k = 0; k < (uint32_t)faceMap.size(); ++k) {
+                ASSERT_LT(faceMap[k], utest_fixture->numSrcMeshFaces + utest_fixture->numCutMeshFaces);
+            }
+        }
+
+        ASSERT_EQ(mcReleaseConnectedComponents(utest_fixture->context_, 0, NULL), MC_NO_ERROR);
+    }
+}
+
+// dispatch with the given source mesh object and return the number of vertices and the (sorted) face map of each
+// connected component (sorted)
+static bool dispatchMeshesAndGetFaceMaps(const CreateMesh* fixture, McMesh srcMesh, std::vector<std::pair<uint32_t, std::vector<uint32_t>>>& faceMaps)
+{
+    McResult err = mcDispatchMeshes(
+        fixture->context_,
+        MC_DISPATCH_VERTEX_ARRAY_FLOAT | MC_DISPATCH_INCLUDE_FACE_MAP,
+        srcMesh,
+        fixture->pCutMeshVertices,
+        fixture->pCutMeshFaceIndices,
+        fixture->pCutMeshFaceSizes,
+        fixture->numCutMeshVertices,
+        fixture->numCutMeshFaces);
+
+    uint32_t numConnectedComponents = 0;
+
+    if (err == MC_NO_ERROR) {
+        err = mcGetConnectedComponents(fixture->context_, MC_CONNECTED_COMPONENT_TYPE_ALL, 0, NULL, &numConnectedComponents);
+    }
+
+    if (err != MC_NO_ERROR || numConnectedComponents == 0) {
+        return false;
+    }
+
+    std::vector<McConnectedComponent> connComps(numConnectedComponents, MC_NULL_HANDLE);
+    err = mcGetConnectedComponents(fixture->context_, MC_CONNECTED_COMPONENT_TYPE_ALL, numConnectedComponents, &connComps[0], NULL);
+
+    faceMaps.resize(numConnectedComponents);
+
+    for (uint32_t i = 0; i < numConnectedComponents && err == MC_NO_ERROR; ++i) {
+        uint64_t numBytes = 0;
+        err = mcGetConnectedComponentData(fixture->context_, connComps[i], MC_CONNECTED_COMPONENT_DATA_VERTEX_FLOAT, 0, NULL, &numBytes);
+        faceMaps[i].first = (uint32_t)(numBytes / (sizeof(float) * 3));
+
+        if (err == MC_NO_ERROR) {
+            err = mcGetConnectedComponentData(fixture->context_, connComps[i], MC_CONNECTED_COMPONENT_DATA_FACE_MAP, 0, NULL, &numBytes);
+        }
+
+        if (err == MC_NO_ERROR) {
+            faceMaps[i].second.resize(numBytes / sizeof(uint32_t));
+            err = mcGetConnectedComponentData(fixture->context_, connComps[i], MC_CONNECTED_COMPONENT_DATA_FACE_MAP, numBytes, &faceMaps[i].second[0], NULL);
+            std::sort(faceMaps[i].second.begin(), faceMaps[i].second.end());
+        }
+    }
+
+    std::sort(faceMaps.begin(), faceMaps.end());
+
+    return mcReleaseConnectedComponents(fixture->context_, 0, NULL) == MC_NO_ERROR && err == MC_NO_ERROR;
+}
+
+UTEST_F(CreateMesh, dispatchMeshesWithWideBvh)
+{
+    ASSERT_EQ(mcCreateMesh(
+                  utest_fixture->context_,
+                  &utest_fixture->srcMesh_,
+                  MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+                  utest_fixture->pSrcMeshVertices,
+                  utest_fixture->pSrcMeshFaceIndices,
+                  utest_fixture->pSrcMeshFaceSizes,
+                  utest_fixture->numSrcMeshVertices,
+                  utest_fixture->numSrcMeshFaces),
+        MC_NO_ERROR);
+
+    McMesh wideBvhMesh = MC_NULL_HANDLE;
+
+    ASSERT_EQ(mcCreateMesh(
+                  utest_fixture->context_,
+                  &wideBvhMesh,
+                  MC_DISPATCH_VERTEX_ARRAY_FLOAT | MC_DISPATCH_WIDE_BVH,
+                  utest_fixture->pSrcMeshVertices,
+                  utest_fixture->pSrcMeshFaceIndices,
+                  utest_fixture->pSrcMeshFaceSizes,
+                  utest_fixture->numSrcMeshVertices,
+                  utest_fixture->numSrcMeshFaces),
+        MC_NO_ERROR);
+
+    // the kind of BVH must not change the result
+    std::vector<std::pair<uint32_t, std::vector<uint32_t>>> expected;
+    ASSERT_TRUE(dispatchMeshesAndGetFaceMaps(utest_fixture, utest_fixture->srcMesh_, expected));
+
+    std::vector<std::pair<uint32_t, std::vector<uint32_t>>> faceMaps;
+    ASSERT_TRUE(dispatchMeshesAndGetFaceMaps(utest_fixture, wideBvhMesh, faceMaps));
+
+    ASSERT_EQ(mcReleaseMesh(utest_fixture->context_, wideBvhMesh), MC_NO_ERROR);
+
+    ASSERT_EQ(faceMaps.size(), expected.size());
+
+    for (uint32_t i = 0; i < (uint32_t)faceMaps.size(); ++i) {
+        EXPECT_EQ(faceMaps[i].first, expected[i].first);
+        EXPECT_TRUE(faceMaps[i].second == expected[i].second);
+    }
+}
+
+UTEST_F(CreateMesh, dispatchMeshesWithInvalidMesh)
+{
+    McMesh invalidMesh = reinterpret_cast<McMesh>(utest_fixture->context_); // not a mesh object
+
+    ASSERT_EQ(mcDispatchMeshes(
+                  utest_fixture->context_,
+                  MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+                  invalidMesh,
+                  utest_fixture->pCutMeshVertices,
+                  utest_fixture->pCutMeshFaceIndices,
+                  utest_fixture->pCutMeshFaceSizes,
+                  utest_fixture->numCutMeshVertices,
+                  utest_fixture->numCutMeshFaces),
+        MC_INVALID_VALUE);
+}
@@ -21,6 +21,7 @@
  */
 
 #include "utest.h"
+#include <cstring>
 #include <mcut/mcut.h>
 #include <vector>
 
@@ -68,6 +69,79 @@ UTEST_F(DegenerateInput, edgeEdgeIntersection)
         MC_INVALID_OPERATION);
 }
 
+// Same as above, but the intersection is resolved by symbolic perturbation (i.e. without moving the cut-mesh).
+UTEST_F(DegenerateInput, edgeEdgeIntersectionSymbolicPerturbation)
+{
+    std::vector<float> srcMeshVertices = {
+        0.f, 0.f, 0.f,
+        3.f, 0.f, 0.f,
+        0.f, 3.f, 0.f
+    };
+
+    std::vector<uint32_t> srcMeshFaceIndices = { 0, 1, 2 };
+    uint32_t srcMeshFaceSizes = 3; // array of one
+
+    std::vector<float> cutMeshVertices = {
+        0.f, 2.f, -1.f,
+        3.f, 2.f, -1.f,
+        0.f, 2.f, 2.f
+    };
+
+    std::vector<uint32_t> cutMeshFaceIndices = { 0, 1, 2 };
+    uint32_t cutMeshFaceSizes = 3; // array of one
+
+    ASSERT_EQ(mcDispatch(utest_fixture->myContext, MC_DISPATCH_VERTEX_ARRAY_FLOAT | MC_DISPATCH_ENFORCE_GENERAL_POSITION_SYMBOLICALLY, //
+                  &srcMeshVertices[0], &srcMeshFaceIndices[0], &srcMeshFaceSizes, 3, 1, //
+                  &cutMeshVertices[0], &cutMeshFaceIndices[0], &cutMeshFaceSizes, 3, 1),
+        MC_NO_ERROR);
+
+    uint32_t numConnComps = 0;
+    ASSERT_EQ(mcGetConnectedComponents(utest_fixture->myContext, MC_CONNECTED_COMPONENT_TYPE_ALL, 0, NULL, &numConnComps), MC_NO_ERROR);
+    ASSERT_GT(numConnComps, uint32_t(0));
+}
+
+// A box that is cut by a smaller box whose top and bottom faces are coplanar with those of the first box. This is
+// done in one pass (i.e. without numerical perturbation) when symbolic perturbation is enabled.
+UTEST_F(DegenerateInput, coplanarFacesSymbolicPerturbation)
+{
+    std::vector<float> srcMeshVertices = {
+        0.f, 0.f, 0.f, 4.f, 0.f, 0.f, 4.f, 0.f, 1.f, 0.f, 0.f, 1.f,
+        4.f, 4.f, 0.f, 4.f, 4.f, 1.f, 0.f, 4.f, 0.f, 0.f, 4.f, 1.f
+    };
+
+    std::vector<float> cutMeshVertices = {
+        1.f, 1.f, 0.f, 3.f, 1.f, 0.f, 3.f, 1.f, 1.f, 1.f, 1.f, 1.f,
+        3.f, 3.f, 0.f, 3.f, 3.f, 1.f, 1.f, 3.f, 0.f, 1.f, 3.f, 1.f
+    };
+
+    // both boxes have the same connectivity
+    std::vector<uint32_t> faceIndices = {
+        0, 1, 2, 2, 3, 0, 1, 4, 5, 5, 2, 1,
+        4, 6, 7, 7, 5, 4, 6, 0, 3, 3, 7, 6,
+        0, 6, 4, 5, 7, 3, 4, 1, 0, 3, 2, 5
+    };
+    std::vector<uint32_t> faceSizes(12, 3);
+
+    McContext context = MC_NULL_HANDLE;
+    ASSERT_EQ(mcCreateContext(&context, MC_PROFILING_ENABLE), MC_NO_ERROR);
+
+    ASSERT_EQ(mcDispatch(context, MC_DISPATCH_VERTEX_ARRAY_FLOAT | MC_DISPATCH_ENFORCE_GENERAL_POSITION_SYMBOLICALLY, //
+                  &srcMeshVertices[0], &faceIndices[0], &faceSizes[0], 8, 12, //
+                  &cutMeshVertices[0], &faceIndices[0], &faceSizes[0], 8, 12),
+        MC_NO_ERROR);
+
+    McDispatchStats stats;
+    memset(&stats, 0xFF, sizeof(McDispatchStats));
+    ASSERT_EQ(mcGetInfo(context, MC_CONTEXT_DISPATCH_STATS, sizeof(McDispatchStats), &stats, nullptr), MC_NO_ERROR);
+    EXPECT_EQ(stats.perturbationCount, uint32_t(0));
+
+    uint32_t numConnComps = 0;
+    ASSERT_EQ(mcGetConnectedComponents(context, MC_CONNECTED_COMPONENT_TYPE_ALL, 0, NULL, &numConnComps), MC_NO_ERROR);
+    EXPECT_EQ(numConnComps, uint32_t(12));
+
+    ASSERT_EQ(mcReleaseContext(context), MC_NO_ERROR);
+}
+
 #if 0
 // An intersection between two triangles where a vertex from the cut-mesh triangle
 // lies on the src-mesh triangle.
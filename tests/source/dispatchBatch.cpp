@@ -0,0 +1,218 @@
+/**
+ * Copyright (c) 2021-2022 Floyd M. Chitalu.
+ * All rights reserved.
+ * 
+ * NOTE: This file is licensed under GPL-3.0-or-later (default). 
+ * A commercial license can be purchased from Floyd M. Chitalu. 
+ *  
+ * License details:
+ * 
+ * (A)  GNU General Public License ("GPL"); a copy of which you should have 
+ *      recieved with this file.
+ * 	    - see also: <http://www.gnu.org/licenses/>
+ * (B)  Commercial license.
+ *      - email: floyd.m.chitalu@gmail.com
+ * 
+ * The commercial license options is for users that wish to use MCUT in 
+ * their products for comercial purposes but do not wish to release their 
+ * software products under the GPL license. 
+ * 
+ * Author(s)     : Floyd M. Chitalu
+ */
+
+#include "utest.h"
+#include <mcut/mcut.h>
+#include <string>
+#include <vector>
+
+#include "off.h"
+
+#ifdef _WIN32
+#pragma warning(disable : 26812) // Unscoped enums from mcut.h
+#endif // _WIN32
+
+#define NUM_CUT_MESHES 4
+
+struct DispatchBatch {
+    McContext context_ = MC_NULL_HANDLE;
+    McMesh srcMesh_ = MC_NULL_HANDLE;
+
+    float* pSrcMeshVertices = NULL;
+    uint32_t* pSrcMeshFaceIndices = NULL;
+    uint32_t* pSrcMeshFaceSizes = NULL;
+    uint32_t numSrcMeshVertices = 0;
+    uint32_t numSrcMeshFaces = 0;
+
+    float* pCutMeshVertices = NULL;
+    uint32_t* pCutMeshFaceIndices = NULL;
+    uint32_t* pCutMeshFaceSizes = NULL;
+    uint32_t numCutMeshVertices = 0;
+    uint32_t numCutMeshFaces = 0;
+
+    // the same cut mesh is used for every entry of the batch
+    std::vector<const void*> cutMeshVertices;
+    std::vector<const uint32_t*> cutMeshFaceIndices;
+    std::vector<const uint32_t*> cutMeshFaceSizes;
+    std::vector<uint32_t> numCutMeshVerticesArray;
+    std::vector<uint32_t> numCutMeshFacesArray;
+};
+
+UTEST_F_SETUP(DispatchBatch)
+{
+    McResult err = mcCreateContext(&utest_fixture->context_, 0);
+    EXPECT_TRUE(utest_fixture->context_ != NULL);
+    EXPECT_EQ(err, MC_NO_ERROR);
+
+    const std::string srcMeshPath = std::string(MESHES_DIR) + "/benchmarks/src-mesh014.off";
+
+    readOFF(srcMeshPath.c_str(), &utest_fixture->pSrcMeshVertices, &utest_fixture->pSrcMeshFaceIndices, &utest_fixture->pSrcMeshFaceSizes, &utest_fixture->numSrcMeshVertices, &utest_fixture->numSrcMeshFaces);
+
+    ASSERT_TRUE(utest_fixture->pSrcMeshVertices != nullptr);
+    ASSERT_GT((int)utest_fixture->numSrcMeshVertices, 2);
+    ASSERT_GT((int)utest_fixture->numSrcMeshFaces, 0);
+
+    const std::string cutMeshPath = std::string(MESHES_DIR) + "/benchmarks/cut-mesh014.off";
+
+    readOFF(cutMeshPath.c_str(), &utest_fixture->pCutMeshVertices, &utest_fixture->pCutMeshFaceIndices, &utest_fixture->pCutMeshFaceSizes, &utest_fixture->numCutMeshVertices, &utest_fixture->numCutMeshFaces);
+
+    ASSERT_TRUE(utest_fixture->pCutMeshVertices != nullptr);
+    ASSERT_GT((int)utest_fixture->numCutMeshVertices, 2);
+    ASSERT_GT((int)utest_fixture->numCutMeshFaces, 0);
+
+    ASSERT_EQ(mcCreateMesh(
+                  utest_fixture->context_,
+                  &utest_fixture->srcMesh_,
+                  MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+                  utest_fixture->pSrcMeshVertices,
+                  utest_fixture->pSrcMeshFaceIndices,
+                  utest_fixture->pSrcMeshFaceSizes,
+                  utest_fixture->numSrcMeshVertices,
+                  utest_fixture->numSrcMeshFaces),
+        MC_NO_ERROR);
+
+    utest_fixture->cutMeshVertices.assign(NUM_CUT_MESHES, utest_fixture->pCutMeshVertices);
+    utest_fixture->cutMeshFaceIndices.assign(NUM_CUT_MESHES, utest_fixture->pCutMeshFaceIndices);
+    utest_fixture->cutMeshFaceSizes.assign(NUM_CUT_MESHES, utest_fixture->pCutMeshFaceSizes);
+    utest_fixture->numCutMeshVerticesArray.assign(NUM_CUT_MESHES, utest_fixture->numCutMeshVertices);
+    utest_fixture->numCutMeshFacesArray.assign(NUM_CUT_MESHES, utest_fixture->numCutMeshFaces);
+}
+
+UTEST_F_TEARDOWN(DispatchBatch)
+{
+    EXPECT_EQ(mcReleaseMesh(utest_fixture->context_, utest_fixture->srcMesh_), MC_NO_ERROR);
+    EXPECT_EQ(mcReleaseContext(utest_fixture->context_), MC_NO_ERROR);
+
+    if (utest_fixture->pSrcMeshVertices)
+        free(utest_fixture->pSrcMeshVertices);
+
+    if (utest_fixture->pSrcMeshFaceIndices)
+        free(utest_fixture->pSrcMeshFaceIndices);
+
+    if (utest_fixture->pSrcMeshFaceSizes)
+        free(utest_fixture->pSrcMeshFaceSizes);
+
+    if (utest_fixture->pCutMeshVertices)
+        free(utest_fixture->pCutMeshVertices);
+
+    if (utest_fixture->pCutMeshFaceIndices)
+        free(utest_fixture->pCutMeshFaceIndices);
+
+    if (utest_fixture->pCutMeshFaceSizes)
+        free(utest_fixture->pCutMeshFaceSizes);
+}
+
+UTEST_F(DispatchBatch, allCutMeshesValid)
+{
+    std::vector<McResult> results(NUM_CUT_MESHES, MC_RESULT_MAX_ENUM);
+
+    ASSERT_EQ(mcDispatchBatch(
+                  utest_fixture->context_,
+                  MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+                  utest_fixture->srcMesh_,
+                  NUM_CUT_MESHES,
+                  &utest_fixture->cutMeshVertices[0],
+                  &utest_fixture->cutMeshFaceIndices[0],
+                  &utest_fixture->cutMeshFaceSizes[0],
+                  &utest_fixture->numCutMeshVerticesArray[0],
+                  &utest_fixture->numCutMeshFacesArray[0],
+                  &results[0]),
+        MC_NO_ERROR);
+
+    uint32_t numConnectedComponents = 0;
+    ASSERT_EQ(mcGetConnectedComponents(utest_fixture->context_, MC_CONNECTED_COMPONENT_TYPE_ALL, 0, NULL, &numConnectedComponents), MC_NO_ERROR);
+    ASSERT_EQ(uint32_t(12 * NUM_CUT_MESHES), numConnectedComponents); // see: DispatchFilterFlags.noFiltering
+
+    for (uint32_t i = 0; i < NUM_CUT_MESHES; ++i) {
+        ASSERT_EQ(results[i], MC_NO_ERROR);
+
+        uint32_t numBatchConnectedComponents = 0;
+        ASSERT_EQ(mcGetBatchConnectedComponents(utest_fixture->context_, i, MC_CONNECTED_COMPONENT_TYPE_ALL, 0, NULL, &numBatchConnectedComponents), MC_NO_ERROR);
+        ASSERT_EQ(uint32_t(12), numBatchConnectedComponents);
+
+        std::vector<McConnectedComponent> connComps(numBatchConnectedComponents, MC_NULL_HANDLE);
+        ASSERT_EQ(mcGetBatchConnectedComponents(utest_fixture->context_, i, MC_CONNECTED_COMPONENT_TYPE_ALL, (uint32_t)connComps.size(), &connComps[0], NULL), MC_NO_ERROR);
+
+        for (uint32_t j = 0; j < numBatchConnectedComponents; ++j) {
+            ASSERT_TRUE(connComps[j] != MC_NULL_HANDLE);
+
+            uint64_t numBytes = 0;
+            ASSERT_EQ(mcGetConnectedComponentData(utest_fixture->context_, connComps[j], MC_CONNECTED_COMPONENT_DATA_VERTEX_FLOAT, 0, NULL, &numBytes), MC_NO_ERROR);
+            ASSERT_GT(numBytes, uint64_t(0));
+        }
+    }
+
+    // no cut mesh with this index in the batch
+    uint32_t numBatchConnectedComponents = 0;
+    ASSERT_EQ(mcGetBatchConnectedComponents(utest_fixture->context_, NUM_CUT_MESHES, MC_CONNECTED_COMPONENT_TYPE_ALL, 0, NULL, &numBatchConnectedComponents), MC_NO_ERROR);
+    ASSERT_EQ(uint32_t(0), numBatchConnectedComponents);
+}
+
+UTEST_F(DispatchBatch, oneCutMeshInvalid)
+{
+    std::vector<McResult> results(NUM_CUT_MESHES, MC_RESULT_MAX_ENUM);
+
+    utest_fixture->numCutMeshVerticesArray[1] = 2; // too few vertices
+
+    ASSERT_EQ(mcDispatchBatch(
+                  utest_fixture->context_,
+                  MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+                  utest_fixture->srcMesh_,
+                  NUM_CUT_MESHES,
+                  &utest_fixture->cutMeshVertices[0],
+                  &utest_fixture->cutMeshFaceIndices[0],
+                  &utest_fixture->cutMeshFaceSizes[0],
+                  &utest_fixture->numCutMeshVerticesArray[0],
+                  &utest_fixture->numCutMeshFacesArray[0],
+                  &results[0]),
+        MC_INVALID_VALUE);
+
+    // the other cut meshes are still processed
+    for (uint32_t i = 0; i < NUM_CUT_MESHES; ++i) {
+        uint32_t numBatchConnectedComponents = 0;
+        ASSERT_EQ(mcGetBatchConnectedComponents(utest_fixture->context_, i, MC_CONNECTED_COMPONENT_TYPE_ALL, 0, NULL, &numBatchConnectedComponents), MC_NO_ERROR);
+
+        if (i == 1) {
+            ASSERT_EQ(results[i], MC_INVALID_VALUE);
+            ASSERT_EQ(uint32_t(0), numBatchConnectedComponents);
+        } else {
+            ASSERT_EQ(results[i], MC_NO_ERROR);
+            ASSERT_EQ(uint32_t(12), numBatchConnectedComponents);
+        }
+    }
+}
+
+UTEST_F(DispatchBatch, zeroCutMeshes)
+{
+    ASSERT_EQ(mcDispatchBatch(
+                  utest_fixture->context_,
+                  MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+                  utest_fixture->srcMesh_,
+                  0,
+                  &utest_fixture->cutMeshVertices[0],
+                  &utest_fixture->cutMeshFaceIndices[0],
+                  &utest_fixture->cutMeshFaceSizes[0],
+                  &utest_fixture->numCutMeshVerticesArray[0],
+                  &utest_fixture->numCutMeshFacesArray[0],
+                  NULL),
+        MC_INVALID_VALUE);
+}
@@ -0,0 +1,159 @@
+/**
+ * Copyright (c) 2021-2022 Floyd M. Chitalu.
+ * All rights reserved.
+ * 
+ * NOTE: This file is licensed under GPL-3.0-or-later (default). 
+ * A commercial license can be purchased from Floyd M. Chitalu. 
+ *  
+ * License details:
+ * 
+ * (A)  GNU General Public License ("GPL"); a copy of which you should have 
+ *      recieved with this file.
+ * 	    - see also: <http://www.gnu.org/licenses/>
+ * (B)  Commercial license.
+ *      - email: floyd.m.chitalu@gmail.com
+ * 
+ * The commercial license options is for users that wish to use MCUT in 
+ * their products for comercial purposes but do not wish to release their 
+ * software products under the GPL license. 
+ * 
+ * Author(s)     : Floyd M. Chitalu
+ */
+
+#include "utest.h"
+#include <cstring>
+#include <mcut/mcut.h>
+#include <string>
+#include <vector>
+
+#include "off.h"
+
+#ifdef _WIN32
+#pragma warning(disable : 26812) // Unscoped enums from mcut.h
+#endif // _WIN32
+
+struct DispatchStats {
+    McContext context_ = MC_NULL_HANDLE;
+
+    float* pSrcMeshVertices = NULL;
+    uint32_t* pSrcMeshFaceIndices = NULL;
+    uint32_t* pSrcMeshFaceSizes = NULL;
+    uint32_t numSrcMeshVertices = 0;
+    uint32_t numSrcMeshFaces = 0;
+
+    float* pCutMeshVertices = NULL;
+    uint32_t* pCutMeshFaceIndices = NULL;
+    uint32_t* pCutMeshFaceSizes = NULL;
+    uint32_t numCutMeshVertices = 0;
+    uint32_t numCutMeshFaces = 0;
+};
+
+UTEST_F_SETUP(DispatchStats)
+{
+    McResult err = mcCreateContext(&utest_fixture->context_, MC_PROFILING_ENABLE);
+    EXPECT_TRUE(utest_fixture->context_ != NULL);
+    EXPECT_EQ(err, MC_NO_ERROR);
+
+    const std::string srcMeshPath = std::string(MESHES_DIR) + "/benchmarks/src-mesh014.off";
+
+    readOFF(srcMeshPath.c_str(), &utest_fixture->pSrcMeshVertices, &utest_fixture->pSrcMeshFaceIndices, &utest_fixture->pSrcMeshFaceSizes, &utest_fixture->numSrcMeshVertices, &utest_fixture->numSrcMeshFaces);
+
+    ASSERT_TRUE(utest_fixture->pSrcMeshVertices != nullptr);
+
+    const std::string cutMeshPath = std::string(MESHES_DIR) + "/benchmarks/cut-mesh014.off";
+
+    readOFF(cutMeshPath.c_str(), &utest_fixture->pCutMeshVertices, &utest_fixture->pCutMeshFaceIndices, &utest_fixture->pCutMeshFaceSizes, &utest_fixture->numCutMeshVertices, &utest_fixture->numCutMeshFaces);
+
+    ASSERT_TRUE(utest_fixture->pCutMeshVertices != nullptr);
+}
+
+UTEST_F_TEARDOWN(DispatchStats)
+{
+    EXPECT_EQ(mcReleaseContext(utest_fixture->context_), MC_NO_ERROR);
+
+    free(utest_fixture->pSrcMeshVertices);
+    free(utest_fixture->pSrcMeshFaceIndices);
+    free(utest_fixture->pSrcMeshFaceSizes);
+    free(utest_fixture->pCutMeshVertices);
+    free(utest_fixture->pCutMeshFaceIndices);
+    free(utest_fixture->pCutMeshFaceSizes);
+}
+
+UTEST_F(DispatchStats, noDispatch)
+{
+    McDispatchStats stats;
+    memset(&stats, 0xFF, sizeof(McDispatchStats));
+
+    ASSERT_EQ(mcGetInfo(utest_fixture->context_, MC_CONTEXT_DISPATCH_STATS, sizeof(McDispatchStats), &stats, nullptr), MC_NO_ERROR);
+    EXPECT_EQ(stats.totalTimeNanoseconds, uint64_t(0));
+    EXPECT_EQ(stats.stageCount, uint32_t(0));
+
+    uint64_t numBytes = 1;
+    ASSERT_EQ(mcGetInfo(utest_fixture->context_, MC_CONTEXT_DISPATCH_STAGE_TIMES, 0, nullptr, &numBytes), MC_NO_ERROR);
+    EXPECT_EQ(numBytes, uint64_t(0));
+}
+
+UTEST_F(DispatchStats, afterDispatch)
+{
+    ASSERT_EQ(mcDispatch(
+                  utest_fixture->context_,
+                  MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+                  utest_fixture->pSrcMeshVertices,
+                  utest_fixture->pSrcMeshFaceIndices,
+                  utest_fixture->pSrcMeshFaceSizes,
+                  utest_fixture->numSrcMeshVertices,
+                  utest_fixture->numSrcMeshFaces,
+                  utest_fixture->pCutMeshVertices,
+                  utest_fixture->pCutMeshFaceIndices,
+                  utest_fixture->pCutMeshFaceSizes,
+                  utest_fixture->numCutMeshVertices,
+                  utest_fixture->numCutMeshFaces),
+        MC_NO_ERROR);
+
+    uint64_t numBytes = 0;
+    ASSERT_EQ(mcGetInfo(utest_fixture->context_, MC_CONTEXT_DISPATCH_STATS, 0, nullptr, &numBytes), MC_NO_ERROR);
+    ASSERT_EQ(numBytes, sizeof(McDispatchStats));
+
+    McDispatchStats stats;
+    ASSERT_EQ(mcGetInfo(utest_fixture->context_, MC_CONTEXT_DISPATCH_STATS, numBytes, &stats, nullptr), MC_NO_ERROR);
+
+    EXPECT_GT(stats.totalTimeNanoseconds, uint64_t(0));
+    EXPECT_GT(stats.bvhCandidatePairCount, uint64_t(0));
+    EXPECT_GE(stats.peakVertexCount, utest_fixture->numSrcMeshVertices + utest_fixture->numCutMeshVertices);
+    EXPECT_GE(stats.peakFaceCount, utest_fixture->numSrcMeshFaces + utest_fixture->numCutMeshFaces);
+    EXPECT_GT(stats.peakEdgeCount, uint32_t(0));
+    ASSERT_GT(stats.stageCount, uint32_t(0));
+
+    ASSERT_EQ(mcGetInfo(utest_fixture->context_, MC_CONTEXT_DISPATCH_STAGE_TIMES, 0, nullptr, &numBytes), MC_NO_ERROR);
+    ASSERT_EQ(numBytes, stats.stageCount * sizeof(McDispatchStageTime));
+
+    std::vector<McDispatchStageTime> stageTimes(stats.stageCount);
+    ASSERT_EQ(mcGetInfo(utest_fixture->context_, MC_CONTEXT_DISPATCH_STAGE_TIMES, numBytes, &stageTimes[0], nullptr), MC_NO_ERROR);
+
+    bool foundClipPolygonsStage = false;
+
+    for (uint32_t i = 0; i < stats.stageCount; ++i) {
+        const McDispatchStageTime& stageTime = stageTimes[i];
+        EXPECT_GT(strlen(stageTime.name), (size_t)0);
+        EXPECT_GT(stageTime.callCount, uint32_t(0));
+        EXPECT_LE(stageTime.durationNanoseconds, stats.totalTimeNanoseconds);
+
+        if (std::string(stageTime.name) == "Clip polygons") {
+            foundClipPolygonsStage = true;
+            EXPECT_GT(stageTime.depth, uint32_t(0)); // i.e. inside the kernel stage
+        }
+    }
+
+    EXPECT_TRUE(foundClipPolygonsStage);
+}
+
+UTEST(DispatchStatsDisabled, queryWithoutProfiling)
+{
+    McContext context = MC_NULL_HANDLE;
+    ASSERT_EQ(mcCreateContext(&context, 0), MC_NO_ERROR);
+
+    McDispatchStats stats;
+    EXPECT_EQ(mcGetInfo(context, MC_CONTEXT_DISPATCH_STATS, sizeof(McDispatchStats), &stats, nullptr), MC_INVALID_OPERATION);
+
+    EXPECT_EQ(mcReleaseContext(context), MC_NO_ERROR);
+}
@@ -0,0 +1,394 @@
+/**
+ * Copyright (c) 2021-2022 Floyd M. Chitalu.
+ * All rights reserved.
+ * 
+ * NOTE: This file is licensed under GPL-3.0-or-later (default). 
+ * A commercial license can be purchased from Floyd M. Chitalu. 
+ *  
+ * License details:
+ * 
+ * (A)  GNU General Public License ("GPL"); a copy of which you should have 
+ *      recieved with this file.
+ * 	    - see also: <http://www.gnu.org/licenses/>
+ * (B)  Commercial license.
+ *      - email: floyd.m.chitalu@gmail.com
+ * 
+ * The commercial license options is for users that wish to use MCUT in 
+ * their products for comercial purposes but do not wish to release their 
+ * software products under the GPL license. 
+ * 
+ * Author(s)     : Floyd M. Chitalu
+ */
+
+#include "utest.h"
+#include <atomic>
+#include <chrono>
+#include <mcut/mcut.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "off.h"
+
+#ifdef _WIN32
+#pragma warning(disable : 26812) // Unscoped enums from mcut.h
+#endif // _WIN32
+
+#define NUM_EVENTS 3
+
+struct EnqueueDispatch {
+    McContext context_ = MC_NULL_HANDLE;
+
+    float* pSrcMeshVertices = NULL;
+    uint32_t* pSrcMeshFaceIndices = NULL;
+    uint32_t* pSrcMeshFaceSizes = NULL;
+    uint32_t numSrcMeshVertices = 0;
+    uint32_t numSrcMeshFaces = 0;
+
+    float* pCutMeshVertices = NULL;
+    uint32_t* pCutMeshFaceIndices = NULL;
+    uint32_t* pCutMeshFaceSizes = NULL;
+    uint32_t numCutMeshVertices = 0;
+    uint32_t numCutMeshFaces = 0;
+};
+
+UTEST_F_SETUP(EnqueueDispatch)
+{
+    McResult err = mcCreateContext(&utest_fixture->context_, 0);
+    EXPECT_TRUE(utest_fixture->context_ != NULL);
+    EXPECT_EQ(err, MC_NO_ERROR);
+
+    const std::string srcMeshPath = std::string(MESHES_DIR) + "/benchmarks/src-mesh014.off";
+
+    readOFF(srcMeshPath.c_str(), &utest_fixture->pSrcMeshVertices, &utest_fixture->pSrcMeshFaceIndices, &utest_fixture->pSrcMeshFaceSizes, &utest_fixture->numSrcMeshVertices, &utest_fixture->numSrcMeshFaces);
+
+    ASSERT_TRUE(utest_fixture->pSrcMeshVertices != nullptr);
+    ASSERT_GT((int)utest_fixture->numSrcMeshVertices, 2);
+    ASSERT_GT((int)utest_fixture->numSrcMeshFaces, 0);
+
+    const std::string cutMeshPath = std::string(MESHES_DIR) + "/benchmarks/cut-mesh014.off";
+
+    readOFF(cutMeshPath.c_str(), &utest_fixture->pCutMeshVertices, &utest_fixture->pCutMeshFaceIndices, &utest_fixture->pCutMeshFaceSizes, &utest_fixture->numCutMeshVertices, &utest_fixture->numCutMeshFaces);
+
+    ASSERT_TRUE(utest_fixture->pCutMeshVertices != nullptr);
+    ASSERT_GT((int)utest_fixture->numCutMeshVertices, 2);
+    ASSERT_GT((int)utest_fixture->numCutMeshFaces, 0);
+}
+
+UTEST_F_TEARDOWN(EnqueueDispatch)
+{
+    EXPECT_EQ(mcReleaseContext(utest_fixture->context_), MC_NO_ERROR);
+
+    if (utest_fixture->pSrcMeshVertices)
+        free(utest_fixture->pSrcMeshVertices);
+
+    if (utest_fixture->pSrcMeshFaceIndices)
+        free(utest_fixture->pSrcMeshFaceIndices);
+
+    if (utest_fixture->pSrcMeshFaceSizes)
+        free(utest_fixture->pSrcMeshFaceSizes);
+
+    if (utest_fixture->pCutMeshVertices)
+        free(utest_fixture->pCutMeshVertices);
+
+    if (utest_fixture->pCutMeshFaceIndices)
+        free(utest_fixture->pCutMeshFaceIndices);
+
+    if (utest_fixture->pCutMeshFaceSizes)
+        free(utest_fixture->pCutMeshFaceSizes);
+}
+
+void MCAPI_PTR countCompletedEvents(McEvent event, void* data)
+{
+    (void)event;
+    std::atomic<int>* counter = (std::atomic<int>*)data;
+    (*counter)++;
+}
+
+UTEST_F(EnqueueDispatch, enqueueAndWait)
+{
+    std::atomic<int> numCompletedEvents(0);
+    std::vector<McEvent> events(NUM_EVENTS, MC_NULL_HANDLE);
+
+    for (uint32_t i = 0; i < NUM_EVENTS; ++i) {
+        ASSERT_EQ(mcEnqueueDispatch(
+                      utest_fixture->context_,
+                      MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+                      utest_fixture->pSrcMeshVertices,
+                      utest_fixture->pSrcMeshFaceIndices,
+                      utest_fixture->pSrcMeshFaceSizes,
+                      utest_fixture->numSrcMeshVertices,
+                      utest_fixture->numSrcMeshFaces,
+                      utest_fixture->pCutMeshVertices,
+                      utest_fixture->pCutMeshFaceIndices,
+                      utest_fixture->pCutMeshFaceSizes,
+                      utest_fixture->numCutMeshVertices,
+                      utest_fixture->numCutMeshFaces,
+                      countCompletedEvents,
+                      &numCompletedEvents,
+                      &events[i]),
+            MC_NO_ERROR);
+        ASSERT_TRUE(events[i] != MC_NULL_HANDLE);
+    }
+
+    ASSERT_EQ(mcWaitForEvents(utest_fixture->context_, NUM_EVENTS, &events[0]), MC_NO_ERROR);
+
+    // the callbacks are invoked after the events are complete
+    while (numCompletedEvents.load() < NUM_EVENTS) {
+        std::this_thread::yield();
+    }
+
+    for (uint32_t i = 0; i < NUM_EVENTS; ++i) {
+        McEventCommandExecStatus status = MC_SUBMITTED;
+        ASSERT_EQ(mcGetEventInfo(utest_fixture->context_, events[i], MC_EVENT_COMMAND_EXECUTION_STATUS, sizeof(status), &status, NULL), MC_NO_ERROR);
+        ASSERT_EQ(status, MC_COMPLETE);
+
+        McResult result = MC_RESULT_MAX_ENUM;
+        ASSERT_EQ(mcGetEventInfo(utest_fixture->context_, events[i], MC_EVENT_RUNTIME_EXECUTION_STATUS, sizeof(result), &result, NULL), MC_NO_ERROR);
+        ASSERT_EQ(result, MC_NO_ERROR);
+
+        uint64_t numBytes = 0;
+        ASSERT_EQ(mcGetEventInfo(utest_fixture->context_, events[i], MC_EVENT_TIMESTAMP_START, 0, NULL, &numBytes), MC_NO_ERROR);
+        ASSERT_EQ(numBytes, (uint64_t)sizeof(uint64_t));
+
+        uint64_t submitted = 0;
+        uint64_t started = 0;
+        uint64_t ended = 0;
+        ASSERT_EQ(mcGetEventInfo(utest_fixture->context_, events[i], MC_EVENT_TIMESTAMP_SUBMIT, sizeof(uint64_t), &submitted, NULL), MC_NO_ERROR);
+        ASSERT_EQ(mcGetEventInfo(utest_fixture->context_, events[i], MC_EVENT_TIMESTAMP_START, sizeof(uint64_t), &started, NULL), MC_NO_ERROR);
+        ASSERT_EQ(mcGetEventInfo(utest_fixture->context_, events[i], MC_EVENT_TIMESTAMP_END, sizeof(uint64_t), &ended, NULL), MC_NO_ERROR);
+        ASSERT_GE(started, submitted);
+        ASSERT_GE(ended, started);
+    }
+
+    uint32_t numConnectedComponents = 0;
+    ASSERT_EQ(mcGetConnectedComponents(utest_fixture->context_, MC_CONNECTED_COMPONENT_TYPE_ALL, 0, NULL, &numConnectedComponents), MC_NO_ERROR);
+    ASSERT_EQ(uint32_t(12 * NUM_EVENTS), numConnectedComponents); // see: DispatchFilterFlags.noFiltering
+
+    ASSERT_EQ(mcReleaseEvents(utest_fixture->context_, NUM_EVENTS, &events[0]), MC_NO_ERROR);
+    // the handles are no longer valid
+    ASSERT_EQ(mcReleaseEvents(utest_fixture->context_, 1, &events[0]), MC_INVALID_VALUE);
+}
+
+struct ReleasingCallbackData {
+    McContext context;
+    std::atomic<int> numReleasedEvents;
+    std::atomic<int> numCompletedCallbacks;
+};
+
+void MCAPI_PTR releaseCompletedEvent(McEvent event, void* data)
+{
+    ReleasingCallbackData* callbackData = (ReleasingCallbackData*)data;
+
+    McEventCommandExecStatus status = MC_SUBMITTED;
+    McResult err = mcGetEventInfo(callbackData->context, event, MC_EVENT_COMMAND_EXECUTION_STATUS, sizeof(status), &status, NULL);
+
+    if (err == MC_NO_ERROR && status == MC_COMPLETE && mcReleaseEvents(callbackData->context, 1, &event) == MC_NO_ERROR) {
+        callbackData->numReleasedEvents++;
+    }
+
+    callbackData->numCompletedCallbacks++;
+}
+
+UTEST_F(EnqueueDispatch, releaseEventInCallback)
+{
+    ReleasingCallbackData callbackData;
+    callbackData.context = utest_fixture->context_;
+    callbackData.numReleasedEvents = 0;
+    callbackData.numCompletedCallbacks = 0;
+
+    for (uint32_t i = 0; i < NUM_EVENTS; ++i) {
+        McEvent event = MC_NULL_HANDLE;
+
+        ASSERT_EQ(mcEnqueueDispatch(
+                      utest_fixture->context_,
+                      MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+                      utest_fixture->pSrcMeshVertices,
+                      utest_fixture->pSrcMeshFaceIndices,
+                      utest_fixture->pSrcMeshFaceSizes,
+                      utest_fixture->numSrcMeshVertices,
+                      utest_fixture->numSrcMeshFaces,
+                      utest_fixture->pCutMeshVertices,
+                      utest_fixture->pCutMeshFaceIndices,
+                      utest_fixture->pCutMeshFaceSizes,
+                      utest_fixture->numCutMeshVertices,
+                      utest_fixture->numCutMeshFaces,
+                      releaseCompletedEvent,
+                      &callbackData,
+                      &event),
+            MC_NO_ERROR);
+    }
+
+    // the events cannot be waited for since the callbacks release them
+    while (callbackData.numCompletedCallbacks.load() < NUM_EVENTS) {
+        std::this_thread::yield();
+    }
+
+    ASSERT_EQ(callbackData.numReleasedEvents.load(), NUM_EVENTS);
+
+    uint32_t numConnectedComponents = 0;
+    ASSERT_EQ(mcGetConnectedComponents(utest_fixture->context_, MC_CONNECTED_COMPONENT_TYPE_ALL, 0, NULL, &numConnectedComponents), MC_NO_ERROR);
+    ASSERT_EQ(uint32_t(12 * NUM_EVENTS), numConnectedComponents);
+}
+
+void MCAPI_PTR releaseCompletedEventLater(McEvent event, void* data)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(10)); // i.e. so that the context is released meanwhile
+    releaseCompletedEvent(event, data);
+}
+
+UTEST_F(EnqueueDispatch, releaseContextWithCallbacksRunning)
+{
+    ReleasingCallbackData callbackData;
+    ASSERT_EQ(mcCreateContext(&callbackData.context, 0), MC_NO_ERROR);
+    callbackData.numReleasedEvents = 0;
+    callbackData.numCompletedCallbacks = 0;
+
+    for (uint32_t i = 0; i < NUM_EVENTS; ++i) {
+        McEvent event = MC_NULL_HANDLE;
+
+        ASSERT_EQ(mcEnqueueDispatch(
+                      callbackData.context,
+                      MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+                      utest_fixture->pSrcMeshVertices,
+                      utest_fixture->pSrcMeshFaceIndices,
+                      utest_fixture->pSrcMeshFaceSizes,
+                      utest_fixture->numSrcMeshVertices,
+                      utest_fixture->numSrcMeshFaces,
+                      utest_fixture->pCutMeshVertices,
+                      utest_fixture->pCutMeshFaceIndices,
+                      utest_fixture->pCutMeshFaceSizes,
+                      utest_fixture->numCutMeshVertices,
+                      utest_fixture->numCutMeshFaces,
+                      releaseCompletedEventLater,
+                      &callbackData,
+                      &event),
+            MC_NO_ERROR);
+    }
+
+    // waits for the dispatch calls and their callbacks
+    ASSERT_EQ(mcReleaseContext(callbackData.context), MC_NO_ERROR);
+    ASSERT_EQ(callbackData.numCompletedCallbacks.load(), NUM_EVENTS);
+    ASSERT_EQ(callbackData.numReleasedEvents.load(), NUM_EVENTS);
+}
+
+struct MatchingCallbackData {
+    McEvent event;
+    std::atomic<int> numMatchingEvents;
+    std::atomic<int> numCompletedCallbacks;
+};
+
+void MCAPI_PTR matchEventHandle(McEvent event, void* data)
+{
+    MatchingCallbackData* callbackData = (MatchingCallbackData*)data;
+
+    if (event == callbackData->event) {
+        callbackData->numMatchingEvents++;
+    }
+
+    callbackData->numCompletedCallbacks++;
+}
+
+UTEST_F(EnqueueDispatch, eventHandleIsSetBeforeCallback)
+{
+    MatchingCallbackData callbackData;
+    callbackData.event = MC_NULL_HANDLE;
+    callbackData.numMatchingEvents = 0;
+    callbackData.numCompletedCallbacks = 0;
+
+    ASSERT_EQ(mcEnqueueDispatch(
+                  utest_fixture->context_,
+                  MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+                  utest_fixture->pSrcMeshVertices,
+                  utest_fixture->pSrcMeshFaceIndices,
+                  utest_fixture->pSrcMeshFaceSizes,
+                  utest_fixture->numSrcMeshVertices,
+                  utest_fixture->numSrcMeshFaces,
+                  utest_fixture->pCutMeshVertices,
+                  utest_fixture->pCutMeshFaceIndices,
+                  utest_fixture->pCutMeshFaceSizes,
+                  utest_fixture->numCutMeshVertices,
+                  utest_fixture->numCutMeshFaces,
+                  matchEventHandle,
+                  &callbackData,
+                  &callbackData.event),
+        MC_NO_ERROR);
+
+    ASSERT_EQ(mcWaitForEvents(utest_fixture->context_, 1, &callbackData.event), MC_NO_ERROR);
+
+    while (callbackData.numCompletedCallbacks.load() < 1) {
+        std::this_thread::yield();
+    }
+
+    ASSERT_EQ(callbackData.numMatchingEvents.load(), 1);
+    ASSERT_EQ(mcReleaseEvents(utest_fixture->context_, 1, &callbackData.event), MC_NO_ERROR);
+}
+
+UTEST_F(EnqueueDispatch, failedDispatchIsReportedByEvent)
+{
+    McEvent event = MC_NULL_HANDLE;
+
+    // face indices refer to vertices that do not exist
+    ASSERT_EQ(mcEnqueueDispatch(
+                  utest_fixture->context_,
+                  MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+                  utest_fixture->pSrcMeshVertices,
+                  utest_fixture->pSrcMeshFaceIndices,
+                  utest_fixture->pSrcMeshFaceSizes,
+                  utest_fixture->numSrcMeshVertices,
+                  utest_fixture->numSrcMeshFaces,
+                  utest_fixture->pCutMeshVertices,
+                  utest_fixture->pCutMeshFaceIndices,
+                  utest_fixture->pCutMeshFaceSizes,
+                  3,
+                  utest_fixture->numCutMeshFaces,
+                  NULL,
+                  NULL,
+                  &event),
+        MC_NO_ERROR);
+
+    ASSERT_NE(mcWaitForEvents(utest_fixture->context_, 1, &event), MC_NO_ERROR);
+
+    McResult result = MC_NO_ERROR;
+    ASSERT_EQ(mcGetEventInfo(utest_fixture->context_, event, MC_EVENT_RUNTIME_EXECUTION_STATUS, sizeof(result), &result, NULL), MC_NO_ERROR);
+    ASSERT_NE(result, MC_NO_ERROR);
+
+    ASSERT_EQ(mcReleaseEvents(utest_fixture->context_, 1, &event), MC_NO_ERROR);
+}
+
+UTEST_F(EnqueueDispatch, releaseContextWithEventsInFlight)
+{
+    McEvent event = MC_NULL_HANDLE;
+
+    ASSERT_EQ(mcEnqueueDispatch(
+                  utest_fixture->context_,
+                  MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+                  utest_fixture->pSrcMeshVertices,
+                  utest_fixture->pSrcMeshFaceIndices,
+                  utest_fixture->pSrcMeshFaceSizes,
+                  utest_fixture->numSrcMeshVertices,
+                  utest_fixture->numSrcMeshFaces,
+                  utest_fixture->pCutMeshVertices,
+                  utest_fixture->pCutMeshFaceIndices,
+                  utest_fixture->pCutMeshFaceSizes,
+                  utest_fixture->numCutMeshVertices,
+                  utest_fixture->numCutMeshFaces,
+                  NULL,
+                  NULL,
+                  &event),
+        MC_NO_ERROR);
+
+    // the event is released together with the context in the teardown
+}
+
+UTEST_F(EnqueueDispatch, invalidEventInfo)
+{
+    McEvent event = MC_NULL_HANDLE;
+    uint64_t numBytes = 0;
+
+    ASSERT_EQ(mcGetEventInfo(utest_fixture->context_, event, MC_EVENT_COMMAND_EXECUTION_STATUS, 0, NULL, &numBytes), MC_INVALID_VALUE);
+
+    event = reinterpret_cast<McEvent>(utest_fixture->context_); // not an event object
+    ASSERT_EQ(mcGetEventInfo(utest_fixture->context_, event, MC_EVENT_COMMAND_EXECUTION_STATUS, 0, NULL, &numBytes), MC_INVALID_VALUE);
+    ASSERT_EQ(mcWaitForEvents(utest_fixture->context_, 1, &event), MC_INVALID_VALUE);
+}
@@ -42,3 +42,27 @@ UTEST_F_TEARDOWN(GetContextInfo)
     EXPECT_EQ(err, MC_NO_ERROR);
 }
 
+UTEST_F(GetContextInfo, serialExecutionThreshold)
+{
+    EXPECT_EQ(mcGetInfo(utest_fixture->context_, MC_CONTEXT_SERIAL_EXECUTION_THRESHOLD, 0, nullptr, &utest_fixture->bytes), MC_NO_ERROR);
+    EXPECT_EQ(utest_fixture->bytes, sizeof(uint32_t));
+
+    uint32_t threshold = 0;
+    EXPECT_EQ(mcGetInfo(utest_fixture->context_, MC_CONTEXT_SERIAL_EXECUTION_THRESHOLD, sizeof(uint32_t), &threshold, nullptr), MC_NO_ERROR);
+    EXPECT_EQ(threshold, uint32_t(512)); // default
+
+    const uint32_t newThreshold = 1 << 16;
+    EXPECT_EQ(mcSetContextProperty(utest_fixture->context_, MC_CONTEXT_SERIAL_EXECUTION_THRESHOLD, sizeof(uint32_t), &newThreshold), MC_NO_ERROR);
+    EXPECT_EQ(mcGetInfo(utest_fixture->context_, MC_CONTEXT_SERIAL_EXECUTION_THRESHOLD, sizeof(uint32_t), &threshold, nullptr), MC_NO_ERROR);
+    EXPECT_EQ(threshold, newThreshold);
+}
+
+UTEST_F(GetContextInfo, setInvalidProperty)
+{
+    const uint32_t value = 1;
+    // read-only
+    EXPECT_EQ(mcSetContextProperty(utest_fixture->context_, MC_CONTEXT_HELPER_THREAD_COUNT, sizeof(uint32_t), &value), MC_INVALID_VALUE);
+    // wrong size
+    EXPECT_EQ(mcSetContextProperty(utest_fixture->context_, MC_CONTEXT_SERIAL_EXECUTION_THRESHOLD, sizeof(uint64_t), &value), MC_INVALID_VALUE);
+    EXPECT_EQ(mcSetContextProperty(utest_fixture->context_, MC_CONTEXT_SERIAL_EXECUTION_THRESHOLD, sizeof(uint32_t), nullptr), MC_INVALID_VALUE);
+}
@@ -0,0 +1,251 @@
+/**
+ * Copyright (c) 2021-2022 Floyd M. Chitalu.
+ * All rights reserved.
+ * 
+ * NOTE: This file is licensed under GPL-3.0-or-later (default). 
+ * A commercial license can be purchased from Floyd M. Chitalu. 
+ *  
+ * License details:
+ * 
+ * (A)  GNU General Public License ("GPL"); a copy of which you should have 
+ *      recieved with this file.
+ * 	    - see also: <http://www.gnu.org/licenses/>
+ * (B)  Commercial license.
+ *      - email: floyd.m.chitalu@gmail.com
+ * 
+ * The commercial license options is for users that wish to use MCUT in 
+ * their products for comercial purposes but do not wish to release their 
+ * software products under the GPL license. 
+ * 
+ * Author(s)     : Floyd M. Chitalu
+ */
+
+
+#include "utest.h"
+#include <algorithm>
+#include <cstring>
+#include <mcut/mcut.h>
+#include <string>
+#include <vector>
+
+#include "off.h"
+
+#ifdef _WIN32
+#pragma warning(disable : 26812) // Unscoped enums from mcut.h
+#endif // _WIN32
+
+// what is compared between the connected components of a dispatch with and without MC_DISPATCH_REGION_OF_INTEREST
+struct ConnectedComponentSignature {
+    McConnectedComponentType type;
+    uint32_t numVertices;
+    std::vector<uint32_t> faceMap; // sorted
+
+    bool operator<(const ConnectedComponentSignature& other) const
+    {
+        if (type != other.type) {
+            return type < other.type;
+        }
+        if (numVertices != other.numVertices) {
+            return numVertices < other.numVertices;
+        }
+        return faceMap < other.faceMap;
+    }
+
+    bool operator==(const ConnectedComponentSignature& other) const
+    {
+        return type == other.type && numVertices == other.numVertices && faceMap == other.faceMap;
+    }
+};
+
+struct RegionOfInterest {
+    McContext context_ = MC_NULL_HANDLE;
+
+    float* pSrcMeshVertices = NULL;
+    uint32_t* pSrcMeshFaceIndices = NULL;
+    uint32_t* pSrcMeshFaceSizes = NULL;
+    uint32_t numSrcMeshVertices = 0;
+    uint32_t numSrcMeshFaces = 0;
+
+    std::vector<float> cutMeshVertices;
+    std::vector<uint32_t> cutMeshFaceIndices;
+    std::vector<uint32_t> cutMeshFaceSizes;
+};
+
+UTEST_F_SETUP(RegionOfInterest)
+{
+    McResult err = mcCreateContext(&utest_fixture->context_, MC_PROFILING_ENABLE);
+    EXPECT_TRUE(utest_fixture->context_ != NULL);
+    EXPECT_EQ(err, MC_NO_ERROR);
+
+    const std::string srcMeshPath = std::string(MESHES_DIR) + "/bunny.off";
+
+    readOFF(srcMeshPath.c_str(), &utest_fixture->pSrcMeshVertices, &utest_fixture->pSrcMeshFaceIndices, &utest_fixture->pSrcMeshFaceSizes, &utest_fixture->numSrcMeshVertices, &utest_fixture->numSrcMeshFaces);
+
+    ASSERT_TRUE(utest_fixture->pSrcMeshVertices != nullptr);
+    ASSERT_GT((int)utest_fixture->numSrcMeshVertices, 2);
+    ASSERT_GT((int)utest_fixture->numSrcMeshFaces, 0);
+}
+
+UTEST_F_TEARDOWN(RegionOfInterest)
+{
+    EXPECT_EQ(mcReleaseContext(utest_fixture->context_), MC_NO_ERROR);
+
+    free(utest_fixture->pSrcMeshVertices);
+    free(utest_fixture->pSrcMeshFaceIndices);
+    free(utest_fixture->pSrcMeshFaceSizes);
+}
+
+// a (small) cube centered at "c", with half-width "h"
+void createCube(const float c[3], float h, std::vector<float>& vertices, std::vector<uint32_t>& faceIndices, std::vector<uint32_t>& faceSizes)
+{
+    vertices.clear();
+
+    for (int i = 0; i < 8; ++i) {
+        vertices.push_back(c[0] + ((i & 1) ? h : -h));
+        vertices.push_back(c[1] + ((i & 2) ? h : -h));
+        vertices.push_back(c[2] + ((i & 4) ? h : -h));
+    }
+
+    const uint32_t quads[] = {
+        0, 2, 3, 1, // -z
+        4, 5, 7, 6, // +z
+        0, 1, 5, 4, // -y
+        2, 6, 7, 3, // +y
+        0, 4, 6, 2, // -x
+        1, 3, 7, 5 // +x
+    };
+
+    faceIndices.assign(quads, quads + 24);
+    faceSizes.assign(6, 4);
+}
+
+// dispatch and return the signatures of the resulting connected components (sorted), and whether the region of
+// interest was used
+bool dispatchAndGetSignatures(const RegionOfInterest* fixture, McFlags flags, std::vector<ConnectedComponentSignature>& signatures, bool& usedRegionOfInterest)
+{
+    McResult err = mcDispatch(
+        fixture->context_,
+        MC_DISPATCH_VERTEX_ARRAY_FLOAT | MC_DISPATCH_INCLUDE_FACE_MAP | MC_DISPATCH_ENFORCE_GENERAL_POSITION | flags,
+        fixture->pSrcMeshVertices,
+        fixture->pSrcMeshFaceIndices,
+        fixture->pSrcMeshFaceSizes,
+        fixture->numSrcMeshVertices,
+        fixture->numSrcMeshFaces,
+        &fixture->cutMeshVertices[0],
+        &fixture->cutMeshFaceIndices[0],
+        &fixture->cutMeshFaceSizes[0],
+        (uint32_t)(fixture->cutMeshVertices.size() / 3),
+        (uint32_t)fixture->cutMeshFaceSizes.size());
+
+    if (err != MC_NO_ERROR) {
+        return false;
+    }
+
+    McDispatchStats stats;
+    err = mcGetInfo(fixture->context_, MC_CONTEXT_DISPATCH_STATS, sizeof(McDispatchStats), &stats, NULL);
+
+    if (err != MC_NO_ERROR) {
+        return false;
+    }
+
+    std::vector<McDispatchStageTime> stageTimes(stats.stageCount);
+    err = mcGetInfo(fixture->context_, MC_CONTEXT_DISPATCH_STAGE_TIMES, stageTimes.size() * sizeof(McDispatchStageTime), &stageTimes[0], NULL);
+
+    if (err != MC_NO_ERROR) {
+        return false;
+    }
+
+    usedRegionOfInterest = false;
+
+    for (uint32_t i = 0; i < stats.stageCount; ++i) {
+        if (std::string(stageTimes[i].name) == "Reattach faces outside region of interest") {
+            usedRegionOfInterest = true;
+        }
+    }
+
+    uint32_t numConnectedComponents = 0;
+    err = mcGetConnectedComponents(fixture->context_, MC_CONNECTED_COMPONENT_TYPE_ALL, 0, NULL, &numConnectedComponents);
+
+    if (err != MC_NO_ERROR || numConnectedComponents == 0) {
+        return false;
+    }
+
+    std::vector<McConnectedComponent> connComps(numConnectedComponents);
+    err = mcGetConnectedComponents(fixture->context_, MC_CONNECTED_COMPONENT_TYPE_ALL, numConnectedComponents, &connComps[0], NULL);
+
+    if (err != MC_NO_ERROR) {
+        return false;
+    }
+
+    signatures.resize(numConnectedComponents);
+
+    for (uint32_t i = 0; i < numConnectedComponents && err == MC_NO_ERROR; ++i) {
+        ConnectedComponentSignature& signature = signatures[i];
+        uint64_t numBytes = 0;
+
+        err = mcGetConnectedComponentData(fixture->context_, connComps[i], MC_CONNECTED_COMPONENT_DATA_TYPE, sizeof(McConnectedComponentType), &signature.type, NULL);
+
+        if (err == MC_NO_ERROR) {
+            err = mcGetConnectedComponentData(fixture->context_, connComps[i], MC_CONNECTED_COMPONENT_DATA_VERTEX_FLOAT, 0, NULL, &numBytes);
+            signature.numVertices = (uint32_t)(numBytes / (sizeof(float) * 3));
+        }
+
+        if (err == MC_NO_ERROR) {
+            err = mcGetConnectedComponentData(fixture->context_, connComps[i], MC_CONNECTED_COMPONENT_DATA_FACE_MAP, 0, NULL, &numBytes);
+        }
+
+        if (err == MC_NO_ERROR) {
+            signature.faceMap.resize(numBytes / sizeof(uint32_t));
+            err = mcGetConnectedComponentData(fixture->context_, connComps[i], MC_CONNECTED_COMPONENT_DATA_FACE_MAP, numBytes, &signature.faceMap[0], NULL);
+            std::sort(signature.faceMap.begin(), signature.faceMap.end());
+        }
+    }
+
+    std::sort(signatures.begin(), signatures.end());
+
+    return mcReleaseConnectedComponents(fixture->context_, 0, NULL) == MC_NO_ERROR && err == MC_NO_ERROR;
+}
+
+UTEST_F(RegionOfInterest, smallCutMesh)
+{
+    // a cube that is centered near a vertex of the source mesh, and is much smaller than it
+    const float* v = utest_fixture->pSrcMeshVertices + 3 * 512;
+    const float c[3] = { v[0] + 1.3e-4f, v[1] - 0.7e-4f, v[2] + 0.9e-4f };
+    createCube(c, 0.08f, utest_fixture->cutMeshVertices, utest_fixture->cutMeshFaceIndices, utest_fixture->cutMeshFaceSizes);
+
+    std::vector<ConnectedComponentSignature> expected;
+    bool usedRegionOfInterest = true;
+    ASSERT_TRUE(dispatchAndGetSignatures(utest_fixture, 0, expected, usedRegionOfInterest));
+    ASSERT_FALSE(usedRegionOfInterest);
+
+    std::vector<ConnectedComponentSignature> signatures;
+    ASSERT_TRUE(dispatchAndGetSignatures(utest_fixture, MC_DISPATCH_REGION_OF_INTEREST, signatures, usedRegionOfInterest));
+    ASSERT_TRUE(usedRegionOfInterest);
+
+    ASSERT_EQ(signatures.size(), expected.size());
+
+    for (uint32_t i = 0; i < (uint32_t)signatures.size(); ++i) {
+        EXPECT_TRUE(signatures[i] == expected[i]);
+    }
+}
+
+UTEST_F(RegionOfInterest, largeCutMesh)
+{
+    // a cube that contains a large part of the source mesh (i.e. processing the whole source mesh is necessary)
+    const float c[3] = { -0.0213f, 0.1032f, 0.0071f };
+    createCube(c, 0.8f, utest_fixture->cutMeshVertices, utest_fixture->cutMeshFaceIndices, utest_fixture->cutMeshFaceSizes);
+
+    std::vector<ConnectedComponentSignature> expected;
+    bool usedRegionOfInterest = true;
+    ASSERT_TRUE(dispatchAndGetSignatures(utest_fixture, 0, expected, usedRegionOfInterest));
+
+    std::vector<ConnectedComponentSignature> signatures;
+    ASSERT_TRUE(dispatchAndGetSignatures(utest_fixture, MC_DISPATCH_REGION_OF_INTEREST, signatures, usedRegionOfInterest));
+    ASSERT_FALSE(usedRegionOfInterest);
+
+    ASSERT_EQ(signatures.size(), expected.size());
+
+    for (uint32_t i = 0; i < (uint32_t)signatures.size(); ++i) {
+        EXPECT_TRUE(signatures[i] == expected[i]);
+    }
+}
@@ -0,0 +1,167 @@
+/**
+ * Copyright (c) 2021-2022 Floyd M. Chitalu.
+ * All rights reserved.
+ * 
+ * NOTE: This file is licensed under GPL-3.0-or-later (default). 
+ * A commercial license can be purchased from Floyd M. Chitalu. 
+ *  
+ * License details:
+ * 
+ * (A)  GNU General Public License ("GPL"); a copy of which you should have 
+ *      recieved with this file.
+ * 	    - see also: <http://www.gnu.org/licenses/>
+ * (B)  Commercial license.
+ *      - email: floyd.m.chitalu@gmail.com
+ * 
+ * The commercial license options is for users that wish to use MCUT in 
+ * their products for comercial purposes but do not wish to release their 
+ * software products under the GPL license. 
+ * 
+ * Author(s)     : Floyd M. Chitalu
+ */
+
+#include "utest.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <mcut/mcut.h>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "off.h"
+
+#ifdef _WIN32
+#pragma warning(disable : 26812) // Unscoped enums from mcut.h
+#endif // _WIN32
+
+struct TraceExport {
+    McContext context_ = MC_NULL_HANDLE;
+
+    float* pSrcMeshVertices = NULL;
+    uint32_t* pSrcMeshFaceIndices = NULL;
+    uint32_t* pSrcMeshFaceSizes = NULL;
+    uint32_t numSrcMeshVertices = 0;
+    uint32_t numSrcMeshFaces = 0;
+
+    float* pCutMeshVertices = NULL;
+    uint32_t* pCutMeshFaceIndices = NULL;
+    uint32_t* pCutMeshFaceSizes = NULL;
+    uint32_t numCutMeshVertices = 0;
+    uint32_t numCutMeshFaces = 0;
+};
+
+UTEST_F_SETUP(TraceExport)
+{
+    McResult err = mcCreateContext(&utest_fixture->context_, MC_TRACING_ENABLE);
+    EXPECT_TRUE(utest_fixture->context_ != NULL);
+    EXPECT_EQ(err, MC_NO_ERROR);
+
+    const std::string srcMeshPath = std::string(MESHES_DIR) + "/benchmarks/src-mesh014.off";
+
+    readOFF(srcMeshPath.c_str(), &utest_fixture->pSrcMeshVertices, &utest_fixture->pSrcMeshFaceIndices, &utest_fixture->pSrcMeshFaceSizes, &utest_fixture->numSrcMeshVertices, &utest_fixture->numSrcMeshFaces);
+
+    ASSERT_TRUE(utest_fixture->pSrcMeshVertices != nullptr);
+
+    const std::string cutMeshPath = std::string(MESHES_DIR) + "/benchmarks/cut-mesh014.off";
+
+    readOFF(cutMeshPath.c_str(), &utest_fixture->pCutMeshVertices, &utest_fixture->pCutMeshFaceIndices, &utest_fixture->pCutMeshFaceSizes, &utest_fixture->numCutMeshVertices, &utest_fixture->numCutMeshFaces);
+
+    ASSERT_TRUE(utest_fixture->pCutMeshVertices != nullptr);
+
+    ASSERT_EQ(mcDispatch(
+                  utest_fixture->context_,
+                  MC_DISPATCH_VERTEX_ARRAY_FLOAT,
+                  utest_fixture->pSrcMeshVertices,
+                  utest_fixture->pSrcMeshFaceIndices,
+                  utest_fixture->pSrcMeshFaceSizes,
+                  utest_fixture->numSrcMeshVertices,
+                  utest_fixture->numSrcMeshFaces,
+                  utest_fixture->pCutMeshVertices,
+                  utest_fixture->pCutMeshFaceIndices,
+                  utest_fixture->pCutMeshFaceSizes,
+                  utest_fixture->numCutMeshVertices,
+                  utest_fixture->numCutMeshFaces),
+        MC_NO_ERROR);
+}
+
+UTEST_F_TEARDOWN(TraceExport)
+{
+    if (utest_fixture->context_ != MC_NULL_HANDLE) {
+        EXPECT_EQ(mcReleaseContext(utest_fixture->context_), MC_NO_ERROR);
+    }
+
+    free(utest_fixture->pSrcMeshVertices);
+    free(utest_fixture->pSrcMeshFaceIndices);
+    free(utest_fixture->pSrcMeshFaceSizes);
+    free(utest_fixture->pCutMeshVertices);
+    free(utest_fixture->pCutMeshFaceIndices);
+    free(utest_fixture->pCutMeshFaceSizes);
+}
+
+UTEST_F(TraceExport, queryTrace)
+{
+    uint64_t numBytes = 0;
+    ASSERT_EQ(mcGetInfo(utest_fixture->context_, MC_CONTEXT_TRACE, 0, nullptr, &numBytes), MC_NO_ERROR);
+    ASSERT_GT(numBytes, uint64_t(1));
+
+    std::vector<char> trace(numBytes);
+    ASSERT_EQ(mcGetInfo(utest_fixture->context_, MC_CONTEXT_TRACE, numBytes, &trace[0], nullptr), MC_NO_ERROR);
+    ASSERT_EQ(trace.back(), '\0');
+
+    const std::string json(&trace[0]);
+    EXPECT_NE(json.find("\"traceEvents\""), std::string::npos);
+    EXPECT_NE(json.find("\"ph\":\"B\""), std::string::npos);
+    EXPECT_NE(json.find("\"ph\":\"E\""), std::string::npos);
+    EXPECT_NE(json.find("\"mcDispatch\""), std::string::npos);
+    EXPECT_NE(json.find("\"Clip polygons\""), std::string::npos);
+}
+
+UTEST_F(TraceExport, queryTruncatedTrace)
+{
+    char trace[16];
+    ASSERT_EQ(mcGetInfo(utest_fixture->context_, MC_CONTEXT_TRACE, sizeof(trace), trace, nullptr), MC_NO_ERROR);
+    EXPECT_EQ(strlen(trace), sizeof(trace) - 1);
+}
+
+UTEST_F(TraceExport, writeTraceFileOnRelease)
+{
+    const std::string path = "mcut_test_trace.json";
+
+    ASSERT_EQ(mcSetContextProperty(utest_fixture->context_, MC_CONTEXT_TRACE_FILE, path.size() + 1, path.c_str()), MC_NO_ERROR);
+    ASSERT_EQ(mcReleaseContext(utest_fixture->context_), MC_NO_ERROR);
+    utest_fixture->context_ = MC_NULL_HANDLE;
+
+    std::ifstream file(path.c_str());
+    ASSERT_TRUE(file.good());
+
+    std::stringstream json;
+    json << file.rdbuf();
+    file.close();
+    std::remove(path.c_str());
+
+    EXPECT_NE(json.str().find("\"Clip polygons\""), std::string::npos);
+}
+
+UTEST_F(TraceExport, invalidTraceFilePath)
+{
+    const char path[] = "trace.json";
+    EXPECT_EQ(mcSetContextProperty(utest_fixture->context_, MC_CONTEXT_TRACE_FILE, sizeof(path) - 1, path), MC_INVALID_VALUE); // not null-terminated
+
+    const char missingDirPath[] = "no/such/directory/trace.json";
+    EXPECT_EQ(mcSetContextProperty(utest_fixture->context_, MC_CONTEXT_TRACE_FILE, sizeof(missingDirPath), missingDirPath), MC_INVALID_VALUE);
+}
+
+UTEST(TraceExportDisabled, queryWithoutTracing)
+{
+    McContext context = MC_NULL_HANDLE;
+    ASSERT_EQ(mcCreateContext(&context, 0), MC_NO_ERROR);
+
+    uint64_t numBytes = 0;
+    EXPECT_EQ(mcGetInfo(context, MC_CONTEXT_TRACE, 0, nullptr, &numBytes), MC_INVALID_OPERATION);
+
+    const char path[] = "trace.json";
+    EXPECT_EQ(mcSetContextProperty(context, MC_CONTEXT_TRACE_FILE, sizeof(path), path), MC_INVALID_OPERATION);
+
+    EXPECT_EQ(mcReleaseContext(context), MC_NO_ERROR);
+}